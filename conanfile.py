@@ -30,12 +30,16 @@ class ConanProject(ConanFile):
     implements = ["auto_header_only"]
 
     options = { "with_tests": [True, False],
+                "with_benchmarks": [True, False],
+                "with_tools": [True, False],
                 "with_docs": [True, False],
                 "with_coverage": [True, False],
                 "use_external_boost": [True,False]
     }
 
     default_options = { "with_tests": True,
+                        "with_benchmarks": False,
+                        "with_tools": True,
                         "with_docs": True,
                         "with_coverage": False,
                         "use_external_boost": False
@@ -65,9 +69,11 @@ class ConanProject(ConanFile):
         tc.variables["CONAN_PKG_DESCRIPTION"] = self.description
         tc.variables["CONAN_PKG_URL"]         = self.url
 
-        tc.variables["TERMINUS_LOG_ENABLE_TESTS"]    = self.options.with_tests
-        tc.variables["TERMINUS_LOG_ENABLE_DOCS"]     = self.options.with_docs
-        tc.variables["TERMINUS_LOG_ENABLE_COVERAGE"] = self.options.with_coverage
+        tc.variables["TERMINUS_LOG_ENABLE_TESTS"]      = self.options.with_tests
+        tc.variables["TERMINUS_LOG_ENABLE_BENCHMARKS"] = self.options.with_benchmarks
+        tc.variables["TERMINUS_LOG_ENABLE_TOOLS"]      = self.options.with_tools
+        tc.variables["TERMINUS_LOG_ENABLE_DOCS"]       = self.options.with_docs
+        tc.variables["TERMINUS_LOG_ENABLE_COVERAGE"]   = self.options.with_coverage
 
         tc.variables["TERMINUS_LOG_SOURCE_LOCATION_METHOD"] = "2"
 
@@ -92,7 +98,7 @@ class ConanProject(ConanFile):
 
     def export_sources(self):
 
-        for p in [ "CMakeLists.txt", "include/*", "src/*", "test/*", "README.md" ]:
+        for p in [ "CMakeLists.txt", "include/*", "src/*", "test/*", "tools/*", "README.md" ]:
             copy( self,
                   p,
                   self.recipe_folder,
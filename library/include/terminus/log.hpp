@@ -16,5 +16,7 @@
 
 // Terminus Libraries
 #include <terminus/log/exports.hpp>
+#include <terminus/log/field.hpp>
 #include <terminus/log/logger.hpp>
+#include <terminus/log/stats.hpp>
 #include <terminus/log/utility.hpp>
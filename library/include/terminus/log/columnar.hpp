@@ -0,0 +1,57 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    columnar.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Terminus Libraries
+#include <terminus/log/impl/columnar.hpp>
+
+/**
+ * Reading the columnar files written by the "ColumnFile" sink.
+ *
+ * A `Column_File` memory-maps a file and parses the directory of each block.  A column
+ * is only decoded when asked for, so aggregating by scope reads the scope ids and nothing
+ * else:
+ *
+ *     tmns::log::columnar::Column_File file{ "records.col" };
+ *     std::map<std::string_view,uint64_t> counts;
+ *     std::vector<uint32_t> ids;
+ *     for( const auto& block : file.blocks() )
+ *     {
+ *         if( auto scope = block.column( "Scope" ) )
+ *         {
+ *             const auto names = scope->dictionary();
+ *             scope->ids( ids );
+ *             for( size_t i = 0; i < ids.size(); ++i )
+ *             {
+ *                 counts[names[ids[i]]] += scope->has_value( i ) ? 1 : 0;
+ *             }
+ *         }
+ *     }
+*/
+namespace tmns::log::columnar {
+
+/// Memory-mapped columnar file and its blocks
+using Column_File = impl::columnar::Column_File;
+
+/// Directory of one block's columns
+using Block_View = impl::columnar::Block_View;
+
+/// One column of a block, decoded on request
+using Column_View = impl::columnar::Column_View;
+
+/// How a column's values are stored
+using Encoding = impl::columnar::Encoding;
+
+} // End of tmns::log::columnar namespace
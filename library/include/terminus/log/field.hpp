@@ -0,0 +1,105 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    field.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// C++ Libraries
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace tmns::log {
+
+/**
+ * A named, typed value attached to a log record as its own attribute instead of
+ * being written into the message.  Create fields with `kv()`.
+ *
+ * Values are normalized to one of `bool`, `int64_t`, `uint64_t`, `double`, or
+ * `std::string_view`.  A string field refers to the caller's string, so a field
+ * must be passed directly to a logging call and not stored.
+*/
+template <typename ValueT>
+struct Field
+{
+    /// Name of the record attribute
+    std::string_view name;
+
+    /// Value of the record attribute
+    ValueT value;
+
+}; // End of Field struct
+
+namespace impl {
+
+/**
+ * Maps the type passed to `kv()` to the type stored in the field.
+*/
+template <typename ValueT>
+constexpr auto field_value_type()
+{
+    if constexpr( std::is_same_v<ValueT,bool> )
+    {
+        return std::type_identity<bool>{};
+    }
+    else if constexpr( std::is_integral_v<ValueT> && std::is_signed_v<ValueT> )
+    {
+        return std::type_identity<int64_t>{};
+    }
+    else if constexpr( std::is_integral_v<ValueT> )
+    {
+        return std::type_identity<uint64_t>{};
+    }
+    else if constexpr( std::is_floating_point_v<ValueT> )
+    {
+        return std::type_identity<double>{};
+    }
+    else
+    {
+        static_assert( std::is_convertible_v<const ValueT&,std::string_view>,
+                       "Field values must be booleans, numbers, or strings" );
+        return std::type_identity<std::string_view>{};
+    }
+}
+
+template <typename ValueT>
+using field_value_t = typename decltype( field_value_type<std::remove_cvref_t<ValueT>>() )::type;
+
+template <typename T>
+struct is_field : std::false_type {};
+
+template <typename ValueT>
+struct is_field<Field<ValueT>> : std::true_type {};
+
+/// True if the argument passed to a logging function is a field rather than part of the message
+template <typename T>
+inline constexpr bool is_field_v = is_field<std::remove_cvref_t<T>>::value;
+
+} // End of impl namespace
+
+/**
+ * Creates a field to pass to any of the logging functions, for example
+ * `logger.info( "order filled", kv( "qty", 5 ), kv( "px", 101.25 ) )`.
+ *
+ * The field is stored on the record as an attribute with the provided name, so text
+ * formats can reference it as `%qty%` and the JSON formatter writes it as a native
+ * JSON value.  A field does not replace an attribute the record already has.
+*/
+template <typename ValueT>
+constexpr Field<impl::field_value_t<ValueT>> kv( std::string_view name,
+                                                 const ValueT&    value )
+{
+    return { name, impl::field_value_t<ValueT>( value ) };
+}
+
+} // End of tmns::log namespace
@@ -24,6 +24,16 @@
 
 namespace tmns::log::impl::attributes {
 
+/**
+ * The "Scope" attribute of records produced through Boost.Log's trivial logger, matching
+ * the "global" scope of the global logging functions.
+*/
+inline const boost::log::attributes::constant<std::string>& global_scope()
+{
+    static const boost::log::attributes::constant<std::string> SCOPE{ "global" };
+    return SCOPE;
+}
+
 /**
  * Configures the attributes that will be applied to every log record. It also
  * sets up the scope on the global logger.
@@ -43,7 +53,7 @@ inline bool configure()
      * owned by our `tmns::log::impl::Logger` instances.
     */
    auto& logger = boost::log::trivial::logger::get();
-   logger.add_attribute("Scope", boost::log::attributes::constant<std::string>("global"));
+   logger.add_attribute("Scope", global_scope());
 
    return true;
 }
@@ -0,0 +1,423 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    binary_format.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Project Libraries
+#include <terminus/log/impl/boost/format.hpp>
+
+// Boost Libraries
+#include <boost/algorithm/string/case_conv.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/log/attributes/current_process_id.hpp>
+#include <boost/log/attributes/current_thread_id.hpp>
+#include <boost/log/attributes/value_extraction.hpp>
+#include <boost/log/attributes/value_visitation.hpp>
+#include <boost/log/core/record_view.hpp>
+#include <boost/log/trivial.hpp>
+#include <boost/log/utility/formatting_ostream.hpp>
+
+// C++ Libraries
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace tmns::log::impl::format {
+
+/**
+ * Record encodings a sink can select with its "Encoding" setting.
+*/
+enum class Encoding
+{
+    TEXT,
+    JSON,
+    CBOR,
+    MSGPACK,
+}; // End of Encoding enum
+
+/**
+ * Parses an "Encoding" setting: "Text", "Json", "Cbor", or "MsgPack" (or "MessagePack"),
+ * in any case.
+ *
+ * @throws std::runtime_error if the value is none of these.
+*/
+inline Encoding parse_encoding( const std::string& value )
+{
+    const auto lower = boost::algorithm::to_lower_copy( value );
+    if( lower == "text" )
+    {
+        return Encoding::TEXT;
+    }
+    if( lower == "json" )
+    {
+        return Encoding::JSON;
+    }
+    if( lower == "cbor" )
+    {
+        return Encoding::CBOR;
+    }
+    if( lower == "msgpack" || lower == "messagepack" )
+    {
+        return Encoding::MSGPACK;
+    }
+    throw std::runtime_error( "Invalid Encoding \"" + value + "\": must be \"Text\", \"Json\", \"Cbor\", or \"MsgPack\"" );
+}
+
+namespace detail {
+
+/**
+ * Appends CBOR (RFC 8949) or MessagePack items to a string.  Integers are written in the
+ * shortest form, big-endian as both formats require.
+*/
+template <Encoding EncodingT>
+class Binary_Writer
+{
+    public:
+
+        static_assert( EncodingT == Encoding::CBOR || EncodingT == Encoding::MSGPACK );
+
+        explicit Binary_Writer( std::string& out )
+          : m_out{ out }
+        {
+        }
+
+        void map_header( uint64_t size )
+        {
+            if constexpr( EncodingT == Encoding::CBOR )
+            {
+                cbor_head( 5, size );
+            }
+            else if( size < 16 )
+            {
+                byte( 0x80 | size );
+            }
+            else if( size <= UINT16_MAX )
+            {
+                byte( 0xde );
+                big_endian( static_cast<uint16_t>( size ) );
+            }
+            else
+            {
+                byte( 0xdf );
+                big_endian( static_cast<uint32_t>( size ) );
+            }
+        }
+
+        void string( std::string_view value )
+        {
+            if constexpr( EncodingT == Encoding::CBOR )
+            {
+                cbor_head( 3, value.size() );
+            }
+            else if( value.size() < 32 )
+            {
+                byte( 0xa0 | value.size() );
+            }
+            else if( value.size() <= UINT8_MAX )
+            {
+                byte( 0xd9 );
+                byte( value.size() );
+            }
+            else if( value.size() <= UINT16_MAX )
+            {
+                byte( 0xda );
+                big_endian( static_cast<uint16_t>( value.size() ) );
+            }
+            else
+            {
+                byte( 0xdb );
+                big_endian( static_cast<uint32_t>( value.size() ) );
+            }
+            m_out.append( value );
+        }
+
+        void unsigned_integer( uint64_t value )
+        {
+            if constexpr( EncodingT == Encoding::CBOR )
+            {
+                cbor_head( 0, value );
+            }
+            else if( value < 128 )
+            {
+                byte( value );
+            }
+            else if( value <= UINT8_MAX )
+            {
+                byte( 0xcc );
+                byte( value );
+            }
+            else if( value <= UINT16_MAX )
+            {
+                byte( 0xcd );
+                big_endian( static_cast<uint16_t>( value ) );
+            }
+            else if( value <= UINT32_MAX )
+            {
+                byte( 0xce );
+                big_endian( static_cast<uint32_t>( value ) );
+            }
+            else
+            {
+                byte( 0xcf );
+                big_endian( value );
+            }
+        }
+
+        void signed_integer( int64_t value )
+        {
+            if( value >= 0 )
+            {
+                unsigned_integer( static_cast<uint64_t>( value ) );
+            }
+            else if constexpr( EncodingT == Encoding::CBOR )
+            {
+                cbor_head( 1, static_cast<uint64_t>( -( value + 1 ) ) );
+            }
+            else if( value >= -32 )
+            {
+                byte( static_cast<uint8_t>( value ) );
+            }
+            else if( value >= INT8_MIN )
+            {
+                byte( 0xd0 );
+                byte( static_cast<uint8_t>( value ) );
+            }
+            else if( value >= INT16_MIN )
+            {
+                byte( 0xd1 );
+                big_endian( static_cast<uint16_t>( value ) );
+            }
+            else if( value >= INT32_MIN )
+            {
+                byte( 0xd2 );
+                big_endian( static_cast<uint32_t>( value ) );
+            }
+            else
+            {
+                byte( 0xd3 );
+                big_endian( static_cast<uint64_t>( value ) );
+            }
+        }
+
+        void boolean( bool value )
+        {
+            if constexpr( EncodingT == Encoding::CBOR )
+            {
+                byte( value ? 0xf5 : 0xf4 );
+            }
+            else
+            {
+                byte( value ? 0xc3 : 0xc2 );
+            }
+        }
+
+        void floating( double value )
+        {
+            byte( EncodingT == Encoding::CBOR ? 0xfb : 0xcb );
+            big_endian( std::bit_cast<uint64_t>( value ) );
+        }
+
+    private:
+
+        void byte( uint64_t value )
+        {
+            m_out.push_back( static_cast<char>( value & 0xFF ) );
+        }
+
+        template <typename UnsignedT>
+        void big_endian( UnsignedT value )
+        {
+            for( int shift = 8 * ( static_cast<int>( sizeof( UnsignedT ) ) - 1 ); shift >= 0; shift -= 8 )
+            {
+                byte( value >> shift );
+            }
+        }
+
+        /**
+         * Writes a CBOR major type and its argument.
+        */
+        void cbor_head( uint8_t  major,
+                        uint64_t value )
+        {
+            const uint64_t type = static_cast<uint64_t>( major ) << 5;
+            if( value < 24 )
+            {
+                byte( type | value );
+            }
+            else if( value <= UINT8_MAX )
+            {
+                byte( type | 24 );
+                byte( value );
+            }
+            else if( value <= UINT16_MAX )
+            {
+                byte( type | 25 );
+                big_endian( static_cast<uint16_t>( value ) );
+            }
+            else if( value <= UINT32_MAX )
+            {
+                byte( type | 26 );
+                big_endian( static_cast<uint32_t>( value ) );
+            }
+            else
+            {
+                byte( type | 27 );
+                big_endian( value );
+            }
+        }
+
+        std::string& m_out;
+
+}; // End of Binary_Writer class
+
+/**
+ * Writes the record as one map to `stream`.  See `cbor()`.
+*/
+template <Encoding EncodingT>
+void binary_record( boost::log::record_view const&  rec,
+                    boost::log::formatting_ostream& stream )
+{
+    namespace bl = boost::log;
+    static const boost::posix_time::ptime EPOCH{ boost::gregorian::date( 1970, 1, 1 ) };
+
+    // Members are written after the map header, whose size is only known at the end
+    thread_local std::string body;
+    body.clear();
+    Binary_Writer<EncodingT> writer{ body };
+    uint64_t members = 0;
+    auto key = [&writer, &members]( std::string_view name ) -> Binary_Writer<EncodingT>&
+    {
+        ++members;
+        writer.string( name );
+        return writer;
+    };
+
+    if( const auto val = bl::extract<uint64_t>( "RecordID", rec ) )
+    {
+        key( "RecordID" ).unsigned_integer( val.get() );
+    }
+    if( const auto val = bl::extract<bl::trivial::severity_level>( "Severity", rec ) )
+    {
+        key( "Severity" ).string( bl::trivial::to_string( val.get() ) );
+    }
+    if( const auto val = bl::extract<std::string>( "Message", rec ) )
+    {
+        key( "Message" ).string( val.get() );
+    }
+    if( const auto val = bl::extract<boost::posix_time::ptime>( "TimeStamp", rec ) )
+    {
+        key( "TimeStamp" ).signed_integer( ( val.get() - EPOCH ).total_microseconds() * 1000 );
+    }
+    if( const auto val = bl::extract<std::string>( "Scope", rec ) )
+    {
+        key( "Scope" ).string( val.get() );
+    }
+    if( const auto val = bl::extract<std::string>( "ProcessName", rec ) )
+    {
+        key( "ProcessName" ).string( val.get() );
+    }
+    if( const auto val = bl::extract<std::string>( "ProcessID", rec ) )
+    {
+        key( "ProcessID" ).string( val.get() );
+    }
+    else if( const auto pid = bl::extract<bl::process_id>( "ProcessID", rec ) )
+    {
+        key( "ProcessID" ).unsigned_integer( static_cast<uint64_t>( pid.get().native_id() ) );
+    }
+    if( const auto val = bl::extract<bl::thread_id>( "ThreadID", rec ) )
+    {
+        key( "ThreadID" ).unsigned_integer( static_cast<uint64_t>( val.get().native_id() ) );
+    }
+    if( const auto val = bl::extract<std::string>( "File", rec ) )
+    {
+        key( "File" ).string( val.get() );
+    }
+    if( const auto val = bl::extract<int64_t>( "Line", rec ) )
+    {
+        key( "Line" ).signed_integer( val.get() );
+    }
+    if( const auto val = bl::extract<std::string>( "Function", rec ) )
+    {
+        key( "Function" ).string( val.get() );
+    }
+
+    // Fields
+    for( const auto& [name, value] : rec.attribute_values() )
+    {
+        if( is_core_attribute( name.string() ) )
+        {
+            continue;
+        }
+        bl::visit<Json_Field_Types>( value, [&key, &name]( const auto& field )
+        {
+            using field_type = std::remove_cvref_t<decltype( field )>;
+            auto& out = key( name.string() );
+            if constexpr( std::is_same_v<field_type,bool> )
+            {
+                out.boolean( field );
+            }
+            else if constexpr( std::is_same_v<field_type,int64_t> )
+            {
+                out.signed_integer( field );
+            }
+            else if constexpr( std::is_same_v<field_type,uint64_t> )
+            {
+                out.unsigned_integer( field );
+            }
+            else if constexpr( std::is_same_v<field_type,double> )
+            {
+                out.floating( field );
+            }
+            else
+            {
+                out.string( field );
+            }
+        });
+    }
+
+    thread_local std::string header;
+    header.clear();
+    Binary_Writer<EncodingT>{ header }.map_header( members );
+    stream.write( header.data(), static_cast<std::streamsize>( header.size() ) );
+    stream.write( body.data(), static_cast<std::streamsize>( body.size() ) );
+}
+
+} // End of detail namespace
+
+/**
+ * Formats a Boost.Log record as one CBOR map with the members `json()` writes, so a file
+ * or stream of records is a CBOR sequence (RFC 8742).  Integers and doubles stay binary,
+ * strings are written as they are, and "TimeStamp" is an integer count of nanoseconds
+ * since the Unix epoch.
+*/
+inline void cbor( boost::log::record_view const&  rec,
+                  boost::log::formatting_ostream& stream )
+{
+    detail::binary_record<Encoding::CBOR>( rec, stream );
+}
+
+/**
+ * Formats a Boost.Log record as one MessagePack map.  See `cbor()`.
+*/
+inline void msgpack( boost::log::record_view const&  rec,
+                     boost::log::formatting_ostream& stream )
+{
+    detail::binary_record<Encoding::MSGPACK>( rec, stream );
+}
+
+} // End of tmns::log::impl::format namespace
@@ -0,0 +1,237 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    column_file_backend.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Project Libraries
+#include <terminus/log/impl/columnar.hpp>
+#include <terminus/log/impl/stats.hpp>
+
+// Boost Libraries
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/log/attributes/current_thread_id.hpp>
+#include <boost/log/attributes/value_extraction.hpp>
+#include <boost/log/core/record_view.hpp>
+#include <boost/log/sinks/basic_sink_backend.hpp>
+#include <boost/log/sinks/frontend_requirements.hpp>
+#include <boost/log/trivial.hpp>
+
+// C++ Libraries
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace tmns::log::impl::sinks {
+
+/**
+ * Settings of a `Column_File_Backend`.
+*/
+struct Column_File_Options
+{
+    std::filesystem::path file_name;
+
+    /// Records buffered into a block before it is written
+    uint32_t block_size{ 65536 };
+
+    /// Append blocks to an existing columnar file instead of truncating it
+    bool append{ false };
+
+}; // End of Column_File_Options struct
+
+/**
+ * Sink backend writing records to a columnar file for the "ColumnFile" sink.  See
+ * `columnar.hpp` for the file format.
+ *
+ * Records are not formatted: their attribute values are added to the columns of a
+ * `columnar::Block_Builder`, and each full block is written with one `fwrite`.  A flush
+ * writes the partial block, so frequent flushes make smaller blocks.  Attributes other
+ * than the ones in `columnar::Row` are not stored.
+*/
+class Column_File_Backend
+    : public boost::log::sinks::basic_sink_backend<boost::log::sinks::combine_requirements<
+                                                       boost::log::sinks::synchronized_feeding,
+                                                       boost::log::sinks::flushing>::type>
+{
+    public:
+
+        /**
+         * Opens the file, creating it and its parent directories if needed.
+         *
+         * @throws std::runtime_error if the file cannot be opened, or is appended to and
+         *         is not a columnar file.
+        */
+        Column_File_Backend( Column_File_Options                   options,
+                             std::shared_ptr<stats::Sink_Counters> counters )
+          : m_options{ std::move( options ) },
+            m_counters{ std::move( counters ) }
+        {
+            const auto name = m_options.file_name.string();
+            if( m_options.file_name.has_parent_path() )
+            {
+                std::filesystem::create_directories( m_options.file_name.parent_path() );
+            }
+
+            std::error_code error;
+            const auto size = m_options.append ? std::filesystem::file_size( m_options.file_name, error ) : 0;
+            if( m_options.append && !error && size > 0 )
+            {
+                char magic[columnar::FILE_MAGIC.size()] = {};
+                std::FILE* existing = std::fopen( name.c_str(), "rb" );
+                const bool valid = existing != nullptr &&
+                                   std::fread( magic, 1, sizeof( magic ), existing ) == sizeof( magic ) &&
+                                   std::string_view{ magic, sizeof( magic ) } == columnar::FILE_MAGIC;
+                if( existing != nullptr )
+                {
+                    std::fclose( existing );
+                }
+                if( !valid )
+                {
+                    throw std::runtime_error( "Cannot append to \"" + name + "\": not a columnar log file" );
+                }
+            }
+
+            m_file = std::fopen( name.c_str(), m_options.append ? "ab" : "wb" );
+            if( m_file == nullptr )
+            {
+                throw std::runtime_error( "Failed to open log file \"" + name + "\": " + std::strerror( errno ) );
+            }
+            std::setvbuf( m_file, nullptr, _IONBF, 0 );
+            if( !m_options.append || error || size == 0 )
+            {
+                m_buffer.assign( columnar::FILE_MAGIC );
+                write_buffer( 0 );
+            }
+        }
+
+        Column_File_Backend( const Column_File_Backend& ) = delete;
+        Column_File_Backend& operator=( const Column_File_Backend& ) = delete;
+
+        ~Column_File_Backend()
+        {
+            write_block();
+            std::fclose( m_file );
+        }
+
+        void consume( const boost::log::record_view& rec )
+        {
+            namespace bl = boost::log;
+            static const boost::posix_time::ptime EPOCH{ boost::gregorian::date( 1970, 1, 1 ) };
+
+            columnar::Row row;
+            if( auto val = bl::extract<uint64_t>( "RecordID", rec ) )
+            {
+                row.record_id = val.get();
+            }
+            if( auto val = bl::extract<boost::posix_time::ptime>( "TimeStamp", rec ) )
+            {
+                row.time_stamp = ( val.get() - EPOCH ).total_microseconds();
+            }
+            if( auto val = bl::extract<bl::trivial::severity_level>( "Severity", rec ) )
+            {
+                row.severity = bl::trivial::to_string( val.get() );
+            }
+            auto scope = bl::extract<std::string>( "Scope", rec );
+            if( scope )
+            {
+                row.scope = scope.get();
+            }
+            if( auto val = bl::extract<bl::thread_id>( "ThreadID", rec ) )
+            {
+                row.thread_id = static_cast<uint64_t>( val.get().native_id() );
+            }
+            auto file = bl::extract<std::string>( "File", rec );
+            if( file )
+            {
+                row.file = file.get();
+            }
+            if( auto val = bl::extract<int64_t>( "Line", rec ) )
+            {
+                row.line = val.get();
+            }
+            auto function = bl::extract<std::string>( "Function", rec );
+            if( function )
+            {
+                row.function = function.get();
+            }
+            auto message = bl::extract<std::string>( "Message", rec );
+            if( message )
+            {
+                row.message = message.get();
+            }
+
+            m_block.add( row );
+            if( m_block.size() >= m_options.block_size )
+            {
+                write_block();
+            }
+        }
+
+        /**
+         * Writes the buffered records as a block.
+        */
+        void flush()
+        {
+            write_block();
+        }
+
+    private:
+
+        void write_block()
+        {
+            const uint64_t records = m_block.size();
+            if( records == 0 )
+            {
+                return;
+            }
+            m_buffer.clear();
+            m_block.write( m_buffer );
+            write_buffer( records );
+        }
+
+        /**
+         * Writes the buffer and reports its records to the sink's counters once per write
+         * instead of once per record.
+        */
+        void write_buffer( uint64_t records )
+        {
+            if( std::fwrite( m_buffer.data(), 1, m_buffer.size(), m_file ) == m_buffer.size() )
+            {
+                m_counters->records_emitted.fetch_add( records, std::memory_order_relaxed );
+                m_counters->bytes_written.fetch_add( m_buffer.size(), std::memory_order_relaxed );
+            }
+            else
+            {
+                m_counters->records_dropped.fetch_add( records, std::memory_order_relaxed );
+            }
+            m_buffer.clear();
+        }
+
+        Column_File_Options m_options;
+
+        std::shared_ptr<stats::Sink_Counters> m_counters;
+
+        std::FILE* m_file{ nullptr };
+
+        columnar::Block_Builder m_block;
+
+        std::string m_buffer;
+
+}; // End of Column_File_Backend class
+
+} // End of tmns::log::impl::sinks namespace
@@ -18,11 +18,12 @@
 #include <terminus/log/impl/boost/attributes.hpp>
 #include <terminus/log/impl/boost/format.hpp>
 #include <terminus/log/impl/boost/sinks.hpp>
+#include <terminus/log/impl/boost/threshold.hpp>
 
 // Boost Libraries
 #include <boost/log/expressions.hpp>
-#include <boost/log/utility/setup/console.hpp>
-#include <boost/log/utility/setup/from_stream.hpp>
+#include <boost/log/utility/setup/from_settings.hpp>
+#include <boost/log/utility/setup/settings_parser.hpp>
 
 // C++ Libraries
 #include <filesystem>
@@ -40,8 +41,8 @@ inline bool configure()
 {
     const std::string FORMAT_STR = R"([%TimeStamp%] %Severity(align=true,brackets=true)% %File%:%LineID% (%Scope%) %Message%)";
     format::configure();
-    boost::log::add_console_log( std::cerr,
-                                 boost::log::keywords::format = FORMAT_STR );
+    sinks::add_console_sink( std::cerr, FORMAT_STR, "Console" );
+    Severity_Threshold::instance().update( ALL_SEVERITIES );
     return attributes::configure();
 }
 
@@ -63,11 +64,45 @@ inline bool configure( std::istream& config_stream )
     format::configure();
     try
     {
-        boost::log::init_from_stream( config_stream );
+        auto settings = boost::log::parse_settings( config_stream );
+
+        // Report each sink's statistics under the name of its section
+        if( auto sink_sections = settings.property_tree().get_child_optional( "Sinks" ) )
+        {
+            for( auto& [name, section] : *sink_sections )
+            {
+                if( !section.get_child_optional( "Name" ) )
+                {
+                    section.put( "Name", name );
+                }
+            }
+        }
+        auto& threshold = Severity_Threshold::instance();
+        const size_t sinks_before = threshold.sinks_added();
+        boost::log::init_from_settings( settings );
+
+        // Sinks from factories of other libraries do not report their levels
+        size_t sink_count = 0;
+        if( auto sink_sections = settings.property_tree().get_child_optional( "Sinks" ) )
+        {
+            sink_count = sink_sections->size();
+        }
+        if( threshold.sinks_added() - sinks_before < sink_count )
+        {
+            threshold.add_unknown_sink();
+        }
+
+        Severity_Mask core_levels = ALL_SEVERITIES;
+        if( boost::optional<std::string> oFilter = settings["Core"]["Filter"] )
+        {
+            core_levels = filter::severity_mask( *oFilter );
+        }
+        threshold.update( core_levels );
     }
     catch(const std::exception& e)
     {
         std::cerr << "Failed to load Boost.Log settings: " << e.what() << std::endl;
+        Severity_Threshold::instance().update( ALL_SEVERITIES );
         return false;
     }
     return attributes::configure();
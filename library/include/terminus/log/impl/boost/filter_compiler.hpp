@@ -0,0 +1,699 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    filter_compiler.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+/**
+ * Compiles the "Filter" setting of the sinks.  Filters that only test the "Scope" and
+ * "Severity" attributes are resolved once per distinct scope, and the result is shared
+ * by every sink of the same configuration as a bitset of the sinks accepting each
+ * severity level.
+*/
+
+// Project Libraries
+#include <terminus/log/impl/boost/threshold.hpp>
+
+// Boost Libraries
+#include <boost/log/attributes/attribute_name.hpp>
+#include <boost/log/attributes/attribute_value_set.hpp>
+#include <boost/log/attributes/value_extraction.hpp>
+#include <boost/log/expressions/filter.hpp>
+#include <boost/log/trivial.hpp>
+#include <boost/log/utility/setup/filter_parser.hpp>
+
+// C++ Libraries
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace tmns::log::impl::filter {
+
+using severity_level = boost::log::trivial::severity_level;
+
+/// Number of severity levels
+inline constexpr size_t SEVERITY_LEVELS = static_cast<size_t>( severity_level::fatal ) + 1;
+
+/**
+ * Filter expression over the "Scope" and "Severity" attributes of a record.
+*/
+struct Expression
+{
+    enum class Kind
+    {
+        AND,
+        OR,
+        NOT,
+        PRESENT,
+        SCOPE,
+        SEVERITY,
+    }; // End of Kind enum
+
+    enum class Relation
+    {
+        EQUAL,
+        NOT_EQUAL,
+        LESS,
+        GREATER,
+        LESS_EQUAL,
+        GREATER_EQUAL,
+        CONTAINS,
+        BEGINS_WITH,
+        ENDS_WITH,
+    }; // End of Relation enum
+
+    Kind kind{ Kind::PRESENT };
+
+    Relation relation{ Relation::EQUAL };
+
+    /// Right-hand side of a "Scope" relation
+    std::string operand;
+
+    /// Right-hand side of a "Severity" relation
+    severity_level level{ severity_level::trace };
+
+    std::vector<Expression> children;
+
+    [[nodiscard]] bool evaluate( std::string_view scope,
+                                 severity_level   severity ) const
+    {
+        switch( kind )
+        {
+            case Kind::AND:
+                return children[0].evaluate( scope, severity ) && children[1].evaluate( scope, severity );
+            case Kind::OR:
+                return children[0].evaluate( scope, severity ) || children[1].evaluate( scope, severity );
+            case Kind::NOT:
+                return !children[0].evaluate( scope, severity );
+            case Kind::PRESENT:
+                return true;
+            case Kind::SCOPE:
+                return compare( scope, std::string_view{ operand } );
+            case Kind::SEVERITY:
+                return compare( severity, level );
+        }
+        return false;
+    }
+
+    /**
+     * Evaluates the expression for a record at the severity level without knowing its
+     * scope.  Returns nothing when the result depends on the scope.
+    */
+    [[nodiscard]] std::optional<bool> evaluate( severity_level severity ) const
+    {
+        switch( kind )
+        {
+            case Kind::AND:
+            {
+                auto lhs = children[0].evaluate( severity );
+                auto rhs = children[1].evaluate( severity );
+                if( lhs == false || rhs == false )
+                {
+                    return false;
+                }
+                return lhs && rhs ? std::optional<bool>{ true } : std::nullopt;
+            }
+            case Kind::OR:
+            {
+                auto lhs = children[0].evaluate( severity );
+                auto rhs = children[1].evaluate( severity );
+                if( lhs == true || rhs == true )
+                {
+                    return true;
+                }
+                return lhs && rhs ? std::optional<bool>{ false } : std::nullopt;
+            }
+            case Kind::NOT:
+            {
+                auto child = children[0].evaluate( severity );
+                return child ? std::optional<bool>{ !*child } : std::nullopt;
+            }
+            case Kind::PRESENT:
+                return true;
+            case Kind::SCOPE:
+                return std::nullopt;
+            case Kind::SEVERITY:
+                return compare( severity, level );
+        }
+        return std::nullopt;
+    }
+
+    private:
+
+        template <typename ValueT>
+        [[nodiscard]] bool compare( const ValueT& lhs,
+                                    const ValueT& rhs ) const
+        {
+            switch( relation )
+            {
+                case Relation::EQUAL:         return lhs == rhs;
+                case Relation::NOT_EQUAL:     return lhs != rhs;
+                case Relation::LESS:          return lhs < rhs;
+                case Relation::GREATER:       return lhs > rhs;
+                case Relation::LESS_EQUAL:    return lhs <= rhs;
+                case Relation::GREATER_EQUAL: return lhs >= rhs;
+                default: break;
+            }
+            if constexpr( std::is_same_v<ValueT,std::string_view> )
+            {
+                switch( relation )
+                {
+                    case Relation::CONTAINS:    return lhs.find( rhs ) != std::string_view::npos;
+                    case Relation::BEGINS_WITH: return lhs.starts_with( rhs );
+                    case Relation::ENDS_WITH:   return lhs.ends_with( rhs );
+                    default: break;
+                }
+            }
+            return false;
+        }
+
+}; // End of Expression struct
+
+/**
+ * Filters of the sinks created by one configuration, and the verdicts of those filters
+ * for every scope seen so far.
+ *
+ * Each scope has a row holding, per severity level, a bitset of the sinks that accept
+ * it.  A sink's bit is resolved the first time the sink sees the scope, so sinks can be
+ * added while records are flowing.  Rows are never removed.
+*/
+class Filter_Table
+{
+    public:
+
+        /// Maximum number of sinks sharing a table
+        static constexpr size_t MAX_SINKS = 64;
+
+        Filter_Table() : m_id{ next_id() }
+        {
+        }
+
+        Filter_Table( const Filter_Table& ) = delete;
+        Filter_Table& operator=( const Filter_Table& ) = delete;
+
+        /**
+         * Adds the filter of a sink, returning its index in the bitsets, or nothing when
+         * the table is full.
+        */
+        std::optional<size_t> add_sink( Expression expression )
+        {
+            std::lock_guard<std::mutex> lock{ m_sinks_mutex };
+            if( m_sink_count == MAX_SINKS )
+            {
+                return std::nullopt;
+            }
+            m_sinks[m_sink_count] = std::make_unique<const Expression>( std::move( expression ) );
+            return m_sink_count++;
+        }
+
+        /**
+         * Returns true if the sink accepts records of the scope at the severity level.
+        */
+        [[nodiscard]] bool accepts( size_t           sink,
+                                    std::string_view scope,
+                                    severity_level   level ) const
+        {
+            // Consecutive lookups, such as every sink filtering the same record, usually
+            // ask for the same scope
+            thread_local Memo memo;
+            if( memo.table != m_id || memo.scope != scope )
+            {
+                memo.row   = &find_row( scope );
+                memo.scope = memo.row->scope;
+                memo.table = m_id;
+            }
+
+            const Row& row = *memo.row;
+            const uint64_t bit = uint64_t{ 1 } << sink;
+            if( ( row.resolved.load( std::memory_order_acquire ) & bit ) == 0 )
+            {
+                resolve( row, sink );
+            }
+            return ( row.accepting[static_cast<size_t>( level )].load( std::memory_order_relaxed ) & bit ) != 0;
+        }
+
+    private:
+
+        struct Row
+        {
+            explicit Row( std::string_view name ) : scope{ name } {}
+
+            std::string scope;
+
+            mutable std::array<std::atomic<uint64_t>,SEVERITY_LEVELS> accepting{};
+
+            mutable std::atomic<uint64_t> resolved{ 0 };
+        }; // End of Row struct
+
+        struct Memo
+        {
+            uint64_t         table{ 0 };
+            std::string_view scope;
+            const Row*       row{ nullptr };
+        }; // End of Memo struct
+
+        static uint64_t next_id()
+        {
+            static std::atomic<uint64_t> s_next{ 1 };
+            return s_next.fetch_add( 1, std::memory_order_relaxed );
+        }
+
+        const Row& find_row( std::string_view scope ) const
+        {
+            {
+                std::shared_lock<std::shared_mutex> lock{ m_rows_mutex };
+                if( auto it = m_rows.find( scope ); it != m_rows.end() )
+                {
+                    return *it->second;
+                }
+            }
+
+            std::lock_guard<std::shared_mutex> lock{ m_rows_mutex };
+            auto [it, inserted] = m_rows.try_emplace( std::string{ scope } );
+            if( inserted )
+            {
+                it->second = std::make_unique<const Row>( scope );
+            }
+            return *it->second;
+        }
+
+        /**
+         * Evaluates the sink's filter for the row's scope at every severity level.  Threads
+         * racing to resolve the same bit store the same result.
+        */
+        void resolve( const Row& row,
+                      size_t     sink ) const
+        {
+            const uint64_t bit = uint64_t{ 1 } << sink;
+            for( size_t level = 0; level < SEVERITY_LEVELS; ++level )
+            {
+                if( m_sinks[sink]->evaluate( row.scope, static_cast<severity_level>( level ) ) )
+                {
+                    row.accepting[level].fetch_or( bit, std::memory_order_relaxed );
+                }
+            }
+            row.resolved.fetch_or( bit, std::memory_order_release );
+        }
+
+        const uint64_t m_id;
+
+        std::mutex m_sinks_mutex;
+
+        /// Filter of each sink, never changed once the sink has an index
+        std::array<std::unique_ptr<const Expression>,MAX_SINKS> m_sinks;
+
+        size_t m_sink_count{ 0 };
+
+        mutable std::shared_mutex m_rows_mutex;
+
+        mutable std::map<std::string,std::unique_ptr<const Row>,std::less<>> m_rows;
+
+}; // End of Filter_Table class
+
+/**
+ * Returns the table shared by the sinks being created by the current configuration.
+*/
+inline std::shared_ptr<Filter_Table>& current_table()
+{
+    static std::shared_ptr<Filter_Table> s_table = std::make_shared<Filter_Table>();
+    return s_table;
+}
+
+/**
+ * Starts a new table for the sinks created from here on.  Sinks created earlier keep
+ * the table they were created with.
+*/
+inline void reset_table()
+{
+    current_table() = std::make_shared<Filter_Table>();
+}
+
+/**
+ * Filter produced by `compile_filter()`.  Records whose "Scope" is not a string or whose
+ * "Severity" is not a severity level are passed to the filter Boost.Log parsed from the
+ * same string.
+*/
+class Compiled_Filter
+{
+    public:
+
+        Compiled_Filter( std::shared_ptr<const Filter_Table> table,
+                         size_t                              sink,
+                         boost::log::filter                  fallback )
+          : m_table{ std::move( table ) },
+            m_sink{ sink },
+            m_fallback{ std::move( fallback ) },
+            m_scope_name{ "Scope" },
+            m_severity_name{ "Severity" }
+        {
+        }
+
+        bool operator()( const boost::log::attribute_value_set& values ) const
+        {
+            auto scope_it    = values.find( m_scope_name );
+            auto severity_it = values.find( m_severity_name );
+            if( scope_it != values.end() && severity_it != values.end() )
+            {
+                auto scope    = scope_it->second.extract<std::string>();
+                auto severity = severity_it->second.extract<severity_level>();
+                if( scope && severity && static_cast<size_t>( severity.get() ) < SEVERITY_LEVELS )
+                {
+                    return m_table->accepts( m_sink, scope.get(), severity.get() );
+                }
+            }
+            return m_fallback( values );
+        }
+
+    private:
+
+        std::shared_ptr<const Filter_Table> m_table;
+
+        size_t m_sink;
+
+        boost::log::filter m_fallback;
+
+        boost::log::attribute_name m_scope_name;
+
+        boost::log::attribute_name m_severity_name;
+
+}; // End of Compiled_Filter class
+
+namespace detail {
+
+/**
+ * Recursive descent parser for the subset of Boost.Log's filter syntax that only tests
+ * "Scope" and "Severity".  Every method returns nothing for anything outside that subset.
+*/
+class Parser
+{
+    public:
+
+        explicit Parser( std::string_view text ) : m_text{ text } {}
+
+        std::optional<Expression> parse()
+        {
+            auto expression = parse_chain();
+            skip_space();
+            if( !expression || m_pos != m_text.size() )
+            {
+                return std::nullopt;
+            }
+            return expression;
+        }
+
+    private:
+
+        /**
+         * Like Boost.Log, "and" and "or" have the same precedence and group from the left.
+        */
+        std::optional<Expression> parse_chain()
+        {
+            auto lhs = parse_unary();
+            while( lhs )
+            {
+                Expression::Kind kind;
+                if( accept_word( "and" ) || accept( "&" ) )
+                {
+                    kind = Expression::Kind::AND;
+                }
+                else if( accept_word( "or" ) || accept( "|" ) )
+                {
+                    kind = Expression::Kind::OR;
+                }
+                else
+                {
+                    break;
+                }
+                auto rhs = parse_unary();
+                if( !rhs )
+                {
+                    return std::nullopt;
+                }
+                lhs = combine( kind, std::move( *lhs ), std::move( *rhs ) );
+            }
+            return lhs;
+        }
+
+        std::optional<Expression> parse_unary()
+        {
+            if( accept_word( "not" ) || accept( "!" ) )
+            {
+                auto operand = parse_unary();
+                if( !operand )
+                {
+                    return std::nullopt;
+                }
+                Expression expression;
+                expression.kind = Expression::Kind::NOT;
+                expression.children.push_back( std::move( *operand ) );
+                return expression;
+            }
+            if( accept( "(" ) )
+            {
+                auto expression = parse_chain();
+                if( !expression || !accept( ")" ) )
+                {
+                    return std::nullopt;
+                }
+                return expression;
+            }
+            return parse_relation();
+        }
+
+        std::optional<Expression> parse_relation()
+        {
+            skip_space();
+            if( !accept( "%" ) )
+            {
+                return std::nullopt;
+            }
+            auto close = m_text.find( '%', m_pos );
+            if( close == std::string_view::npos )
+            {
+                return std::nullopt;
+            }
+            auto name = m_text.substr( m_pos, close - m_pos );
+            m_pos = close + 1;
+            if( name != "Scope" && name != "Severity" )
+            {
+                return std::nullopt;
+            }
+
+            Expression expression;
+            auto relation = parse_relation_operator();
+            if( !relation )
+            {
+                // A bare attribute tests for its presence
+                return expression;
+            }
+            expression.relation = *relation;
+
+            auto operand = parse_operand();
+            if( !operand )
+            {
+                return std::nullopt;
+            }
+
+            if( name == "Scope" )
+            {
+                expression.kind    = Expression::Kind::SCOPE;
+                expression.operand = std::move( *operand );
+                return expression;
+            }
+
+            expression.kind = Expression::Kind::SEVERITY;
+            if( expression.relation > Expression::Relation::GREATER_EQUAL ||
+                !boost::log::trivial::from_string( operand->data(), operand->size(), expression.level ) )
+            {
+                return std::nullopt;
+            }
+            return expression;
+        }
+
+        std::optional<Expression::Relation> parse_relation_operator()
+        {
+            using Relation = Expression::Relation;
+            skip_space();
+            if( accept( "!=" ) ) return Relation::NOT_EQUAL;
+            if( accept( "<=" ) ) return Relation::LESS_EQUAL;
+            if( accept( ">=" ) ) return Relation::GREATER_EQUAL;
+            if( accept( "=" ) )  return Relation::EQUAL;
+            if( accept( "<" ) )  return Relation::LESS;
+            if( accept( ">" ) )  return Relation::GREATER;
+            if( accept_word( "contains" ) )    return Relation::CONTAINS;
+            if( accept_word( "begins_with" ) ) return Relation::BEGINS_WITH;
+            if( accept_word( "ends_with" ) )   return Relation::ENDS_WITH;
+            return std::nullopt;
+        }
+
+        /**
+         * Parses a quoted string, with `\"` and `\\` escapes, or a bare word.
+        */
+        std::optional<std::string> parse_operand()
+        {
+            skip_space();
+            std::string operand;
+            if( accept( "\"" ) )
+            {
+                while( m_pos < m_text.size() && m_text[m_pos] != '"' )
+                {
+                    char c = m_text[m_pos++];
+                    if( c == '\\' )
+                    {
+                        if( m_pos == m_text.size() || ( m_text[m_pos] != '"' && m_text[m_pos] != '\\' ) )
+                        {
+                            return std::nullopt;
+                        }
+                        c = m_text[m_pos++];
+                    }
+                    operand.push_back( c );
+                }
+                if( !accept( "\"" ) )
+                {
+                    return std::nullopt;
+                }
+                return operand;
+            }
+            while( m_pos < m_text.size() && is_word_char( m_text[m_pos] ) )
+            {
+                operand.push_back( m_text[m_pos++] );
+            }
+            if( operand.empty() )
+            {
+                return std::nullopt;
+            }
+            return operand;
+        }
+
+        static Expression combine( Expression::Kind kind,
+                                   Expression       lhs,
+                                   Expression       rhs )
+        {
+            Expression expression;
+            expression.kind = kind;
+            expression.children.push_back( std::move( lhs ) );
+            expression.children.push_back( std::move( rhs ) );
+            return expression;
+        }
+
+        static bool is_word_char( char c )
+        {
+            return std::isalnum( static_cast<unsigned char>( c ) ) || c == '_' || c == '.' || c == '-';
+        }
+
+        void skip_space()
+        {
+            while( m_pos < m_text.size() && std::isspace( static_cast<unsigned char>( m_text[m_pos] ) ) )
+            {
+                ++m_pos;
+            }
+        }
+
+        bool accept( std::string_view token )
+        {
+            skip_space();
+            if( m_text.substr( m_pos ).starts_with( token ) )
+            {
+                m_pos += token.size();
+                return true;
+            }
+            return false;
+        }
+
+        /**
+         * Accepts a keyword that is not the prefix of a longer word.
+        */
+        bool accept_word( std::string_view word )
+        {
+            skip_space();
+            if( m_text.substr( m_pos ).starts_with( word ) &&
+                ( m_pos + word.size() == m_text.size() || !is_word_char( m_text[m_pos + word.size()] ) ) )
+            {
+                m_pos += word.size();
+                return true;
+            }
+            return false;
+        }
+
+        std::string_view m_text;
+
+        size_t m_pos{ 0 };
+
+}; // End of Parser class
+
+} // End of detail namespace
+
+/**
+ * Returns the severity levels a filter may accept for some scope.  Filters that are not
+ * compiled may accept every level.
+*/
+inline Severity_Mask severity_mask( const std::string& text )
+{
+    auto expression = detail::Parser{ text }.parse();
+    if( !expression )
+    {
+        return ALL_SEVERITIES;
+    }
+    Severity_Mask levels = 0;
+    for( size_t level = 0; level < SEVERITY_LEVELS; ++level )
+    {
+        if( expression->evaluate( static_cast<severity_level>( level ) ) != false )
+        {
+            levels |= static_cast<Severity_Mask>( 1u << level );
+        }
+    }
+    return levels;
+}
+
+/**
+ * Compiles the "Filter" setting of a sink.
+ *
+ * Filters that only combine ("and", "or", "not", parentheses) relations on "Scope"
+ * (`= != < > <= >= contains begins_with ends_with`) and "Severity" (`= != < > <= >=`
+ * against a level name) are added to the current `Filter_Table`, so each record costs a
+ * lookup of its scope, shared by consecutive sinks, and a bit test.  Any other filter,
+ * or one that does not fit in the table, is the filter Boost.Log parses from the string.
+ *
+ * Syntax errors throw the same exceptions as `boost::log::parse_filter()`.
+*/
+inline boost::log::filter compile_filter( const std::string& text )
+{
+    auto fallback = boost::log::parse_filter( text );
+
+    auto expression = detail::Parser{ text }.parse();
+    if( !expression )
+    {
+        return fallback;
+    }
+
+    auto table = current_table();
+    auto sink  = table->add_sink( std::move( *expression ) );
+    if( !sink )
+    {
+        return fallback;
+    }
+    return Compiled_Filter{ std::move( table ), *sink, std::move( fallback ) };
+}
+
+} // End of tmns::log::impl::filter namespace
@@ -23,15 +23,20 @@
 #include <boost/date_time/posix_time/ptime.hpp>
 #include <boost/format.hpp>
 #include <boost/json.hpp>
+#include <boost/log/attributes/value_visitation.hpp>
 #include <boost/log/expressions.hpp>
 #include <boost/log/support/date_time.hpp>
 #include <boost/log/utility/setup/formatter_parser.hpp>
+#include <boost/mpl/vector.hpp>
 #include <boost/phoenix/bind.hpp>
 #include <boost/shared_ptr.hpp>
 
 // C++ Libraries
+#include <array>
+#include <cstdint>
 #include <iomanip>
 #include <string>
+#include <string_view>
 
 namespace tmns::log::impl::format {
 
@@ -129,10 +134,39 @@ class Time_Stamp_Formatter_Factory
 
 }; // End of Time_Stamp_Formatter_Factory class
 
+/**
+ * Attribute value types the JSON formatter writes as native JSON values.  These are the
+ * types `kv()` stores fields as.
+*/
+using Json_Field_Types = boost::mpl::vector<bool,int64_t,uint64_t,double,std::string>;
+
+/**
+ * Attributes the JSON formatter writes explicitly.  Every other attribute with one of
+ * the `Json_Field_Types` is written as a field.
+*/
+inline bool is_core_attribute( std::string_view name )
+{
+    static constexpr std::array<std::string_view,11> CORE_ATTRIBUTES { "RecordID", "Severity", "Message",
+                                                                       "TimeStamp", "Scope", "ProcessName",
+                                                                       "ProcessID", "ThreadID", "File",
+                                                                       "Line", "Function" };
+    for( const auto& core : CORE_ATTRIBUTES )
+    {
+        if( name == core )
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 /**
  * Formats a Boost.Log record as JSON.  This function is hard-coded to extract only
  * certain attributes from the log record.  See the documentation of Boost.Log support
  * in this library for a complete list of attributes which are supported.
+ *
+ * Any other attribute holding a boolean, 64-bit integer, double, or string, such as the
+ * fields created with `kv()`, is written under its own name as a native JSON value.
 */
 inline void json( boost::log::record_view const&  rec,
                   boost::log::formatting_ostream& stream )
@@ -206,6 +240,19 @@ inline void json( boost::log::record_view const&  rec,
         json["Function"] = val.get();
     }
 
+    // Fields
+    for( const auto& [name, value] : rec.attribute_values() )
+    {
+        if( is_core_attribute( name.string() ) )
+        {
+            continue;
+        }
+        bl::visit<Json_Field_Types>( value, [&json, &name]( const auto& field )
+        {
+            json[name.string()] = field;
+        });
+    }
+
     stream << json;
 }
 
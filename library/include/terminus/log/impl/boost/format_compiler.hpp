@@ -0,0 +1,648 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    format_compiler.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+/**
+ * Compiles Boost.Log format strings, such as the "Format" setting of the text sinks,
+ * into a flat list of segments that is evaluated without Boost.Log's expression
+ * templates for the attributes this library creates.
+*/
+
+// Boost Libraries
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/log/attributes/attribute_name.hpp>
+#include <boost/log/attributes/value_extraction.hpp>
+#include <boost/log/core/record_view.hpp>
+#include <boost/log/expressions/formatter.hpp>
+#include <boost/log/trivial.hpp>
+#include <boost/log/utility/formatting_ostream.hpp>
+#include <boost/log/utility/setup/formatter_parser.hpp>
+
+// C++ Libraries
+#include <array>
+#include <cctype>
+#include <charconv>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace tmns::log::impl::format {
+
+/**
+ * Literal text between two placeholders.
+*/
+struct Literal_Segment
+{
+    std::string text;
+}; // End of Literal_Segment struct
+
+/**
+ * Placeholder of an attribute holding a `std::string`, such as "Message" or "Scope".
+*/
+struct String_Segment
+{
+    boost::log::attribute_name name;
+}; // End of String_Segment struct
+
+/**
+ * Placeholder of an attribute holding an integer, such as "Line" or "RecordID".
+*/
+template <typename IntegerT>
+struct Integer_Segment
+{
+    boost::log::attribute_name name;
+}; // End of Integer_Segment struct
+
+/**
+ * "Severity" placeholder.  The text of every level is rendered with the `align` and
+ * `brackets` arguments when the format is compiled.
+*/
+struct Severity_Segment
+{
+    boost::log::attribute_name name;
+
+    std::array<std::string,static_cast<size_t>( boost::log::trivial::fatal ) + 1> text;
+}; // End of Severity_Segment struct
+
+/**
+ * "TimeStamp" placeholder.  The `format` argument is split into literal text and the
+ * conversion characters of the supported specifiers (`%Y %m %d %H %M %S %f`).
+*/
+struct Time_Stamp_Segment
+{
+    struct Token
+    {
+        /// Conversion character, or 0 for literal text
+        char        code;
+        std::string text;
+    }; // End of Token struct
+
+    boost::log::attribute_name name;
+
+    std::vector<Token> tokens;
+}; // End of Time_Stamp_Segment struct
+
+/**
+ * Placeholder formatted by the formatter Boost.Log creates for it, used for attributes
+ * without a dedicated segment.
+*/
+struct Boost_Segment
+{
+    boost::log::formatter formatter;
+}; // End of Boost_Segment struct
+
+/**
+ * Formatter produced by `compile_formatter()`.  Writing a record walks the segments in
+ * order.  Attributes are looked up with names resolved at compile time, and a typed
+ * segment whose attribute holds an unexpected type (or a special time value) defers to
+ * the formatter Boost.Log creates for the same placeholder, so the output always matches
+ * `boost::log::parse_formatter()`.
+*/
+class Compiled_Formatter
+{
+    public:
+
+        using Segment = std::variant<Literal_Segment,
+                                     String_Segment,
+                                     Integer_Segment<int64_t>,
+                                     Integer_Segment<uint64_t>,
+                                     Severity_Segment,
+                                     Time_Stamp_Segment,
+                                     Boost_Segment>;
+
+        /**
+         * A segment, with the formatter Boost.Log creates for its placeholder when it has one.
+        */
+        struct Entry
+        {
+            Segment               segment;
+            boost::log::formatter fallback;
+        }; // End of Entry struct
+
+        explicit Compiled_Formatter( std::vector<Entry> entries )
+          : m_entries{ std::move( entries ) }
+        {
+        }
+
+        void operator()( const boost::log::record_view&  rec,
+                         boost::log::formatting_ostream& stream ) const
+        {
+            for( const auto& entry : m_entries )
+            {
+                if( !std::visit( [&]( const auto& segment ){ return write( segment, rec, stream ); },
+                                 entry.segment ) )
+                {
+                    entry.fallback( rec, stream );
+                }
+            }
+        }
+
+    private:
+
+        /// Each `write` returns false when the fallback must format the placeholder instead
+
+        static bool write( const Literal_Segment&          segment,
+                           const boost::log::record_view&  /*rec*/,
+                           boost::log::formatting_ostream& stream )
+        {
+            put( stream, segment.text );
+            return true;
+        }
+
+        static bool write( const String_Segment&           segment,
+                           const boost::log::record_view&  rec,
+                           boost::log::formatting_ostream& stream )
+        {
+            auto it = rec.attribute_values().find( segment.name );
+            if( it == rec.attribute_values().end() )
+            {
+                return true;
+            }
+            if( auto value = it->second.extract<std::string>() )
+            {
+                const auto& text = value.get();
+                put( stream, text );
+                return true;
+            }
+            return false;
+        }
+
+        template <typename IntegerT>
+        static bool write( const Integer_Segment<IntegerT>& segment,
+                           const boost::log::record_view&   rec,
+                           boost::log::formatting_ostream&  stream )
+        {
+            auto it = rec.attribute_values().find( segment.name );
+            if( it == rec.attribute_values().end() )
+            {
+                return true;
+            }
+            if( auto value = it->second.template extract<IntegerT>() )
+            {
+                std::array<char,24> buffer;
+                auto result = std::to_chars( buffer.data(), buffer.data() + buffer.size(), value.get() );
+                put( stream, std::string_view( buffer.data(), static_cast<size_t>( result.ptr - buffer.data() ) ) );
+                return true;
+            }
+            return false;
+        }
+
+        static bool write( const Severity_Segment&         segment,
+                           const boost::log::record_view&  rec,
+                           boost::log::formatting_ostream& stream )
+        {
+            auto it = rec.attribute_values().find( segment.name );
+            if( it == rec.attribute_values().end() )
+            {
+                return true;
+            }
+            auto value = it->second.extract<boost::log::trivial::severity_level>();
+            if( !value || static_cast<size_t>( value.get() ) >= segment.text.size() )
+            {
+                return false;
+            }
+            const auto& text = segment.text[static_cast<size_t>( value.get() )];
+            put( stream, text );
+            return true;
+        }
+
+        static bool write( const Time_Stamp_Segment&       segment,
+                           const boost::log::record_view&  rec,
+                           boost::log::formatting_ostream& stream )
+        {
+            auto it = rec.attribute_values().find( segment.name );
+            if( it == rec.attribute_values().end() )
+            {
+                return true;
+            }
+            auto value = it->second.extract<boost::posix_time::ptime>();
+            if( !value || value.get().is_special() )
+            {
+                return false;
+            }
+
+            const auto& time = value.get();
+            const auto  date = time.date().year_month_day();
+            const auto  tod  = time.time_of_day();
+
+            // Fractional seconds are always written as microseconds, like Boost.Log does
+            constexpr int64_t MICROSECONDS = 1000000;
+            const int64_t ticks = boost::posix_time::time_duration::ticks_per_second();
+            int64_t fraction = tod.fractional_seconds();
+            fraction = ticks > MICROSECONDS ? fraction / ( ticks / MICROSECONDS )
+                                            : fraction * ( MICROSECONDS / ticks );
+
+            for( const auto& token : segment.tokens )
+            {
+                switch( token.code )
+                {
+                    case 'Y': write_digits( stream, static_cast<uint32_t>( date.year ), 4 ); break;
+                    case 'm': write_digits( stream, date.month.as_number(), 2 ); break;
+                    case 'd': write_digits( stream, date.day.as_number(), 2 ); break;
+                    case 'H': write_digits( stream, static_cast<uint32_t>( tod.hours() ), 2 ); break;
+                    case 'M': write_digits( stream, static_cast<uint32_t>( tod.minutes() ), 2 ); break;
+                    case 'S': write_digits( stream, static_cast<uint32_t>( tod.seconds() ), 2 ); break;
+                    case 'f': write_digits( stream, static_cast<uint32_t>( fraction ), 6 ); break;
+                    default:
+                        put( stream, token.text );
+                        break;
+                }
+            }
+            return true;
+        }
+
+        static bool write( const Boost_Segment&            segment,
+                           const boost::log::record_view&  rec,
+                           boost::log::formatting_ostream& stream )
+        {
+            segment.formatter( rec, stream );
+            return true;
+        }
+
+        /**
+         * Appends the text to the stream's buffer, skipping the sentry and padding of
+         * `std::ostream::write`.
+        */
+        static void put( boost::log::formatting_ostream& stream,
+                         std::string_view                text )
+        {
+            stream.rdbuf()->sputn( text.data(), static_cast<std::streamsize>( text.size() ) );
+        }
+
+        /**
+         * Writes the value zero-padded to at least `width` digits.
+        */
+        static void write_digits( boost::log::formatting_ostream& stream,
+                                  uint32_t                        value,
+                                  int                             width )
+        {
+            std::array<char,10> buffer;
+            int pos = static_cast<int>( buffer.size() );
+            do
+            {
+                buffer[--pos] = static_cast<char>( '0' + value % 10 );
+                value /= 10;
+            } while( value != 0 );
+            while( static_cast<int>( buffer.size() ) - pos < width )
+            {
+                buffer[--pos] = '0';
+            }
+            put( stream, std::string_view( buffer.data() + pos, buffer.size() - static_cast<size_t>( pos ) ) );
+        }
+
+        std::vector<Entry> m_entries;
+
+}; // End of Compiled_Formatter class
+
+namespace detail {
+
+/**
+ * A placeholder of a format string, e.g. `%Severity(align=true,brackets=true)%`.
+*/
+struct Placeholder
+{
+    /// The placeholder as written, including the enclosing '%'
+    std::string_view                                   raw;
+    std::string_view                                   name;
+    std::vector<std::pair<std::string,std::string>>    args;
+}; // End of Placeholder struct
+
+inline std::string_view trim( std::string_view text )
+{
+    while( !text.empty() && ( text.front() == ' ' || text.front() == '\t' ) )
+    {
+        text.remove_prefix( 1 );
+    }
+    while( !text.empty() && ( text.back() == ' ' || text.back() == '\t' ) )
+    {
+        text.remove_suffix( 1 );
+    }
+    return text;
+}
+
+/**
+ * Parses the comma separated `name=value` arguments of a placeholder.  Values may be
+ * enclosed in double quotes.  Returns nothing for syntax the compiler leaves to Boost.Log,
+ * such as escaped characters.
+*/
+inline std::optional<std::vector<std::pair<std::string,std::string>>> parse_args( std::string_view text )
+{
+    std::vector<std::pair<std::string,std::string>> args;
+    size_t pos = 0;
+    while( pos < text.size() )
+    {
+        auto eq = text.find( '=', pos );
+        if( eq == std::string_view::npos )
+        {
+            return std::nullopt;
+        }
+        auto name = trim( text.substr( pos, eq - pos ) );
+        pos = eq + 1;
+        while( pos < text.size() && ( text[pos] == ' ' || text[pos] == '\t' ) )
+        {
+            ++pos;
+        }
+
+        std::string_view value;
+        if( pos < text.size() && text[pos] == '"' )
+        {
+            auto close = text.find( '"', pos + 1 );
+            if( close == std::string_view::npos )
+            {
+                return std::nullopt;
+            }
+            value = text.substr( pos + 1, close - pos - 1 );
+            pos = close + 1;
+            while( pos < text.size() && ( text[pos] == ' ' || text[pos] == '\t' ) )
+            {
+                ++pos;
+            }
+            if( pos < text.size() && text[pos] != ',' )
+            {
+                return std::nullopt;
+            }
+        }
+        else
+        {
+            auto comma = text.find( ',', pos );
+            value = trim( text.substr( pos, comma == std::string_view::npos ? std::string_view::npos : comma - pos ) );
+            pos = comma == std::string_view::npos ? text.size() : comma;
+        }
+        if( name.empty() )
+        {
+            return std::nullopt;
+        }
+        args.emplace_back( std::string{ name }, std::string{ value } );
+        if( pos < text.size() )
+        {
+            ++pos; // Skip the comma
+        }
+    }
+    return args;
+}
+
+/**
+ * Splits a format string into literal text and placeholders.  Returns nothing when the
+ * string uses syntax the compiler leaves to Boost.Log, such as escaped characters.
+*/
+inline std::optional<std::vector<std::variant<std::string,Placeholder>>> tokenize( std::string_view pattern )
+{
+    std::vector<std::variant<std::string,Placeholder>> tokens;
+    std::string literal;
+    size_t pos = 0;
+    while( pos < pattern.size() )
+    {
+        char c = pattern[pos];
+        if( c == '\\' )
+        {
+            return std::nullopt;
+        }
+        if( c != '%' )
+        {
+            literal.push_back( c );
+            ++pos;
+            continue;
+        }
+
+        // Attribute name, then optional arguments, then the closing '%'
+        size_t start = pos++;
+        size_t name_start = pos;
+        while( pos < pattern.size() && pattern[pos] != '%' && pattern[pos] != '(' )
+        {
+            char n = pattern[pos];
+            if( !( std::isalnum( static_cast<unsigned char>( n ) ) || n == '_' || n == '.' || n == '-' ) )
+            {
+                return std::nullopt;
+            }
+            ++pos;
+        }
+        Placeholder placeholder;
+        placeholder.name = pattern.substr( name_start, pos - name_start );
+        if( placeholder.name.empty() || pos == pattern.size() )
+        {
+            return std::nullopt;
+        }
+        if( pattern[pos] == '(' )
+        {
+            size_t close = pos + 1;
+            bool quoted = false;
+            while( close < pattern.size() && ( quoted || pattern[close] != ')' ) )
+            {
+                if( pattern[close] == '"' )
+                {
+                    quoted = !quoted;
+                }
+                ++close;
+            }
+            if( close + 1 >= pattern.size() || pattern[close + 1] != '%' )
+            {
+                return std::nullopt;
+            }
+            auto args = parse_args( pattern.substr( pos + 1, close - pos - 1 ) );
+            if( !args )
+            {
+                return std::nullopt;
+            }
+            placeholder.args = std::move( *args );
+            pos = close + 1;
+        }
+        ++pos; // Closing '%'
+        placeholder.raw = pattern.substr( start, pos - start );
+
+        if( !literal.empty() )
+        {
+            tokens.emplace_back( std::move( literal ) );
+            literal.clear();
+        }
+        tokens.emplace_back( std::move( placeholder ) );
+    }
+    if( !literal.empty() )
+    {
+        tokens.emplace_back( std::move( literal ) );
+    }
+    return tokens;
+}
+
+inline const std::string* find_arg( const Placeholder& placeholder,
+                                    std::string_view   name )
+{
+    for( const auto& [key, value] : placeholder.args )
+    {
+        if( key == name )
+        {
+            return &value;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * Renders the text of every severity level the way `Severity_Formatter` does.
+*/
+inline Severity_Segment compile_severity( const Placeholder& placeholder )
+{
+    Severity_Segment segment{ boost::log::attribute_name{ std::string{ placeholder.name } }, {} };
+    const bool align    = find_arg( placeholder, "align" ) != nullptr;
+    const bool brackets = find_arg( placeholder, "brackets" ) != nullptr;
+    for( size_t level = 0; level < segment.text.size(); ++level )
+    {
+        std::string text = boost::log::trivial::to_string( static_cast<boost::log::trivial::severity_level>( level ) );
+        if( brackets )
+        {
+            text = "[" + text + "]";
+        }
+        if( align && text.size() < 9 )
+        {
+            text.append( 9 - text.size(), ' ' );
+        }
+        segment.text[level] = std::move( text );
+    }
+    return segment;
+}
+
+/**
+ * Splits the `format` argument of a "TimeStamp" placeholder.  Returns nothing when the
+ * format uses a specifier without a direct implementation.
+*/
+inline std::optional<Time_Stamp_Segment> compile_time_stamp( const Placeholder& placeholder )
+{
+    Time_Stamp_Segment segment{ boost::log::attribute_name{ std::string{ placeholder.name } }, {} };
+    const std::string* arg = find_arg( placeholder, "format" );
+    std::string_view format = arg ? std::string_view{ *arg } : std::string_view{ "%Y-%m-%d %H:%M:%S.%f" };
+
+    std::string literal;
+    for( size_t pos = 0; pos < format.size(); ++pos )
+    {
+        if( format[pos] != '%' )
+        {
+            literal.push_back( format[pos] );
+            continue;
+        }
+        if( pos + 1 == format.size() )
+        {
+            return std::nullopt;
+        }
+        char code = format[++pos];
+        if( std::string_view{ "YmdHMSf" }.find( code ) == std::string_view::npos )
+        {
+            return std::nullopt;
+        }
+        if( !literal.empty() )
+        {
+            segment.tokens.push_back( { 0, std::move( literal ) } );
+            literal.clear();
+        }
+        segment.tokens.push_back( { code, {} } );
+    }
+    if( !literal.empty() )
+    {
+        segment.tokens.push_back( { 0, std::move( literal ) } );
+    }
+    return segment;
+}
+
+/**
+ * Returns the dedicated segment for an attribute this library creates, if there is one.
+*/
+inline std::optional<Compiled_Formatter::Segment> compile_placeholder( const Placeholder& placeholder )
+{
+    const auto& name = placeholder.name;
+    const boost::log::attribute_name attr_name{ std::string{ name } };
+
+    if( name == "Severity" )
+    {
+        return compile_severity( placeholder );
+    }
+    if( name == "TimeStamp" )
+    {
+        if( auto segment = compile_time_stamp( placeholder ) )
+        {
+            return std::move( *segment );
+        }
+        return std::nullopt;
+    }
+    if( !placeholder.args.empty() )
+    {
+        return std::nullopt;
+    }
+    if( name == "Message" || name == "Scope" || name == "File" || name == "Function" || name == "ProcessName" )
+    {
+        return String_Segment{ attr_name };
+    }
+    if( name == "Line" )
+    {
+        return Integer_Segment<int64_t>{ attr_name };
+    }
+    if( name == "RecordID" )
+    {
+        return Integer_Segment<uint64_t>{ attr_name };
+    }
+    return std::nullopt;
+}
+
+} // End of detail namespace
+
+/**
+ * Compiles a Boost.Log format string into a `Compiled_Formatter`.
+ *
+ * Literal text is copied once, and the placeholders of the attributes this library
+ * creates ("Message", "Severity", "TimeStamp", "Scope", "File", "Line", "Function",
+ * "ProcessName", and "RecordID") become segments that read the attribute directly,
+ * including the `align`/`brackets` arguments of "Severity" and the `format` argument of
+ * "TimeStamp".  Every other placeholder, such as a `kv()` field, is formatted by the
+ * formatter Boost.Log creates for it, so registered formatter factories still apply.
+ *
+ * A string using syntax the compiler does not understand, such as escaped characters,
+ * is handed to `boost::log::parse_formatter()` as a whole.
+ *
+ * The formatter factories from `format::configure()` must be registered first.
+*/
+inline boost::log::formatter compile_formatter( const std::string& pattern )
+{
+    auto tokens = detail::tokenize( pattern );
+    if( !tokens )
+    {
+        return boost::log::parse_formatter( pattern );
+    }
+
+    std::vector<Compiled_Formatter::Entry> entries;
+    entries.reserve( tokens->size() );
+    for( auto& token : *tokens )
+    {
+        if( auto* literal = std::get_if<std::string>( &token ) )
+        {
+            entries.push_back( { Literal_Segment{ std::move( *literal ) }, {} } );
+            continue;
+        }
+
+        const auto& placeholder = std::get<detail::Placeholder>( token );
+        auto fallback = boost::log::parse_formatter( std::string{ placeholder.raw } );
+        if( auto segment = detail::compile_placeholder( placeholder ) )
+        {
+            entries.push_back( { std::move( *segment ), std::move( fallback ) } );
+        }
+        else
+        {
+            entries.push_back( { Boost_Segment{ std::move( fallback ) }, {} } );
+        }
+    }
+    return Compiled_Formatter{ std::move( entries ) };
+}
+
+} // End of tmns::log::impl::format namespace
@@ -0,0 +1,226 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    indexed_file_backend.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Project Libraries
+#include <terminus/log/impl/file_index.hpp>
+#include <terminus/log/impl/stats.hpp>
+
+// Boost Libraries
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/log/attributes/value_extraction.hpp>
+#include <boost/log/core/record_view.hpp>
+
+// C++ Libraries
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace tmns::log::impl::sinks {
+
+/**
+ * File sink backend that writes a sidecar index next to each file it writes, for the
+ * "TextFile" and "JsonFile" sinks with `Index=true`.  `BackendT` is
+ * `boost::log::sinks::text_file_backend`, or a type derived from it.
+ *
+ * Records are grouped into blocks by time bucket, and the index maps each block to its
+ * byte offset and its range of "TimeStamp" and "RecordID" values; see
+ * `index::Index_Builder`.  The stream position is read once per block rather than per
+ * record.  The index of a file is written to "<file>.idx" when the file is closed or
+ * rotated, and on every flush, so `index::read_window()` can seek to a time window in
+ * both archived and active files.
+*/
+template <typename BackendT>
+class Indexed_File_Backend : public BackendT
+{
+    public:
+
+        using string_type = typename BackendT::string_type;
+
+        /**
+         * @param interval Microseconds of records per index block.
+         * @param counters Counters whose rotations the close handler reports.
+        */
+        template <typename... ArgsT>
+        Indexed_File_Backend( int64_t                               interval,
+                              std::shared_ptr<stats::Sink_Counters> counters,
+                              ArgsT&&...                            args )
+          : BackendT( std::forward<ArgsT>( args )... ),
+            m_builder{ interval },
+            m_counters{ std::move( counters ) }
+        {
+        }
+
+        ~Indexed_File_Backend()
+        {
+            // The base class closes the file after this object is gone.  That final close
+            // is not a rotation.
+            if( m_stream != nullptr )
+            {
+                write_index();
+            }
+            this->set_open_handler( {} );
+            this->set_close_handler( {} );
+        }
+
+        /**
+         * Installs the file open and close handlers.  Call after the file settings are
+         * applied, since the handlers replace the one counting rotations.
+        */
+        void enable_index()
+        {
+            this->set_open_handler( [this]( std::ostream& stream ){ on_open( stream ); } );
+            this->set_close_handler( [this]( std::ostream& stream ){ on_close( stream ); } );
+        }
+
+        void consume( const boost::log::record_view& rec,
+                      const string_type&             formatted_message )
+        {
+            const int64_t time = record_time( rec );
+            uint64_t id = m_last_id;
+            if( const auto value = boost::log::extract<uint64_t>( "RecordID", rec ) )
+            {
+                id = value.get();
+            }
+            m_last_time = time;
+            m_last_id   = id;
+
+            // Rotation inside the base consume reopens the file and starts a new block
+            bool new_block = m_builder.starts_block( time );
+            uint64_t offset = new_block ? position() : 0;
+            m_opened = false;
+
+            BackendT::consume( rec, formatted_message );
+
+            if( m_opened )
+            {
+                new_block = true;
+                offset    = m_open_offset;
+            }
+            if( new_block )
+            {
+                m_builder.begin_block( offset );
+            }
+            m_builder.add( time, id );
+        }
+
+        void flush()
+        {
+            BackendT::flush();
+            if( m_stream != nullptr )
+            {
+                write_index();
+            }
+        }
+
+    private:
+
+        /**
+         * Returns the record's "TimeStamp" in microseconds since the UNIX epoch, or the
+         * time of the previous record if it has none.
+        */
+        int64_t record_time( const boost::log::record_view& rec ) const
+        {
+            if( const auto value = boost::log::extract<boost::posix_time::ptime>( "TimeStamp", rec ) )
+            {
+                static const boost::posix_time::ptime s_epoch{ boost::gregorian::date( 1970, 1, 1 ) };
+                return ( value.get() - s_epoch ).total_microseconds();
+            }
+            return m_last_time;
+        }
+
+        uint64_t position() const
+        {
+            if( m_stream == nullptr )
+            {
+                return 0;
+            }
+            auto pos = m_stream->tellp();
+            return pos < 0 ? 0 : static_cast<uint64_t>( pos );
+        }
+
+        /**
+         * Starts the index of a newly opened file, continuing its existing index when the
+         * file is appended to.
+        */
+        void on_open( std::ostream& stream )
+        {
+            m_stream      = &stream;
+            m_file_name   = this->get_current_file_name().string();
+            m_open_offset = position();
+            m_opened      = true;
+
+            std::vector<index::Index_Entry> entries;
+            if( m_open_offset > 0 )
+            {
+                if( auto existing = index::File_Index::load( index::index_file_name( m_file_name ) ) )
+                {
+                    for( const auto& entry : existing->entries() )
+                    {
+                        if( entry.offset < m_open_offset )
+                        {
+                            entries.push_back( entry );
+                        }
+                    }
+                }
+            }
+            m_builder.reset( std::move( entries ) );
+        }
+
+        /**
+         * Writes the index of the closed file.  Only rotations get here, since the
+         * destructor removes this handler before the base class closes the file.
+        */
+        void on_close( std::ostream& /*stream*/ )
+        {
+            m_counters->rotations.fetch_add( 1, std::memory_order_relaxed );
+            write_index();
+            m_stream = nullptr;
+        }
+
+        void write_index()
+        {
+            if( m_stream != nullptr && !m_file_name.empty() )
+            {
+                m_stream->flush();
+                index::write_index( index::index_file_name( m_file_name ), position(), m_builder.entries() );
+            }
+        }
+
+        index::Index_Builder m_builder;
+
+        std::shared_ptr<stats::Sink_Counters> m_counters;
+
+        /// Stream of the open file, owned by the base backend
+        std::ostream* m_stream{ nullptr };
+
+        std::string m_file_name;
+
+        /// Offset of the file when it was opened, non-zero when appending
+        uint64_t m_open_offset{ 0 };
+
+        /// Set by the open handler during a `consume` that opened a file
+        bool m_opened{ false };
+
+        int64_t m_last_time{ 0 };
+
+        uint64_t m_last_id{ 0 };
+
+}; // End of Indexed_File_Backend class
+
+} // End of tmns::log::impl::sinks namespace
@@ -0,0 +1,144 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    log_writer.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+#if defined(__unix__) || defined(__APPLE__)
+
+// Project Libraries
+#include <terminus/log/impl/boost/record_codec.hpp>
+#include <terminus/log/impl/shared_ring.hpp>
+
+// Boost Libraries
+#include <boost/log/attributes/attribute_set.hpp>
+#include <boost/log/attributes/attribute_value_impl.hpp>
+#include <boost/log/attributes/constant.hpp>
+#include <boost/log/core/core.hpp>
+#include <boost/log/trivial.hpp>
+
+// C++ Libraries
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace tmns::log::impl::ipc {
+
+/**
+ * Reads the records producers wrote to a `Shared_Ring` through "SharedMemory" sinks and
+ * pushes them into this process's Boost.Log core, whose sinks format and write them.
+ * This is the loop of `terminus_log_writerd`.
+ *
+ * Replayed records keep the attribute values of the producing process, such as its
+ * `TimeStamp`, `ProcessID`, and `Scope`, and pass through the core filter and sink
+ * filters of this process.  The sinks of this process must not write to the same ring.
+*/
+class Log_Writer
+{
+    public:
+
+        explicit Log_Writer( std::shared_ptr<Shared_Ring> ring )
+          : m_ring{ std::move( ring ) }
+        {
+        }
+
+        /**
+         * Replays up to `max_records` records from the ring, preceded by a warning record if
+         * producers dropped records since the last call.  Returns the number of records read.
+        */
+        size_t drain( size_t max_records = std::numeric_limits<size_t>::max() )
+        {
+            report_drops();
+
+            size_t count = 0;
+            while( count < max_records &&
+                   m_ring->try_pop( [this]( std::string_view data ){ replay( data ); } ) )
+            {
+                ++count;
+            }
+            return count;
+        }
+
+        /**
+         * Number of records read from the ring that could not be decoded.
+        */
+        [[nodiscard]] uint64_t records_malformed() const
+        {
+            return m_malformed;
+        }
+
+    private:
+
+        void replay( std::string_view data )
+        {
+            boost::log::attribute_set attributes;
+            if( !decode_record( data, attributes ) )
+            {
+                ++m_malformed;
+                return;
+            }
+
+            auto core = boost::log::core::get();
+            if( auto rec = core->open_record( attributes ) )
+            {
+                core->push_record( std::move( rec ) );
+            }
+        }
+
+        /**
+         * Logs a warning with the number of records producers dropped because the ring was
+         * full or the records did not fit in a slot.
+        */
+        void report_drops()
+        {
+            const uint64_t dropped = m_ring->dropped();
+            if( dropped == m_reported_drops )
+            {
+                return;
+            }
+            const uint64_t count = dropped - m_reported_drops;
+            m_reported_drops = dropped;
+
+            namespace attrs = boost::log::attributes;
+            boost::log::attribute_set source_attributes;
+            source_attributes.insert( "Severity", attrs::constant<boost::log::trivial::severity_level>(
+                                                     boost::log::trivial::severity_level::warning ) );
+            source_attributes.insert( "Scope", attrs::constant<std::string>( "tmns::log" ) );
+
+            auto core = boost::log::core::get();
+            auto rec = core->open_record( source_attributes );
+            if( !rec )
+            {
+                return;
+            }
+            std::string message = std::to_string( count ) + " records dropped by producers of shared memory segment \"" +
+                                  m_ring->name() + "\" because the ring was full or the record exceeded the " +
+                                  "slot size";
+            rec.attribute_values().insert( "Message", attrs::make_attribute_value( std::move( message ) ) );
+            core->push_record( std::move( rec ) );
+        }
+
+        std::shared_ptr<Shared_Ring> m_ring;
+
+        /// Value of the ring's drop counter at the last report
+        uint64_t m_reported_drops{ 0 };
+
+        uint64_t m_malformed{ 0 };
+
+}; // End of Log_Writer class
+
+} // End of tmns::log::impl::ipc namespace
+
+#endif // defined(__unix__) || defined(__APPLE__)
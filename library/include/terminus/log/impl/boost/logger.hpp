@@ -16,38 +16,61 @@
 
 // Terminus Libraries
 #include <terminus/log/impl/location.hpp>
+#include <terminus/log/impl/boost/shared_source.hpp>
+#include <terminus/log/impl/boost/static_source.hpp>
 #include <terminus/log/impl/boost/utility.hpp>
 
 // Boost Libraries
 #include <boost/log/attributes/constant.hpp>
-#include <boost/log/sources/severity_logger.hpp>
 #include <boost/log/trivial.hpp>
 
 // C++ Libraries
 #include <string>
+#include <string_view>
 
 namespace tmns::log::impl {
 
 /**
- * Produces the log records using a single Boost.Log severity logger.  The severity
- * logger is not the multi-threaded version, so a single instance of this implementation
- * should not be used across multiple threads.  This follows the threading guaranteees by
- * the `tmns::log::Logger` class.
+ * Produces the log records using a single record source.  The source must provide
+ * `open_record` and `push_record` like a Boost.Log severity logger.  Constructing the
+ * logger from a scope name and `with()` additionally need the source to be constructible
+ * from the scope and to provide `add_attribute`.  See `Shared_Source` and `Static_Source`.
  *
  * Each log record produced by this backend implementation assigns it's scope to the "Scope"
  * attribute on a Boost.Log record.  This attribute can be used during filtering.
+ *
+ * Context fields added with `with()` are constant attributes of the source, so
+ * they are attached to every record without being passed on each call.
 */
-class Logger
+template <class SourceT>
+class Basic_Logger
 {
     public:
 
+        /**
+         * Creates a logger at the default scope of the source.
+        */
+        Basic_Logger() = default;
+
         /**
          * Creates a copy of the logger at the requested scope.
         */
-        Logger( std::string scope )
+        Basic_Logger( std::string_view scope ) : m_logger{ scope }
+        {
+        }
+
+        /**
+         * Creates a copy of the logger that also attaches the provided fields to every
+         * record.  Fields naming an attribute the logger already has are ignored.
+        */
+        template <class... ValuesT>
+        Basic_Logger with( const Field<ValuesT>&... fields ) const
         {
-            typedef boost::log::attributes::constant<std::string> attr_const;
-            m_logger.add_attribute( "Scope", attr_const( std::move( scope ) ) );
+            Basic_Logger child{ *this };
+            ( child.m_logger.add_attribute( std::string{ fields.name },
+                                            boost::log::attributes::constant<field_attribute_t<ValuesT>>(
+                                                field_attribute_t<ValuesT>( fields.value ) ) ), ... );
+            return child;
         }
 
         /**
@@ -197,8 +220,19 @@ class Logger
     private:
 
         // Internal logging instance
-        boost::log::sources::severity_logger<boost::log::trivial::severity_level> m_logger;
+        [[no_unique_address]] SourceT m_logger;
+
+}; // End of Basic_Logger class
+
+/// Logger that can be used by many threads at once without locking.  It is a single pointer
+/// to the interned state of its scope.
+using Logger = Basic_Logger<Shared_Source>;
+
+/// Kept for code written when `Logger` could not be shared between threads
+using Shared_Logger = Logger;
 
-}; // End of Logger class
+/// Logger whose scope is a compile-time constant
+template <Fixed_String ScopeT>
+using Static_Logger = Basic_Logger<Static_Source<ScopeT>>;
 
 } // End of tmns::log::impl namespace
\ No newline at end of file
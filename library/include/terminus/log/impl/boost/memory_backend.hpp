@@ -0,0 +1,405 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    memory_backend.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Project Libraries
+#include <terminus/log/impl/boost/format.hpp>
+#include <terminus/log/impl/stats.hpp>
+
+// Boost Libraries
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/log/attributes/current_thread_id.hpp>
+#include <boost/log/attributes/value_extraction.hpp>
+#include <boost/log/attributes/value_visitation.hpp>
+#include <boost/log/core/record_view.hpp>
+#include <boost/log/sinks/basic_sink_backend.hpp>
+#include <boost/log/sinks/frontend_requirements.hpp>
+#include <boost/log/trivial.hpp>
+
+// C++ Libraries
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace tmns::log::impl::sinks {
+
+/**
+ * Value of a field of a captured record.  These are the types `kv()` stores fields as.
+*/
+using Field_Value = std::variant<bool,int64_t,uint64_t,double,std::string>;
+
+/**
+ * Snapshot of one record's attributes, as kept by a "Memory" sink.  Attributes the record
+ * does not have are left empty.
+*/
+struct Captured_Record
+{
+    std::optional<uint64_t> record_id;
+
+    std::optional<boost::log::trivial::severity_level> severity;
+
+    std::optional<boost::posix_time::ptime> time_stamp;
+
+    std::string scope;
+
+    std::string message;
+
+    std::optional<uint64_t> thread_id;
+
+    std::string file;
+
+    std::optional<int64_t> line;
+
+    std::string function;
+
+    /// Every other attribute holding one of the `Field_Value` types, such as `kv()` fields
+    std::vector<std::pair<std::string,Field_Value>> fields;
+
+    /**
+     * Returns the named field, or nullptr if the record has none.
+    */
+    [[nodiscard]] const Field_Value* field( std::string_view name ) const
+    {
+        for( const auto& [field_name, value] : fields )
+        {
+            if( field_name == name )
+            {
+                return &value;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * Returns the named field if it holds a `ValueT`.
+    */
+    template <typename ValueT>
+    [[nodiscard]] std::optional<ValueT> field_as( std::string_view name ) const
+    {
+        const auto* value = field( name );
+        if( value == nullptr || !std::holds_alternative<ValueT>( *value ) )
+        {
+            return std::nullopt;
+        }
+        return std::get<ValueT>( *value );
+    }
+
+    /**
+     * Replaces the contents with the record's attribute values, reusing the strings'
+     * storage.
+    */
+    void assign( const boost::log::record_view& rec )
+    {
+        namespace bl = boost::log;
+
+        auto assign_string = [&rec]( const char* name, std::string& out )
+        {
+            if( auto val = bl::extract<std::string>( name, rec ) )
+            {
+                out.assign( val.get() );
+            }
+            else
+            {
+                out.clear();
+            }
+        };
+
+        record_id = std::nullopt;
+        if( auto val = bl::extract<uint64_t>( "RecordID", rec ) )
+        {
+            record_id = val.get();
+        }
+        severity = std::nullopt;
+        if( auto val = bl::extract<bl::trivial::severity_level>( "Severity", rec ) )
+        {
+            severity = val.get();
+        }
+        time_stamp = std::nullopt;
+        if( auto val = bl::extract<boost::posix_time::ptime>( "TimeStamp", rec ) )
+        {
+            time_stamp = val.get();
+        }
+        assign_string( "Scope", scope );
+        assign_string( "Message", message );
+        thread_id = std::nullopt;
+        if( auto val = bl::extract<bl::thread_id>( "ThreadID", rec ) )
+        {
+            thread_id = static_cast<uint64_t>( val.get().native_id() );
+        }
+        assign_string( "File", file );
+        line = std::nullopt;
+        if( auto val = bl::extract<int64_t>( "Line", rec ) )
+        {
+            line = val.get();
+        }
+        assign_string( "Function", function );
+
+        fields.clear();
+        for( const auto& [name, value] : rec.attribute_values() )
+        {
+            if( format::is_core_attribute( name.string() ) )
+            {
+                continue;
+            }
+            bl::visit<format::Json_Field_Types>( value, [this, &name]( const auto& field )
+            {
+                fields.emplace_back( name.string(), Field_Value{ field } );
+            });
+        }
+    }
+
+}; // End of Captured_Record struct
+
+/**
+ * Fixed-capacity, thread-safe store of the records a "Memory" sink captured.  All slots
+ * are allocated up front; once the store is full, each new record replaces the oldest.
+ *
+ * Tests query the records directly instead of formatting, capturing, and parsing text,
+ * and may do so while other threads are logging.
+*/
+class Memory_Buffer
+{
+    public:
+
+        /**
+         * @throws std::invalid_argument if `capacity` is 0.
+        */
+        explicit Memory_Buffer( size_t capacity )
+          : m_slots( capacity )
+        {
+            if( capacity == 0 )
+            {
+                throw std::invalid_argument( "Memory sink capacity must be greater than 0" );
+            }
+        }
+
+        /**
+         * Captures the record.
+        */
+        void push( const boost::log::record_view& rec )
+        {
+            // Fill a thread's spare slot outside the lock, then swap it into the ring so
+            // the ring slot's storage becomes the spare
+            thread_local Captured_Record t_spare;
+            t_spare.assign( rec );
+            {
+                std::lock_guard<std::mutex> lock{ m_mutex };
+                std::swap( m_slots[m_total % m_slots.size()], t_spare );
+                ++m_total;
+            }
+            m_added.notify_all();
+        }
+
+        /**
+         * Returns copies of the held records, oldest first.
+        */
+        [[nodiscard]] std::vector<Captured_Record> records() const
+        {
+            return find( []( const Captured_Record& ){ return true; } );
+        }
+
+        /**
+         * Returns copies of the held records matching `predicate( const Captured_Record& )`,
+         * oldest first.
+        */
+        template <typename PredicateT>
+        [[nodiscard]] std::vector<Captured_Record> find( PredicateT&& predicate ) const
+        {
+            std::vector<Captured_Record> result;
+            for_each( [&]( const Captured_Record& record )
+            {
+                if( predicate( record ) )
+                {
+                    result.push_back( record );
+                }
+            });
+            return result;
+        }
+
+        /**
+         * Returns the number of held records matching `predicate( const Captured_Record& )`.
+        */
+        template <typename PredicateT>
+        [[nodiscard]] size_t count( PredicateT&& predicate ) const
+        {
+            size_t result = 0;
+            for_each( [&]( const Captured_Record& record )
+            {
+                result += predicate( record ) ? 1 : 0;
+            });
+            return result;
+        }
+
+        /**
+         * Calls `fn( const Captured_Record& )` for each held record, oldest first, while
+         * holding the buffer's lock.  `fn` must not log to this sink.
+        */
+        template <typename FnT>
+        void for_each( FnT&& fn ) const
+        {
+            std::lock_guard<std::mutex> lock{ m_mutex };
+            const uint64_t held = held_count();
+            for( uint64_t i = m_total - held; i < m_total; ++i )
+            {
+                fn( m_slots[i % m_slots.size()] );
+            }
+        }
+
+        /**
+         * Waits until at least `count` records were captured since the last `clear()`, or
+         * the timeout expires.  Returns true if they were.  Useful with asynchronous sinks
+         * feeding other threads' records.
+        */
+        bool wait_for( uint64_t                  count,
+                       std::chrono::milliseconds timeout ) const
+        {
+            std::unique_lock<std::mutex> lock{ m_mutex };
+            return m_added.wait_for( lock, timeout, [this, count](){ return m_total >= count; } );
+        }
+
+        /// Number of records held, at most `capacity()`
+        [[nodiscard]] size_t size() const
+        {
+            std::lock_guard<std::mutex> lock{ m_mutex };
+            return static_cast<size_t>( held_count() );
+        }
+
+        /// Number of records captured since the last `clear()`, including replaced ones
+        [[nodiscard]] uint64_t total() const
+        {
+            std::lock_guard<std::mutex> lock{ m_mutex };
+            return m_total;
+        }
+
+        [[nodiscard]] size_t capacity() const
+        {
+            return m_slots.size();
+        }
+
+        /**
+         * Forgets the held records.  The slots keep their storage.
+        */
+        void clear()
+        {
+            std::lock_guard<std::mutex> lock{ m_mutex };
+            m_total = 0;
+        }
+
+    private:
+
+        [[nodiscard]] uint64_t held_count() const
+        {
+            return std::min<uint64_t>( m_total, m_slots.size() );
+        }
+
+        mutable std::mutex m_mutex;
+
+        mutable std::condition_variable m_added;
+
+        std::vector<Captured_Record> m_slots;
+
+        /// Records captured since the last clear; the next goes to slot `m_total % capacity`
+        uint64_t m_total{ 0 };
+
+}; // End of Memory_Buffer class
+
+/**
+ * Buffers of the live "Memory" sinks by sink name, so tests can find the buffer of a sink
+ * created from a settings file.
+*/
+class Memory_Registry
+{
+    public:
+
+        static Memory_Registry& instance()
+        {
+            static Memory_Registry s_instance;
+            return s_instance;
+        }
+
+        void add( const std::string&             name,
+                  std::shared_ptr<Memory_Buffer> buffer )
+        {
+            std::lock_guard<std::mutex> lock{ m_mutex };
+            std::erase_if( m_buffers, []( const auto& entry ){ return entry.second.expired(); } );
+            m_buffers[name] = buffer;
+        }
+
+        /**
+         * Returns the buffer of the most recently created live sink with this name, or
+         * nullptr if there is none.
+        */
+        [[nodiscard]] std::shared_ptr<Memory_Buffer> find( const std::string& name ) const
+        {
+            std::lock_guard<std::mutex> lock{ m_mutex };
+            auto it = m_buffers.find( name );
+            return it == m_buffers.end() ? nullptr : it->second.lock();
+        }
+
+    private:
+
+        mutable std::mutex m_mutex;
+
+        std::map<std::string,std::weak_ptr<Memory_Buffer>> m_buffers;
+
+}; // End of Memory_Registry class
+
+/**
+ * Sink backend capturing records into a `Memory_Buffer`, for the "Memory" sink.  Records
+ * are not formatted.  The backend is safe to call from many threads at once, so it is
+ * used with an unlocked frontend.
+*/
+class Memory_Backend
+    : public boost::log::sinks::basic_sink_backend<boost::log::sinks::concurrent_feeding>
+{
+    public:
+
+        Memory_Backend( std::shared_ptr<Memory_Buffer>        buffer,
+                        std::shared_ptr<stats::Sink_Counters> counters )
+          : m_buffer{ std::move( buffer ) },
+            m_counters{ std::move( counters ) }
+        {
+        }
+
+        void consume( const boost::log::record_view& rec )
+        {
+            m_buffer->push( rec );
+            m_counters->records_emitted.fetch_add( 1, std::memory_order_relaxed );
+        }
+
+        [[nodiscard]] const std::shared_ptr<Memory_Buffer>& buffer() const
+        {
+            return m_buffer;
+        }
+
+    private:
+
+        std::shared_ptr<Memory_Buffer> m_buffer;
+
+        std::shared_ptr<stats::Sink_Counters> m_counters;
+
+}; // End of Memory_Backend class
+
+} // End of tmns::log::impl::sinks namespace
@@ -0,0 +1,379 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    queue.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Boost Libraries
+#include <boost/algorithm/string/case_conv.hpp>
+#include <boost/log/attributes/attribute_set.hpp>
+#include <boost/log/attributes/attribute_value_impl.hpp>
+#include <boost/log/attributes/constant.hpp>
+#include <boost/log/core/core.hpp>
+#include <boost/log/core/record_view.hpp>
+#include <boost/log/sinks/sink.hpp>
+#include <boost/log/trivial.hpp>
+#include <boost/parameter/keyword.hpp>
+
+// Terminus Libraries
+#include <terminus/log/impl/stats.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace tmns::log::impl::keywords {
+
+/// Counters an asynchronous sink queue should report to
+BOOST_PARAMETER_KEYWORD(tag, sink_counters)
+
+/// Maximum number of records an asynchronous sink queue holds, zero for unbounded
+BOOST_PARAMETER_KEYWORD(tag, queue_capacity)
+
+/// What an asynchronous sink queue does with a record when it is full
+BOOST_PARAMETER_KEYWORD(tag, overflow_policy)
+
+} // End of tmns::log::impl::keywords namespace
+
+namespace tmns::log::impl::sinks {
+
+/**
+ * What a bounded queue does with a new record when it is full.
+*/
+enum class Overflow_Policy
+{
+    BLOCK        = 0 /**< Wait until the feeding thread makes room */,
+    DROP_NEWEST  = 1 /**< Discard the new record */,
+    DROP_OLDEST  = 2 /**< Discard the oldest queued record to make room */,
+}; // End of Overflow_Policy enum
+
+/**
+ * Parses the "OverflowPolicy" setting.  Accepts "Block", "DropNewest", or "DropOldest".
+*/
+inline Overflow_Policy parse_overflow_policy( const std::string& value )
+{
+    auto lval = boost::algorithm::to_lower_copy( value );
+    if( lval == "block" )
+    {
+        return Overflow_Policy::BLOCK;
+    }
+    else if( lval == "dropnewest" )
+    {
+        return Overflow_Policy::DROP_NEWEST;
+    }
+    else if( lval == "dropoldest" )
+    {
+        return Overflow_Policy::DROP_OLDEST;
+    }
+    throw std::runtime_error( "Unsupported OverflowPolicy \"" + value + "\": must be \"Block\", \"DropNewest\", or \"DropOldest\"" );
+}
+
+/**
+ * Queueing strategy for asynchronous sink frontends.  It is a FIFO queue that reports
+ * its depth and high-water mark to the sink's counters and, when given a capacity,
+ * applies an overflow policy once that many records are waiting.
+ *
+ * Every dropped record is counted in the sink's `records_dropped`.  When an overflow
+ * episode ends, i.e. the next time a record is accepted, a warning record with the
+ * message "N records dropped ..." is queued ahead of it, so the gap is visible in
+ * the sink's own output.  That record is not subject to the capacity, and
+ * `Overflow_Policy::DROP_OLDEST` never drops it.  The notice is only queued if the
+ * sink's own filter accepts it; otherwise its count is carried over to the notice of
+ * the next episode.
+ *
+ * The frontend constructor takes `keywords::sink_counters`, and optionally
+ * `keywords::queue_capacity` and `keywords::overflow_policy`.
+ *
+ * Producers blocked by `Overflow_Policy::BLOCK` keep waiting through a flush; they are
+ * only released by the feeding thread making room.
+*/
+class Bounded_Queue
+{
+    protected:
+
+        template <typename ArgsT>
+        explicit Bounded_Queue( const ArgsT& args )
+          : m_counters( args[keywords::sink_counters] ),
+            m_capacity( args[keywords::queue_capacity | size_t{ 0 }] ),
+            m_policy( args[keywords::overflow_policy | Overflow_Policy::BLOCK] )
+        {
+        }
+
+        // Polymorphic so the notice can reach the sink frontend deriving from this queue
+        virtual ~Bounded_Queue() = default;
+
+        void enqueue( const boost::log::record_view& rec )
+        {
+            admit( rec, true );
+        }
+
+        bool try_enqueue( const boost::log::record_view& rec )
+        {
+            // Never wait here, a full blocking queue refuses the record instead
+            return admit( rec, false );
+        }
+
+        bool try_dequeue_ready( boost::log::record_view& rec )
+        {
+            return try_dequeue( rec );
+        }
+
+        bool try_dequeue( boost::log::record_view& rec )
+        {
+            std::lock_guard<std::mutex> lock{ m_mutex };
+            return pop( rec );
+        }
+
+        bool dequeue_ready( boost::log::record_view& rec )
+        {
+            std::unique_lock<std::mutex> lock{ m_mutex };
+            while( !m_interruption_requested )
+            {
+                if( pop( rec ) )
+                {
+                    return true;
+                }
+                m_not_empty.wait( lock );
+            }
+            m_interruption_requested = false;
+            return false;
+        }
+
+        void interrupt_dequeue()
+        {
+            std::lock_guard<std::mutex> lock{ m_mutex };
+            m_interruption_requested = true;
+            m_not_empty.notify_one();
+        }
+
+    private:
+
+        /**
+         * Outcome of applying the overflow policy to a new record.
+        */
+        enum class Admission
+        {
+            ACCEPT /**< There is room for the record */,
+            DROP   /**< The record is dropped by the policy */,
+            FULL   /**< The queue is full and the caller may not wait */,
+        }; // End of Admission enum
+
+        /**
+         * Queues the record, or drops it, as the overflow policy says.  Returns false
+         * only if the queue is full and `wait` is false.
+         *
+         * The record is checked against the capacity under the same lock that queues it,
+         * including after the lock was released to open a drop notice, so the queue never
+         * holds more than its capacity besides drop notices.  The dropped records stay
+         * counted for the next notice until one is queued.
+        */
+        bool admit( const boost::log::record_view& rec,
+                    bool                           wait )
+        {
+            std::unique_lock<std::mutex> lock{ m_mutex };
+            bool dropped_oldest = false;
+            auto admission = make_room( lock, wait, dropped_oldest );
+            if( admission != Admission::ACCEPT )
+            {
+                return admission == Admission::DROP;
+            }
+
+            // The episode ends once a record is accepted without dropping another
+            std::optional<boost::log::record_view> notice;
+            if( !dropped_oldest && m_notice_pending )
+            {
+                m_notice_pending = false;
+                const auto dropped = m_episode_dropped;
+
+                // Open the notice without holding the lock, as the core consults every sink's
+                // filter.  Other producers may fill the queue meanwhile.
+                lock.unlock();
+                notice = make_drop_notice( dropped );
+                lock.lock();
+                admission = make_room( lock, wait, dropped_oldest );
+
+                // Records dropped meanwhile are left for the next notice
+                if( notice )
+                {
+                    m_episode_dropped -= dropped;
+                }
+            }
+
+            if( notice )
+            {
+                push( *notice, true );
+            }
+            if( admission == Admission::ACCEPT )
+            {
+                push( rec, false );
+            }
+            return admission != Admission::FULL;
+        }
+
+        /**
+         * Applies the overflow policy until there is room for one more record.  Sets
+         * `dropped_oldest` if queued records were dropped to make room.
+        */
+        Admission make_room( std::unique_lock<std::mutex>& lock,
+                             bool                          wait,
+                             bool&                         dropped_oldest )
+        {
+            if( m_capacity == 0 )
+            {
+                return Admission::ACCEPT;
+            }
+            while( m_records >= m_capacity )
+            {
+                switch( m_policy )
+                {
+                    case Overflow_Policy::BLOCK:
+                        if( !wait )
+                        {
+                            return Admission::FULL;
+                        }
+                        m_not_full.wait( lock );
+                        break;
+
+                    case Overflow_Policy::DROP_NEWEST:
+                        record_drop();
+                        return Admission::DROP;
+
+                    case Overflow_Policy::DROP_OLDEST:
+                    {
+                        // Drop notices are kept, they are not subject to the capacity
+                        auto oldest = std::find_if( m_queue.begin(), m_queue.end(),
+                                                    []( const Entry& entry ){ return !entry.notice; } );
+                        m_queue.erase( oldest );
+                        --m_records;
+                        m_counters->dequeued();
+                        record_drop();
+                        dropped_oldest = true;
+                        break;
+                    }
+                }
+            }
+            return Admission::ACCEPT;
+        }
+
+        void record_drop()
+        {
+            ++m_episode_dropped;
+            m_notice_pending = true;
+            m_counters->records_dropped.fetch_add( 1, std::memory_order_relaxed );
+        }
+
+        void push( const boost::log::record_view& rec,
+                   bool                           notice )
+        {
+            m_queue.push_back( { rec, notice } );
+            m_records += notice ? 0 : 1;
+            m_counters->enqueued();
+            if( m_queue.size() == 1 )
+            {
+                m_not_empty.notify_one();
+            }
+        }
+
+        bool pop( boost::log::record_view& rec )
+        {
+            if( m_queue.empty() )
+            {
+                return false;
+            }
+            rec.swap( m_queue.front().rec );
+            m_records -= m_queue.front().notice ? 0 : 1;
+            m_queue.pop_front();
+            m_counters->dequeued();
+            m_not_full.notify_one();
+            return true;
+        }
+
+        /**
+         * Opens the warning record reporting an overflow episode.  Returns nothing if
+         * the core or the sink's filter rejects it.
+        */
+        std::optional<boost::log::record_view> make_drop_notice( uint64_t dropped )
+        {
+            namespace attrs = boost::log::attributes;
+            boost::log::attribute_set source_attributes;
+            source_attributes.insert( "Severity", attrs::constant<boost::log::trivial::severity_level>(
+                                                     boost::log::trivial::severity_level::warning ) );
+            source_attributes.insert( "Scope", attrs::constant<std::string>( "tmns::log" ) );
+
+            auto rec = boost::log::core::get()->open_record( source_attributes );
+            if( !rec )
+            {
+                return std::nullopt;
+            }
+            std::string message = std::to_string( dropped ) + " records dropped by sink \"" +
+                                  m_counters->name + "\" after its queue overflowed";
+            rec.attribute_values().insert( "Message", attrs::make_attribute_value( std::move( message ) ) );
+
+            // The core accepts the record if any sink does, so check this sink's filter too
+            auto view = rec.lock();
+            if( auto* sink = dynamic_cast<boost::log::sinks::sink*>( this );
+                sink != nullptr && !sink->will_consume( view.attribute_values() ) )
+            {
+                return std::nullopt;
+            }
+            return view;
+        }
+
+        /**
+         * Queued record.  Drop notices are not counted against the capacity.
+        */
+        struct Entry
+        {
+            boost::log::record_view rec;
+
+            bool notice;
+        }; // End of Entry struct
+
+        /// Counters of the sink that owns this queue
+        std::shared_ptr<stats::Sink_Counters> m_counters;
+
+        /// Maximum number of queued records, zero for unbounded
+        size_t m_capacity;
+
+        Overflow_Policy m_policy;
+
+        std::mutex m_mutex;
+
+        std::condition_variable m_not_empty;
+
+        std::condition_variable m_not_full;
+
+        std::deque<Entry> m_queue;
+
+        /// Queued records other than drop notices
+        size_t m_records{ 0 };
+
+        /// Dropped records not yet reported by a queued notice
+        uint64_t m_episode_dropped{ 0 };
+
+        /// Set by a drop, cleared when a record is accepted and a notice is attempted
+        bool m_notice_pending{ false };
+
+        bool m_interruption_requested{ false };
+
+}; // End of Bounded_Queue class
+
+} // End of tmns::log::impl::sinks namespace
@@ -0,0 +1,298 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    record_codec.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Boost Libraries
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/log/attributes/attribute_set.hpp>
+#include <boost/log/attributes/constant.hpp>
+#include <boost/log/attributes/current_process_id.hpp>
+#include <boost/log/attributes/current_thread_id.hpp>
+#include <boost/log/attributes/value_visitation.hpp>
+#include <boost/log/core/record_view.hpp>
+#include <boost/log/trivial.hpp>
+#include <boost/mpl/vector.hpp>
+
+// C++ Libraries
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace tmns::log::impl::ipc {
+
+/**
+ * Type tags of the attribute values in an encoded record.
+*/
+enum class Value_Type : uint8_t
+{
+    BOOL       = 1,
+    INT64      = 2,
+    UINT64     = 3,
+    DOUBLE     = 4,
+    STRING     = 5,
+    SEVERITY   = 6,
+    TIME_STAMP = 7,
+    THREAD_ID  = 8,
+    PROCESS_ID = 9,
+}; // End of Value_Type enum
+
+/**
+ * Attribute value types `encode_record()` keeps.  Narrower integers are widened to 64
+ * bits, and values of any other type are left out.
+*/
+using Encoded_Types = boost::mpl::vector<bool,int,unsigned int,long,unsigned long,long long,unsigned long long,
+                                         double,std::string,boost::log::trivial::severity_level,
+                                         boost::posix_time::ptime,boost::log::thread_id,boost::log::process_id>;
+
+namespace detail {
+
+template <typename ValueT>
+void put( std::string& out,
+          ValueT       value )
+{
+    out.append( reinterpret_cast<const char*>( &value ), sizeof( value ) );
+}
+
+inline void put_header( std::string&     out,
+                        std::string_view name,
+                        Value_Type       type )
+{
+    put( out, static_cast<uint8_t>( type ) );
+    put( out, static_cast<uint16_t>( name.size() ) );
+    out.append( name );
+}
+
+/**
+ * Reads values from an encoded record, failing once the record is exhausted.
+*/
+class Reader
+{
+    public:
+
+        explicit Reader( std::string_view data )
+          : m_data{ data }
+        {
+        }
+
+        template <typename ValueT>
+        bool get( ValueT& value )
+        {
+            if( m_data.size() < sizeof( ValueT ) )
+            {
+                return false;
+            }
+            std::memcpy( &value, m_data.data(), sizeof( ValueT ) );
+            m_data.remove_prefix( sizeof( ValueT ) );
+            return true;
+        }
+
+        bool get( std::string_view& value,
+                  size_t            size )
+        {
+            if( m_data.size() < size )
+            {
+                return false;
+            }
+            value = m_data.substr( 0, size );
+            m_data.remove_prefix( size );
+            return true;
+        }
+
+        [[nodiscard]] bool empty() const
+        {
+            return m_data.empty();
+        }
+
+    private:
+
+        std::string_view m_data;
+
+}; // End of Reader class
+
+} // End of detail namespace
+
+/**
+ * Appends a compact binary copy of the record's attribute values to `out`, so another
+ * process on the same host can rebuild the record with `decode_record()`.  Values are
+ * written in the host's byte order, and values of types outside `Encoded_Types` (or with
+ * names longer than 64 KiB) are skipped.
+*/
+inline void encode_record( const boost::log::record_view& rec,
+                           std::string&                   out )
+{
+    for( const auto& [name, value] : rec.attribute_values() )
+    {
+        std::string_view key = name.string();
+        if( key.size() > UINT16_MAX )
+        {
+            continue;
+        }
+        boost::log::visit<Encoded_Types>( value, [&out, key]( const auto& field )
+        {
+            using field_type = std::remove_cvref_t<decltype( field )>;
+            if constexpr( std::is_same_v<field_type,bool> )
+            {
+                detail::put_header( out, key, Value_Type::BOOL );
+                detail::put( out, static_cast<uint8_t>( field ) );
+            }
+            else if constexpr( std::is_integral_v<field_type> && std::is_signed_v<field_type> )
+            {
+                detail::put_header( out, key, Value_Type::INT64 );
+                detail::put( out, static_cast<int64_t>( field ) );
+            }
+            else if constexpr( std::is_integral_v<field_type> )
+            {
+                detail::put_header( out, key, Value_Type::UINT64 );
+                detail::put( out, static_cast<uint64_t>( field ) );
+            }
+            else if constexpr( std::is_same_v<field_type,double> )
+            {
+                detail::put_header( out, key, Value_Type::DOUBLE );
+                detail::put( out, field );
+            }
+            else if constexpr( std::is_same_v<field_type,std::string> )
+            {
+                detail::put_header( out, key, Value_Type::STRING );
+                detail::put( out, static_cast<uint32_t>( field.size() ) );
+                out.append( field );
+            }
+            else if constexpr( std::is_same_v<field_type,boost::log::trivial::severity_level> )
+            {
+                detail::put_header( out, key, Value_Type::SEVERITY );
+                detail::put( out, static_cast<uint8_t>( field ) );
+            }
+            else if constexpr( std::is_same_v<field_type,boost::posix_time::ptime> )
+            {
+                static const boost::posix_time::ptime EPOCH{ boost::gregorian::date( 1970, 1, 1 ) };
+                detail::put_header( out, key, Value_Type::TIME_STAMP );
+                detail::put( out, static_cast<int64_t>( ( field - EPOCH ).ticks() ) );
+            }
+            else if constexpr( std::is_same_v<field_type,boost::log::thread_id> )
+            {
+                detail::put_header( out, key, Value_Type::THREAD_ID );
+                detail::put( out, static_cast<uint64_t>( field.native_id() ) );
+            }
+            else
+            {
+                detail::put_header( out, key, Value_Type::PROCESS_ID );
+                detail::put( out, static_cast<uint64_t>( field.native_id() ) );
+            }
+        });
+    }
+}
+
+/**
+ * Adds the attributes of a record encoded by `encode_record()` to `attributes` as
+ * constants.  Returns false if the record is malformed.
+*/
+inline bool decode_record( std::string_view           data,
+                           boost::log::attribute_set& attributes )
+{
+    namespace attrs = boost::log::attributes;
+
+    detail::Reader reader{ data };
+    while( !reader.empty() )
+    {
+        uint8_t type;
+        uint16_t name_size;
+        std::string_view name;
+        if( !reader.get( type ) || !reader.get( name_size ) || !reader.get( name, name_size ) )
+        {
+            return false;
+        }
+
+        boost::log::attribute attribute;
+        switch( static_cast<Value_Type>( type ) )
+        {
+            case Value_Type::BOOL:
+            {
+                uint8_t value;
+                if( !reader.get( value ) ) { return false; }
+                attribute = attrs::constant<bool>( value != 0 );
+                break;
+            }
+            case Value_Type::INT64:
+            {
+                int64_t value;
+                if( !reader.get( value ) ) { return false; }
+                attribute = attrs::constant<int64_t>( value );
+                break;
+            }
+            case Value_Type::UINT64:
+            {
+                uint64_t value;
+                if( !reader.get( value ) ) { return false; }
+                attribute = attrs::constant<uint64_t>( value );
+                break;
+            }
+            case Value_Type::DOUBLE:
+            {
+                double value;
+                if( !reader.get( value ) ) { return false; }
+                attribute = attrs::constant<double>( value );
+                break;
+            }
+            case Value_Type::STRING:
+            {
+                uint32_t size;
+                std::string_view value;
+                if( !reader.get( size ) || !reader.get( value, size ) ) { return false; }
+                attribute = attrs::constant<std::string>( std::string{ value } );
+                break;
+            }
+            case Value_Type::SEVERITY:
+            {
+                uint8_t value;
+                if( !reader.get( value ) ) { return false; }
+                attribute = attrs::constant<boost::log::trivial::severity_level>(
+                                static_cast<boost::log::trivial::severity_level>( value ) );
+                break;
+            }
+            case Value_Type::TIME_STAMP:
+            {
+                static const boost::posix_time::ptime EPOCH{ boost::gregorian::date( 1970, 1, 1 ) };
+                int64_t ticks;
+                if( !reader.get( ticks ) ) { return false; }
+                attribute = attrs::constant<boost::posix_time::ptime>(
+                                EPOCH + boost::posix_time::time_duration( 0, 0, 0, ticks ) );
+                break;
+            }
+            case Value_Type::THREAD_ID:
+            {
+                uint64_t value;
+                if( !reader.get( value ) ) { return false; }
+                attribute = attrs::constant<boost::log::thread_id>(
+                                boost::log::thread_id( static_cast<boost::log::thread_id::native_type>( value ) ) );
+                break;
+            }
+            case Value_Type::PROCESS_ID:
+            {
+                uint64_t value;
+                if( !reader.get( value ) ) { return false; }
+                attribute = attrs::constant<boost::log::process_id>(
+                                boost::log::process_id( static_cast<boost::log::process_id::native_type>( value ) ) );
+                break;
+            }
+            default:
+                return false;
+        }
+        attributes.insert( std::string{ name }, attribute );
+    }
+    return true;
+}
+
+} // End of tmns::log::impl::ipc namespace
@@ -0,0 +1,348 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    sharded_file_backend.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Project Libraries
+#include <terminus/log/impl/stats.hpp>
+
+// Boost Libraries
+#include <boost/log/core/record_view.hpp>
+#include <boost/log/sinks/basic_sink_backend.hpp>
+#include <boost/log/sinks/frontend_requirements.hpp>
+
+// C++ Libraries
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace tmns::log::impl::sinks {
+
+/**
+ * Settings of a `Sharded_File_Backend`.
+*/
+struct Sharded_File_Options
+{
+    /// File name pattern, where each "%T" is replaced by the shard number
+    std::string file_name;
+
+    /// Bytes of records buffered by each shard before they are written
+    size_t buffer_size{ 64 * 1024 };
+
+    /// Append to existing shard files instead of truncating them
+    bool append{ false };
+
+    /// Write every record as soon as it is consumed
+    bool auto_flush{ false };
+
+}; // End of Sharded_File_Options struct
+
+/**
+ * File sink backend writing the records of each logging thread to that thread's own
+ * file, for the "TextFile" and "JsonFile" sinks whose "FileName" contains "%T".
+ *
+ * Each thread formats and buffers its records into its own shard, so no two threads share
+ * a buffer or a file, and the sink scales with the number of threads instead of being
+ * limited by one file.  Each shard has a mutex, which other threads only take to flush or
+ * close the shard, so it is uncontended while logging; the sink's counters are updated
+ * once per write rather than once per record.
+ *
+ * Shards are numbered in the order threads log their first record, starting at 0, and a
+ * shard's file is closed when its thread exits.  Numbers are not reused, so every new
+ * thread adds a file.  `terminus_log_merge` merges the shard files back into one stream.
+*/
+class Sharded_File_Backend
+    : public boost::log::sinks::basic_formatted_sink_backend<char,
+                                                             boost::log::sinks::combine_requirements<
+                                                                 boost::log::sinks::concurrent_feeding,
+                                                                 boost::log::sinks::flushing>::type>
+{
+    public:
+
+        /**
+         * @throws std::runtime_error if the file name has no "%T".
+        */
+        Sharded_File_Backend( Sharded_File_Options                  options,
+                              std::shared_ptr<stats::Sink_Counters> counters )
+          : m_options{ std::move( options ) },
+            m_counters{ std::move( counters ) },
+            m_id{ next_backend_id() }
+        {
+            if( m_options.file_name.find( "%T" ) == std::string::npos )
+            {
+                throw std::runtime_error( "Sharded file name \"" + m_options.file_name + "\" has no %T" );
+            }
+        }
+
+        Sharded_File_Backend( const Sharded_File_Backend& ) = delete;
+        Sharded_File_Backend& operator=( const Sharded_File_Backend& ) = delete;
+
+        ~Sharded_File_Backend()
+        {
+            std::lock_guard<std::mutex> lock{ m_shards_mutex };
+            for( const auto& shard : m_shards )
+            {
+                shard->close();
+            }
+        }
+
+        void consume( const boost::log::record_view& /*rec*/,
+                      const string_type&             formatted_message )
+        {
+            local_shard().append( formatted_message, m_options );
+        }
+
+        /**
+         * Writes the buffered records of every shard.
+        */
+        void flush()
+        {
+            std::lock_guard<std::mutex> lock{ m_shards_mutex };
+            forget_closed_shards();
+            for( const auto& shard : m_shards )
+            {
+                shard->flush();
+            }
+        }
+
+        /**
+         * Returns the file name of the provided shard number.
+        */
+        [[nodiscard]] std::string shard_file_name( uint64_t shard ) const
+        {
+            std::string name = m_options.file_name;
+            const auto number = std::to_string( shard );
+            for( size_t pos = name.find( "%T" ); pos != std::string::npos; pos = name.find( "%T", pos + number.size() ) )
+            {
+                name.replace( pos, 2, number );
+            }
+            return name;
+        }
+
+    private:
+
+        /**
+         * One thread's file and buffer.  Only the owning thread appends, so the mutex is
+         * uncontended unless another thread is flushing or closing the shard.
+        */
+        class Shard
+        {
+            public:
+
+                Shard( std::FILE*                            file,
+                       std::shared_ptr<stats::Sink_Counters> counters )
+                  : m_file{ file },
+                    m_counters{ std::move( counters ) }
+                {
+                }
+
+                void append( const std::string&          message,
+                             const Sharded_File_Options& options )
+                {
+                    std::lock_guard<std::mutex> lock{ m_mutex };
+                    if( m_file == nullptr )
+                    {
+                        return;
+                    }
+                    m_buffer.append( message );
+                    if( message.empty() || message.back() != '\n' )
+                    {
+                        m_buffer.push_back( '\n' );
+                    }
+                    ++m_records;
+                    if( options.auto_flush || m_buffer.size() >= options.buffer_size )
+                    {
+                        write();
+                    }
+                }
+
+                void flush()
+                {
+                    std::lock_guard<std::mutex> lock{ m_mutex };
+                    write();
+                }
+
+                void close()
+                {
+                    std::lock_guard<std::mutex> lock{ m_mutex };
+                    write();
+                    if( m_file != nullptr )
+                    {
+                        std::fclose( m_file );
+                        m_file = nullptr;
+                    }
+                }
+
+                [[nodiscard]] bool closed()
+                {
+                    std::lock_guard<std::mutex> lock{ m_mutex };
+                    return m_file == nullptr;
+                }
+
+            private:
+
+                /**
+                 * Writes the buffer and reports the shard's records to the sink's counters
+                 * once per write instead of once per record.
+                */
+                void write()
+                {
+                    if( m_buffer.empty() || m_file == nullptr )
+                    {
+                        return;
+                    }
+                    if( std::fwrite( m_buffer.data(), 1, m_buffer.size(), m_file ) == m_buffer.size() )
+                    {
+                        m_counters->records_emitted.fetch_add( m_records, std::memory_order_relaxed );
+                        m_counters->bytes_written.fetch_add( m_buffer.size(), std::memory_order_relaxed );
+                    }
+                    else
+                    {
+                        m_counters->records_dropped.fetch_add( m_records, std::memory_order_relaxed );
+                    }
+                    std::fflush( m_file );
+                    m_buffer.clear();
+                    m_records = 0;
+                }
+
+                std::mutex m_mutex;
+
+                std::FILE* m_file;
+
+                std::shared_ptr<stats::Sink_Counters> m_counters;
+
+                std::string m_buffer;
+
+                /// Records in the buffer
+                uint64_t m_records{ 0 };
+
+        }; // End of Shard class
+
+        /**
+         * Shards of the current thread, one per sharded backend it logged to.  Shards are
+         * closed when the thread exits.
+        */
+        struct Thread_Shards
+        {
+            struct Entry
+            {
+                uint64_t backend_id;
+                std::shared_ptr<Shard> shard;
+            }; // End of Entry struct
+
+            ~Thread_Shards()
+            {
+                for( const auto& entry : entries )
+                {
+                    entry.shard->close();
+                }
+            }
+
+            std::vector<Entry> entries;
+
+        }; // End of Thread_Shards struct
+
+        static uint64_t next_backend_id()
+        {
+            static std::atomic<uint64_t> s_next{ 1 };
+            return s_next.fetch_add( 1, std::memory_order_relaxed );
+        }
+
+        Shard& local_shard()
+        {
+            thread_local Thread_Shards t_shards;
+            thread_local uint64_t t_last_id{ 0 };
+            thread_local Shard* t_last_shard{ nullptr };
+            if( t_last_id == m_id )
+            {
+                return *t_last_shard;
+            }
+
+            Shard* shard = nullptr;
+            for( const auto& entry : t_shards.entries )
+            {
+                if( entry.backend_id == m_id )
+                {
+                    shard = entry.shard.get();
+                    break;
+                }
+            }
+            if( shard == nullptr )
+            {
+                // Forget the shards of backends that were destroyed
+                std::erase_if( t_shards.entries, []( const auto& entry ){ return entry.shard->closed(); } );
+                auto created = open_shard();
+                t_shards.entries.push_back( { m_id, created } );
+                shard = created.get();
+            }
+            t_last_id    = m_id;
+            t_last_shard = shard;
+            return *shard;
+        }
+
+        std::shared_ptr<Shard> open_shard()
+        {
+            std::lock_guard<std::mutex> lock{ m_shards_mutex };
+            forget_closed_shards();
+            const auto name = shard_file_name( m_next_shard++ );
+            const std::filesystem::path path{ name };
+            if( path.has_parent_path() )
+            {
+                std::error_code error;
+                std::filesystem::create_directories( path.parent_path(), error );
+            }
+            std::FILE* file = std::fopen( name.c_str(), m_options.append ? "ab" : "wb" );
+            if( file == nullptr )
+            {
+                throw std::runtime_error( "Failed to open log shard \"" + name + "\": " + std::strerror( errno ) );
+            }
+            std::setvbuf( file, nullptr, _IONBF, 0 );
+            auto shard = std::make_shared<Shard>( file, m_counters );
+            m_shards.push_back( shard );
+            return shard;
+        }
+
+        /**
+         * Releases the shards of threads that exited, so the shard list only grows with
+         * the number of live threads.  Call with `m_shards_mutex` held.
+        */
+        void forget_closed_shards()
+        {
+            std::erase_if( m_shards, []( const auto& shard ){ return shard->closed(); } );
+        }
+
+        Sharded_File_Options m_options;
+
+        std::shared_ptr<stats::Sink_Counters> m_counters;
+
+        /// Distinguishes this backend in the thread-local shard lists, even at a reused address
+        uint64_t m_id;
+
+        std::mutex m_shards_mutex;
+
+        std::vector<std::shared_ptr<Shard>> m_shards;
+
+        uint64_t m_next_shard{ 0 };
+
+}; // End of Sharded_File_Backend class
+
+} // End of tmns::log::impl::sinks namespace
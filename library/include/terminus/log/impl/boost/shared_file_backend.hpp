@@ -0,0 +1,329 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    shared_file_backend.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+#if defined(__unix__) || defined(__APPLE__)
+
+// Project Libraries
+#include <terminus/log/impl/stats.hpp>
+
+// Boost Libraries
+#include <boost/log/core/record_view.hpp>
+#include <boost/log/sinks/basic_sink_backend.hpp>
+#include <boost/log/sinks/frontend_requirements.hpp>
+
+// C++ Libraries
+#include <cerrno>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+// POSIX
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace tmns::log::impl::sinks {
+
+/**
+ * Settings of a `Shared_File_Backend`.
+*/
+struct Shared_File_Options
+{
+    /// Path of the active file, shared by every process
+    std::filesystem::path file_name;
+
+    /// Size at which the active file is archived and a new one started
+    uintmax_t rotation_size{ std::numeric_limits<uintmax_t>::max() };
+
+    /// Bytes of whole records buffered before they are written together
+    size_t buffer_size{ PIPE_BUF };
+
+    /// Write every record as soon as it is consumed
+    bool auto_flush{ false };
+
+}; // End of Shared_File_Options struct
+
+/**
+ * File sink backend that lets several processes append to the same file without
+ * interleaving or tearing records, for the "TextFile" and "JsonFile" sinks with
+ * `MultiProcess=true`.
+ *
+ * Records are buffered in this process and written with one `write()` on a file opened
+ * with `O_APPEND`, so every write lands whole at the end of the file.  A buffer only ever
+ * holds whole records: a record that would overflow `buffer_size` first writes out the
+ * records before it, and a record larger than the buffer is written by itself.
+ *
+ * Rotation is coordinated through an exclusive `flock` on "<file_name>.lock".  The process
+ * whose write takes the file past `rotation_size` renames it to the next free
+ * "<stem>.<N><extension>" archive name, and every process reopens the active file when it
+ * sees that the path names a different file.  A write racing with a rotation lands whole
+ * at the end of the archived file.
+ *
+ * Buffered records are counted in the sink's `records_emitted` once they are written, or
+ * in its `records_dropped` if the write fails.
+*/
+class Shared_File_Backend
+    : public boost::log::sinks::basic_formatted_sink_backend<char,
+                                                             boost::log::sinks::combine_requirements<
+                                                                 boost::log::sinks::synchronized_feeding,
+                                                                 boost::log::sinks::flushing>::type>
+{
+    public:
+
+        /// Records are counted as emitted when written, not when buffered
+        static constexpr bool REPORTS_OWN_OUTPUT = true;
+
+        /**
+         * Opens the active file, creating it and its parent directories if needed.
+         *
+         * @throws std::runtime_error if the file cannot be opened.
+        */
+        Shared_File_Backend( Shared_File_Options                   options,
+                             std::shared_ptr<stats::Sink_Counters> counters )
+          : m_options{ std::move( options ) },
+            m_counters{ std::move( counters ) },
+            m_lock_name{ m_options.file_name.string() + ".lock" }
+        {
+            if( m_options.file_name.has_parent_path() )
+            {
+                std::filesystem::create_directories( m_options.file_name.parent_path() );
+            }
+            if( !open_file() )
+            {
+                throw std::runtime_error( "Failed to open log file \"" + m_options.file_name.string() + "\": " +
+                                          std::strerror( errno ) );
+            }
+            m_buffer.reserve( m_options.buffer_size );
+        }
+
+        Shared_File_Backend( const Shared_File_Backend& ) = delete;
+        Shared_File_Backend& operator=( const Shared_File_Backend& ) = delete;
+
+        ~Shared_File_Backend()
+        {
+            write_buffer();
+            ::close( m_fd );
+            if( m_lock_fd >= 0 )
+            {
+                ::close( m_lock_fd );
+            }
+        }
+
+        void consume( const boost::log::record_view& /*rec*/,
+                      const string_type&             formatted_message )
+        {
+            const bool newline = formatted_message.empty() || formatted_message.back() != '\n';
+            const size_t size  = formatted_message.size() + ( newline ? 1 : 0 );
+            if( !m_buffer.empty() && m_buffer.size() + size > m_options.buffer_size )
+            {
+                write_buffer();
+            }
+
+            m_buffer.append( formatted_message );
+            if( newline )
+            {
+                m_buffer.push_back( '\n' );
+            }
+            ++m_buffered_records;
+            m_buffered_bytes += formatted_message.size();
+
+            if( m_options.auto_flush || m_buffer.size() >= m_options.buffer_size )
+            {
+                write_buffer();
+            }
+        }
+
+        void flush()
+        {
+            write_buffer();
+        }
+
+    private:
+
+        bool open_file()
+        {
+            int fd = ::open( m_options.file_name.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644 );
+            if( fd < 0 )
+            {
+                return false;
+            }
+            struct stat status{};
+            ::fstat( fd, &status );
+            if( m_fd >= 0 )
+            {
+                ::close( m_fd );
+            }
+            m_fd    = fd;
+            m_inode = status.st_ino;
+            m_dev   = status.st_dev;
+            return true;
+        }
+
+        /**
+         * Reopens the active file if another process archived it.
+        */
+        void reopen_if_rotated()
+        {
+            struct stat status{};
+            if( ::stat( m_options.file_name.c_str(), &status ) != 0 ||
+                status.st_ino != m_inode || status.st_dev != m_dev )
+            {
+                open_file();
+            }
+        }
+
+        /**
+         * Writes the buffered records with one `write()`, then rotates the file if it
+         * reached the rotation size.  Records are counted as emitted once written, or as
+         * dropped if they cannot be.
+        */
+        void write_buffer()
+        {
+            if( m_buffer.empty() )
+            {
+                return;
+            }
+            reopen_if_rotated();
+
+            const char* data = m_buffer.data();
+            size_t remaining = m_buffer.size();
+            while( remaining > 0 )
+            {
+                ssize_t written = ::write( m_fd, data, remaining );
+                if( written < 0 )
+                {
+                    if( errno == EINTR )
+                    {
+                        continue;
+                    }
+                    break;
+                }
+                data      += written;
+                remaining -= static_cast<size_t>( written );
+            }
+            if( remaining == 0 )
+            {
+                m_counters->records_emitted.fetch_add( m_buffered_records, std::memory_order_relaxed );
+                m_counters->bytes_written.fetch_add( m_buffered_bytes, std::memory_order_relaxed );
+            }
+            else
+            {
+                m_counters->records_dropped.fetch_add( m_buffered_records, std::memory_order_relaxed );
+            }
+            m_buffer.clear();
+            m_buffered_records = 0;
+            m_buffered_bytes   = 0;
+
+            if( m_options.rotation_size != std::numeric_limits<uintmax_t>::max() )
+            {
+                struct stat status{};
+                if( ::fstat( m_fd, &status ) == 0 && static_cast<uintmax_t>( status.st_size ) >= m_options.rotation_size )
+                {
+                    rotate();
+                }
+            }
+        }
+
+        /**
+         * Archives the active file under the rotation lock, unless another process
+         * already did, and opens the new active file.
+        */
+        void rotate()
+        {
+            if( m_lock_fd < 0 )
+            {
+                m_lock_fd = ::open( m_lock_name.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644 );
+                if( m_lock_fd < 0 )
+                {
+                    return;
+                }
+            }
+            while( ::flock( m_lock_fd, LOCK_EX ) != 0 )
+            {
+                if( errno != EINTR )
+                {
+                    return;
+                }
+            }
+
+            struct stat status{};
+            if( ::stat( m_options.file_name.c_str(), &status ) == 0 &&
+                status.st_ino == m_inode && status.st_dev == m_dev &&
+                static_cast<uintmax_t>( status.st_size ) >= m_options.rotation_size )
+            {
+                std::error_code error;
+                std::filesystem::rename( m_options.file_name, next_archive_name(), error );
+                if( !error )
+                {
+                    m_counters->rotations.fetch_add( 1, std::memory_order_relaxed );
+                }
+            }
+            reopen_if_rotated();
+
+            ::flock( m_lock_fd, LOCK_UN );
+        }
+
+        /**
+         * Returns the first "<stem>.<N><extension>" path that does not exist.
+        */
+        std::filesystem::path next_archive_name() const
+        {
+            const auto& path = m_options.file_name;
+            for( uint64_t index = 1;; ++index )
+            {
+                auto archive = path.parent_path() / ( path.stem().string() + "." + std::to_string( index ) +
+                                                      path.extension().string() );
+                if( !std::filesystem::exists( archive ) )
+                {
+                    return archive;
+                }
+            }
+        }
+
+        Shared_File_Options m_options;
+
+        std::shared_ptr<stats::Sink_Counters> m_counters;
+
+        std::string m_lock_name;
+
+        /// Whole records waiting to be written
+        std::string m_buffer;
+
+        size_t m_buffered_records{ 0 };
+
+        /// Formatted size of the buffered records, without the newlines added to them
+        size_t m_buffered_bytes{ 0 };
+
+        int m_fd{ -1 };
+
+        int m_lock_fd{ -1 };
+
+        /// Identity of the file `m_fd` refers to, to notice rotations by other processes
+        ino_t m_inode{ 0 };
+
+        dev_t m_dev{ 0 };
+
+}; // End of Shared_File_Backend class
+
+} // End of tmns::log::impl::sinks namespace
+
+#endif // defined(__unix__) || defined(__APPLE__)
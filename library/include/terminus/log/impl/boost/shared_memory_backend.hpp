@@ -0,0 +1,87 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    shared_memory_backend.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+#if defined(__unix__) || defined(__APPLE__)
+
+// Project Libraries
+#include <terminus/log/impl/boost/record_codec.hpp>
+#include <terminus/log/impl/shared_ring.hpp>
+#include <terminus/log/impl/stats.hpp>
+
+// Boost Libraries
+#include <boost/log/core/record_view.hpp>
+#include <boost/log/sinks/basic_sink_backend.hpp>
+#include <boost/log/sinks/frontend_requirements.hpp>
+
+// C++ Libraries
+#include <memory>
+#include <string>
+
+namespace tmns::log::impl::sinks {
+
+/**
+ * Sink backend copying the attribute values of each record, unformatted, into a
+ * `Shared_Ring` read by `terminus_log_writerd`.  The writer process does the formatting
+ * and file I/O, so logging threads only encode the record and copy it into a slot.
+ *
+ * Records that do not fit in a slot, or that arrive while the ring is full, are dropped
+ * and counted in the sink's `records_dropped`.  The backend is safe to call from many
+ * threads at once, so it is used with an unlocked frontend.
+*/
+class Shared_Memory_Backend
+    : public boost::log::sinks::basic_sink_backend<boost::log::sinks::concurrent_feeding>
+{
+    public:
+
+        Shared_Memory_Backend( std::shared_ptr<ipc::Shared_Ring>     ring,
+                               std::shared_ptr<stats::Sink_Counters> counters )
+          : m_ring{ std::move( ring ) },
+            m_counters{ std::move( counters ) }
+        {
+        }
+
+        void consume( const boost::log::record_view& rec )
+        {
+            thread_local std::string buffer;
+            buffer.clear();
+            ipc::encode_record( rec, buffer );
+            if( m_ring->try_push( buffer ) )
+            {
+                m_counters->records_emitted.fetch_add( 1, std::memory_order_relaxed );
+                m_counters->bytes_written.fetch_add( buffer.size(), std::memory_order_relaxed );
+            }
+            else
+            {
+                m_counters->records_dropped.fetch_add( 1, std::memory_order_relaxed );
+            }
+        }
+
+        [[nodiscard]] const std::shared_ptr<ipc::Shared_Ring>& ring() const
+        {
+            return m_ring;
+        }
+
+    private:
+
+        std::shared_ptr<ipc::Shared_Ring> m_ring;
+
+        std::shared_ptr<stats::Sink_Counters> m_counters;
+
+}; // End of Shared_Memory_Backend class
+
+} // End of tmns::log::impl::sinks namespace
+
+#endif // defined(__unix__) || defined(__APPLE__)
@@ -0,0 +1,265 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    shared_source.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Boost Libraries
+#include <boost/log/attributes/attribute.hpp>
+#include <boost/log/attributes/attribute_set.hpp>
+#include <boost/log/attributes/constant.hpp>
+#include <boost/log/core/core.hpp>
+#include <boost/log/core/record.hpp>
+#include <boost/log/keywords/severity.hpp>
+#include <boost/log/trivial.hpp>
+
+// C++ Libraries
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace tmns::log::impl {
+
+/**
+ * Attributes of the records opened by a `Shared_Source`.  There is one attribute set per
+ * severity level, each holding a constant "Severity" attribute along with the "Scope" and
+ * any context fields, so opening a record only reads the set for the requested level.
+ *
+ * States are immutable once created.  The state of each scope is interned by the
+ * `Scope_Registry` and lives until the end of the program, while states created for
+ * child loggers are reference counted by the sources that point at them.
+*/
+class Source_State
+{
+    public:
+
+        using severity_level = boost::log::trivial::severity_level;
+
+        /**
+         * Creates the interned state of a scope.
+        */
+        explicit Source_State( std::string_view scope )
+          : m_interned{ true }
+        {
+            for( size_t level = 0; level < m_attributes.size(); ++level )
+            {
+                m_attributes[level].insert( "Severity", boost::log::attributes::constant<severity_level>(
+                                                            static_cast<severity_level>( level ) ) );
+                m_attributes[level].insert( "Scope", boost::log::attributes::constant<std::string>(
+                                                         std::string{ scope } ) );
+            }
+        }
+
+        /**
+         * Creates a reference counted copy of another state with an additional attribute.
+         * An attribute the state already has is not replaced.
+        */
+        Source_State( const Source_State&               parent,
+                      const boost::log::attribute_name& name,
+                      const boost::log::attribute&      attr )
+          : m_attributes{ parent.m_attributes },
+            m_interned{ false }
+        {
+            for( auto& set : m_attributes )
+            {
+                set.insert( name, attr );
+            }
+        }
+
+        Source_State( const Source_State& ) = delete;
+        Source_State& operator=( const Source_State& ) = delete;
+
+        [[nodiscard]] const boost::log::attribute_set& attributes( severity_level level ) const
+        {
+            return m_attributes[static_cast<size_t>( level )];
+        }
+
+        void add_reference() const
+        {
+            if( !m_interned )
+            {
+                m_references.fetch_add( 1, std::memory_order_relaxed );
+            }
+        }
+
+        void release() const
+        {
+            if( !m_interned && m_references.fetch_sub( 1, std::memory_order_acq_rel ) == 1 )
+            {
+                delete this;
+            }
+        }
+
+    private:
+
+        ~Source_State() = default;
+
+        friend class Scope_Registry;
+
+        std::array<boost::log::attribute_set,
+                   static_cast<size_t>( severity_level::fatal ) + 1> m_attributes;
+
+        /// Interned states are never released
+        const bool m_interned;
+
+        mutable std::atomic<uint32_t> m_references{ 1 };
+
+}; // End of Source_State class
+
+/**
+ * Process-wide table of the interned `Source_State` of every scope that a logger has
+ * been created for.  Looking up a known scope takes a shared lock and does not allocate.
+*/
+class Scope_Registry
+{
+    public:
+
+        static Scope_Registry& instance()
+        {
+            static Scope_Registry s_instance;
+            return s_instance;
+        }
+
+        /**
+         * Returns the state of the scope, creating it on first use.
+        */
+        const Source_State& intern( std::string_view scope )
+        {
+            {
+                std::shared_lock<std::shared_mutex> lock{ m_mutex };
+                if( auto it = m_states.find( scope ); it != m_states.end() )
+                {
+                    return *it->second;
+                }
+            }
+
+            std::lock_guard<std::shared_mutex> lock{ m_mutex };
+            auto [it, inserted] = m_states.try_emplace( std::string{ scope } );
+            if( inserted )
+            {
+                it->second.reset( new Source_State( scope ) );
+            }
+            return *it->second;
+        }
+
+    private:
+
+        Scope_Registry() = default;
+
+        struct Deleter
+        {
+            void operator()( Source_State* state ) const
+            {
+                delete state;
+            }
+        }; // End of Deleter struct
+
+        std::shared_mutex m_mutex;
+
+        std::map<std::string,std::unique_ptr<Source_State,Deleter>,std::less<>> m_states;
+
+}; // End of Scope_Registry class
+
+/**
+ * Record source that many threads can use at the same time without locking.  It is a
+ * drop-in replacement for the Boost.Log severity logger as far as `impl::write` is
+ * concerned.
+ *
+ * A source is a single pointer to a `Source_State`.  Creating a source for a scope looks
+ * up the scope's interned state, and copying a source only copies the pointer, so neither
+ * allocates.  `add_attribute` points the source at a new, reference counted state and
+ * leaves other copies unchanged.
+*/
+class Shared_Source
+{
+    public:
+
+        using char_type = char;
+
+        using severity_level = boost::log::trivial::severity_level;
+
+        /**
+         * Creates a source for the "global" scope.
+        */
+        Shared_Source() : Shared_Source( "global" )
+        {
+        }
+
+        /**
+         * Creates a source for the scope.
+        */
+        explicit Shared_Source( std::string_view scope )
+          : m_state{ &Scope_Registry::instance().intern( scope ) }
+        {
+        }
+
+        Shared_Source( const Shared_Source& other ) noexcept
+          : m_state{ other.m_state }
+        {
+            m_state->add_reference();
+        }
+
+        Shared_Source& operator=( const Shared_Source& other ) noexcept
+        {
+            other.m_state->add_reference();
+            m_state->release();
+            m_state = other.m_state;
+            return *this;
+        }
+
+        ~Shared_Source()
+        {
+            m_state->release();
+        }
+
+        /**
+         * Adds an attribute to every record opened by this source.  Other copies of the
+         * source are not affected.  An attribute the source already has is not replaced.
+        */
+        void add_attribute( const boost::log::attribute_name& name,
+                            const boost::log::attribute&      attr )
+        {
+            const Source_State* state = new Source_State( *m_state, name, attr );
+            m_state->release();
+            m_state = state;
+        }
+
+        /**
+         * Opens a record at the severity given by the `keywords::severity` argument.
+        */
+        template <typename ArgsT>
+        boost::log::record open_record( const ArgsT& args ) const
+        {
+            return boost::log::core::get()->open_record( m_state->attributes( args[boost::log::keywords::severity] ) );
+        }
+
+        void push_record( boost::log::record&& rec ) const
+        {
+            boost::log::core::get()->push_record( std::move( rec ) );
+        }
+
+    private:
+
+        const Source_State* m_state;
+
+}; // End of Shared_Source class
+
+} // End of tmns::log::impl namespace
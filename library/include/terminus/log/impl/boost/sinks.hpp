@@ -15,23 +15,52 @@
 #pragma once
 
 // Project Libraries
+#include <terminus/log/impl/boost/binary_format.hpp>
+#include <terminus/log/impl/boost/column_file_backend.hpp>
+#include <terminus/log/impl/boost/filter_compiler.hpp>
 #include <terminus/log/impl/boost/format.hpp>
+#include <terminus/log/impl/boost/format_compiler.hpp>
+#include <terminus/log/impl/boost/indexed_file_backend.hpp>
+#include <terminus/log/impl/boost/memory_backend.hpp>
+#include <terminus/log/impl/boost/queue.hpp>
+#include <terminus/log/impl/boost/shared_file_backend.hpp>
+#include <terminus/log/impl/boost/shared_memory_backend.hpp>
+#include <terminus/log/impl/boost/sharded_file_backend.hpp>
+#include <terminus/log/impl/boost/unix_socket_backend.hpp>
+#include <terminus/log/impl/stats.hpp>
 
 // Boost Libraries
 #include <boost/algorithm/string/case_conv.hpp>
+#include <boost/core/null_deleter.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <boost/filesystem/path.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/log/core/core.hpp>
 #include <boost/log/expressions/filter.hpp>
 #include <boost/log/sinks/async_frontend.hpp>
+#include <boost/log/sinks/basic_sink_backend.hpp>
 #include <boost/log/sinks/sync_frontend.hpp>
 #include <boost/log/sinks/text_file_backend.hpp>
+#include <boost/log/sinks/text_ostream_backend.hpp>
+#include <boost/log/sinks/unlocked_frontend.hpp>
 #include <boost/log/utility/setup/file.hpp>
+#include <boost/log/utility/setup/filter_parser.hpp>
+#include <boost/log/utility/setup/formatter_parser.hpp>
 #include <boost/log/utility/setup/from_settings.hpp>
 #include <boost/shared_ptr.hpp>
 
 // C++ Libraries
+#include <array>
+#include <cctype>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <sstream>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
+#include <utility>
 
 namespace tmns::log::impl::sinks {
 
@@ -60,49 +89,1024 @@ inline bool cast_to_bool( const std::string&     val,
     }
 }
 
+/**
+ * Sink backend that reports every record it consumes, and the number of formatted bytes,
+ * to the sink's counters after handing the record to the wrapped backend.  Backends whose
+ * `consume` returns a bool report the records they drop by returning false, and those
+ * records are not counted as emitted.  Backends that write records after `consume`
+ * returns, such as from a thread of their own, declare `REPORTS_OWN_OUTPUT = true` and
+ * count emitted records and bytes themselves once they are written.  When timed, the time
+ * spent in the wrapped backend is reported as well.
+*/
+template <typename BackendT>
+class Counting_Backend : public BackendT
+{
+    public:
+
+        using string_type = typename BackendT::string_type;
+
+        /**
+         * Constructs the wrapped backend from the remaining arguments.
+        */
+        template <typename... ArgsT>
+        explicit Counting_Backend( std::shared_ptr<stats::Sink_Counters> counters,
+                                   ArgsT&&...                            args )
+          : BackendT( std::forward<ArgsT>( args )... ),
+            m_counters{ std::move( counters ) }
+        {
+        }
+
+        void consume( const boost::log::record_view& rec,
+                      const string_type&             formatted_message )
+        {
+            bool written = false;
+            if( m_timed )
+            {
+                auto start = std::chrono::steady_clock::now();
+                written = forward( rec, formatted_message );
+                auto elapsed = std::chrono::steady_clock::now() - start;
+                m_counters->backend_nanoseconds.fetch_add(
+                    static_cast<uint64_t>( std::chrono::duration_cast<std::chrono::nanoseconds>( elapsed ).count() ),
+                    std::memory_order_relaxed );
+            }
+            else
+            {
+                written = forward( rec, formatted_message );
+            }
+            if( written && !reports_own_output() )
+            {
+                m_counters->records_emitted.fetch_add( 1, std::memory_order_relaxed );
+                m_counters->bytes_written.fetch_add( formatted_message.size(), std::memory_order_relaxed );
+            }
+        }
+
+        [[nodiscard]] const std::shared_ptr<stats::Sink_Counters>& counters() const
+        {
+            return m_counters;
+        }
+
+        /**
+         * Whether the time spent in the wrapped backend is reported.  Must be set before the
+         * sink is added to the core.
+        */
+        [[nodiscard]] bool timed() const
+        {
+            return m_timed;
+        }
+
+        void set_timed( bool timed )
+        {
+            m_timed = timed;
+        }
+
+    private:
+
+        /**
+         * Whether the wrapped backend counts its emitted records and bytes itself.
+        */
+        static constexpr bool reports_own_output()
+        {
+            if constexpr( requires { BackendT::REPORTS_OWN_OUTPUT; } )
+            {
+                return BackendT::REPORTS_OWN_OUTPUT;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        /**
+         * Hands the record to the wrapped backend and returns false if it was dropped.
+        */
+        bool forward( const boost::log::record_view& rec,
+                      const string_type&             formatted_message )
+        {
+            if constexpr( std::is_same_v<decltype( BackendT::consume( rec, formatted_message ) ), bool> )
+            {
+                return BackendT::consume( rec, formatted_message );
+            }
+            else
+            {
+                BackendT::consume( rec, formatted_message );
+                return true;
+            }
+        }
+
+        std::shared_ptr<stats::Sink_Counters> m_counters;
+
+        bool m_timed{ false };
+
+}; // End of Counting_Backend class
+
+/**
+ * Formatter wrapper that accumulates the number of calls and the time spent in the
+ * wrapped formatter.
+*/
+class Timed_Formatter
+{
+    public:
+
+        Timed_Formatter( boost::log::formatter                 formatter,
+                         std::shared_ptr<stats::Sink_Counters> counters )
+          : m_formatter{ std::move( formatter ) },
+            m_counters{ std::move( counters ) }
+        {
+        }
+
+        void operator()( const boost::log::record_view&  rec,
+                         boost::log::formatting_ostream& stream ) const
+        {
+            auto start = std::chrono::steady_clock::now();
+            m_formatter( rec, stream );
+            auto elapsed = std::chrono::steady_clock::now() - start;
+
+            m_counters->format_calls.fetch_add( 1, std::memory_order_relaxed );
+            m_counters->format_nanoseconds.fetch_add(
+                static_cast<uint64_t>( std::chrono::duration_cast<std::chrono::nanoseconds>( elapsed ).count() ),
+                std::memory_order_relaxed );
+        }
+
+    private:
+
+        boost::log::formatter m_formatter;
+
+        std::shared_ptr<stats::Sink_Counters> m_counters;
+
+}; // End of Timed_Formatter class
+
+/**
+ * Filter wrapper that accumulates the number of calls and the time spent in the wrapped
+ * filter.
+*/
+class Timed_Filter
+{
+    public:
+
+        Timed_Filter( boost::log::filter                    filter,
+                      std::shared_ptr<stats::Sink_Counters> counters )
+          : m_filter{ std::move( filter ) },
+            m_counters{ std::move( counters ) }
+        {
+        }
+
+        bool operator()( const boost::log::attribute_value_set& values ) const
+        {
+            auto start = std::chrono::steady_clock::now();
+            const bool accepted = m_filter( values );
+            auto elapsed = std::chrono::steady_clock::now() - start;
+
+            m_counters->filter_calls.fetch_add( 1, std::memory_order_relaxed );
+            m_counters->filter_nanoseconds.fetch_add(
+                static_cast<uint64_t>( std::chrono::duration_cast<std::chrono::nanoseconds>( elapsed ).count() ),
+                std::memory_order_relaxed );
+            return accepted;
+        }
+
+    private:
+
+        boost::log::filter m_filter;
+
+        std::shared_ptr<stats::Sink_Counters> m_counters;
+
+}; // End of Timed_Filter class
+
+/**
+ * Wraps a backend in a synchronous or asynchronous frontend, depending on the
+ * "Asynchronous" setting, and applies the "Filter" setting and the formatter.  The
+ * severity levels the filter may accept are reported to the `Severity_Threshold`.
+ *
+ * With `Timing=true`, the time spent in the sink's filter and backend is reported
+ * alongside the formatter time, so a record's cost can be split by stage.  The default is
+ * the backend's own `timed()` setting.
+ *
+ * Asynchronous sinks are bounded by the "QueueCapacity" setting (unbounded when missing
+ * or zero) and handle a full queue according to "OverflowPolicy", which is one of
+ * "Block" (the default), "DropNewest", or "DropOldest".  See `Bounded_Queue`.
+ *
+ * Asynchronous sinks count the records they fail to write as dropped instead of
+ * letting the exception escape the feeding thread.
+*/
+template <typename BackendT>
+boost::shared_ptr<boost::log::sinks::sink> make_sink( boost::shared_ptr<Counting_Backend<BackendT>> backend,
+                                                      const boost::log::settings_section&           settings,
+                                                      boost::log::formatter                         formatter )
+{
+    auto counters = backend->counters();
+
+    // Filter
+    boost::log::filter filt;
+    Severity_Mask levels = ALL_SEVERITIES;
+    if( boost::optional<std::string> oFilter = settings["Filter"] )
+    {
+        filt   = filter::compile_filter( *oFilter );
+        levels = filter::severity_mask( *oFilter );
+    }
+
+    // Timing
+    if( boost::optional<std::string> oTiming = settings["Timing"] )
+    {
+        backend->set_timed( cast_to_bool( *oTiming, "Timing" ) );
+    }
+    if( backend->timed() )
+    {
+        filt = Timed_Filter{ std::move( filt ), counters };
+    }
+
+    // Define and configure the sink frontend
+    bool async = false;
+    if( boost::optional<std::string> oAsync = settings["Asynchronous"])
+    {
+        async = cast_to_bool( *oAsync, "Asynchronous" );
+    }
+
+    if( !async )
+    {
+        using SinkType = boost::log::sinks::synchronous_sink<Counting_Backend<BackendT>>;
+        auto pSink = boost::make_shared<SinkType>( backend );
+        pSink->set_filter( filt );
+        pSink->set_formatter( Timed_Formatter{ std::move( formatter ), counters } );
+        Severity_Threshold::instance().add_sink( pSink, levels );
+        return pSink;
+    }
+    else
+    {
+        size_t capacity = 0;
+        if( boost::optional<std::string> oCapacity = settings["QueueCapacity"] )
+        {
+            capacity = boost::lexical_cast<size_t>( *oCapacity );
+        }
+
+        Overflow_Policy policy = Overflow_Policy::BLOCK;
+        if( boost::optional<std::string> oPolicy = settings["OverflowPolicy"] )
+        {
+            policy = parse_overflow_policy( *oPolicy );
+        }
+
+        using SinkType = boost::log::sinks::asynchronous_sink<Counting_Backend<BackendT>,Bounded_Queue>;
+        auto pSink = boost::make_shared<SinkType>( backend,
+                                                   keywords::sink_counters   = counters,
+                                                   keywords::queue_capacity  = capacity,
+                                                   keywords::overflow_policy = policy );
+        pSink->set_filter( filt );
+        pSink->set_formatter( Timed_Formatter{ std::move( formatter ), counters } );
+        pSink->set_exception_handler( [counters]()
+        {
+            counters->records_dropped.fetch_add( 1, std::memory_order_relaxed );
+        });
+        Severity_Threshold::instance().add_sink( pSink, levels );
+        return pSink;
+    }
+}
+
+/**
+ * Applies the "Filter" setting to a sink that is not created by `make_sink()`, and reports
+ * the severity levels the filter may accept to the `Severity_Threshold`.
+*/
+template <typename SinkT>
+void apply_filter_setting( const boost::shared_ptr<SinkT>&     sink,
+                           const boost::log::settings_section& settings )
+{
+    Severity_Mask levels = ALL_SEVERITIES;
+    if( boost::optional<std::string> oFilter = settings["Filter"] )
+    {
+        sink->set_filter( filter::compile_filter( *oFilter ) );
+        levels = filter::severity_mask( *oFilter );
+    }
+    Severity_Threshold::instance().add_sink( sink, levels );
+}
+
+/**
+ * Returns the name the sink's counters are reported under.  The configuration functions
+ * set "Name" to the name of the sink's INI section.
+*/
+inline std::string sink_name( const boost::log::settings_section& settings,
+                              const std::string&                  destination )
+{
+    if( boost::optional<std::string> oName = settings["Name"] )
+    {
+        return *oName;
+    }
+    return destination;
+}
+
+/**
+ * Parses the "RotationTimePoint" setting, using the same syntax as Boost.Log's
+ * TextFile sink: `[Weekday | Day] HH:MM:SS`.
+*/
+inline boost::log::sinks::file::rotation_at_time_point parse_rotation_time_point( const std::string& value )
+{
+    std::istringstream input{ value };
+    std::string first, time;
+    input >> first >> time;
+    if( time.empty() )
+    {
+        time = first;
+        first.clear();
+    }
+
+    unsigned int hour = 0, minute = 0, second = 0;
+    char sep1 = 0, sep2 = 0;
+    std::istringstream time_input{ time };
+    if( !( time_input >> hour >> sep1 >> minute >> sep2 >> second ) ||
+        sep1 != ':' || sep2 != ':' || hour > 23 || minute > 59 || second > 59 )
+    {
+        throw std::runtime_error( "Invalid RotationTimePoint \"" + value + "\": expected [Weekday | Day] HH:MM:SS" );
+    }
+    auto h = static_cast<unsigned char>( hour );
+    auto m = static_cast<unsigned char>( minute );
+    auto s = static_cast<unsigned char>( second );
+
+    if( first.empty() )
+    {
+        return boost::log::sinks::file::rotation_at_time_point( h, m, s );
+    }
+    if( std::isdigit( static_cast<unsigned char>( first.front() ) ) )
+    {
+        auto day = boost::lexical_cast<unsigned short>( first );
+        return boost::log::sinks::file::rotation_at_time_point( boost::gregorian::greg_day( day ), h, m, s );
+    }
+
+    static const std::array<const char*,7> WEEKDAYS { "sunday", "monday", "tuesday", "wednesday",
+                                                      "thursday", "friday", "saturday" };
+    auto lday = boost::algorithm::to_lower_copy( first );
+    for( size_t i = 0; i < WEEKDAYS.size(); ++i )
+    {
+        std::string_view full{ WEEKDAYS[i] };
+        if( lday == full || lday == full.substr( 0, 3 ) )
+        {
+            return boost::log::sinks::file::rotation_at_time_point(
+                static_cast<boost::date_time::weekdays>( i ), h, m, s );
+        }
+    }
+    throw std::runtime_error( "Invalid RotationTimePoint \"" + value + "\": unknown day \"" + first + "\"" );
+}
+
+/**
+ * Applies the file related settings shared by the "TextFile" and "JsonFile" sinks to
+ * the backend.  Each rotation of the file is reported to the sink's counters when the next
+ * file is opened.
+*/
+template <typename BackendT>
+void configure_file_backend( Counting_Backend<BackendT>&         backend,
+                             const boost::log::settings_section& settings,
+                             const std::string&                  destination )
+{
+    namespace kw = boost::log::keywords;
+
+    // Active file name
+    if( boost::optional<std::string> ofile = settings["FileName"] )
+    {
+        backend.set_file_name_pattern( *ofile );
+    }
+    else
+    {
+        throw std::runtime_error( R"(Missing "FileName" field in ")" + destination + R"(" sink)" );
+    }
+
+    // Target file name
+    if( boost::optional<std::string> otarget = settings["TargetFileName"])
+    {
+        backend.set_target_file_name_pattern( *otarget );
+    }
+
+    // Rotation Size
+    if( boost::optional<std::string> orotation_size = settings["RotationSize"] )
+    {
+        backend.set_rotation_size( boost::lexical_cast<uintmax_t>( *orotation_size ) );
+    }
+
+    // Time-based rotation, either a fixed interval in seconds or a point in time
+    if( boost::optional<std::string> ointerval = settings["RotationInterval"] )
+    {
+        backend.set_time_based_rotation( boost::log::sinks::file::rotation_at_time_interval(
+            boost::posix_time::seconds( boost::lexical_cast<long>( *ointerval ) ) ) );
+    }
+    else if( boost::optional<std::string> otime_point = settings["RotationTimePoint"] )
+    {
+        backend.set_time_based_rotation( parse_rotation_time_point( *otime_point ) );
+    }
+
+    // Final Rotation
+    if( boost::optional<std::string> enable_final_rot = settings["EnableFinalRotation"] )
+    {
+        backend.enable_final_rotation( cast_to_bool( *enable_final_rot,
+                                                     "EnableFinalRotation" ) );
+    }
+
+    // Auto newline mode
+    if( boost::optional<std::string> auto_nl = settings["AutoNewline"] )
+    {
+        const auto& val = *auto_nl;
+        if( val == "Disabled" )
+        {
+            backend.set_auto_newline_mode( boost::log::sinks::disabled_auto_newline );
+        }
+        else if( val == "AlwaysInsert" )
+        {
+            backend.set_auto_newline_mode( boost::log::sinks::always_insert );
+        }
+        else if( val == "InsertIfMissing" )
+        {
+            backend.set_auto_newline_mode( boost::log::sinks::insert_if_missing );
+        }
+        else
+        {
+            std::string message = "Unsupported auto newline mode \"";
+            message += val;
+            message += "\" in " + destination + " configuration";
+            throw std::runtime_error( std::move( message ));
+        }
+    }
+
+    // Auto flush
+    if( boost::optional<std::string> do_auto_flush = settings["AutoFlush"] )
+    {
+        backend.auto_flush( cast_to_bool( *do_auto_flush, "AutoFlush" ) );
+    }
+
+    // Append
+    if( boost::optional<std::string> do_append = settings["Append"] )
+    {
+        if( cast_to_bool( *do_append, "Append" ) )
+        {
+            backend.set_open_mode( std::ios_base::out | std::ios_base::app );
+        }
+    }
+
+    // Target Directory
+    if( boost::optional<std::string> o_target = settings["Target"] )
+    {
+        boost::filesystem::path target_dir( *o_target );
+
+        // Max Total Size
+        uintmax_t max_size = std::numeric_limits<uintmax_t>::max();
+        if( boost::optional<std::string> oMaxSize = settings["MaxSize"] )
+        {
+            max_size = boost::lexical_cast<uintmax_t>( *oMaxSize );
+        }
+
+        // Min Free Space
+        uintmax_t space = 0;
+        if( boost::optional<std::string> oMinSpace = settings["MinFreeSpace"] )
+        {
+            space = boost::lexical_cast<uintmax_t>( *oMinSpace );
+        }
+
+        // Max Number of Files
+        uintmax_t max_files = std::numeric_limits<uintmax_t>::max();
+        if( boost::optional<std::string> oMaxSize = settings["MaxFiles"] )
+        {
+            max_files = boost::lexical_cast<uintmax_t>( *oMaxSize );
+        }
+
+        backend.set_file_collector( boost::log::sinks::file::make_collector(
+            kw::target = target_dir,
+            kw::max_size = max_size,
+            kw::min_free_space = space,
+            kw::max_files = max_files
+        ));
+
+        // Scan for log files
+        if( boost::optional<std::string> oScanForFiles = settings["ScanForFiles"] )
+        {
+            const auto& scanForFiles = *oScanForFiles;
+            if( scanForFiles == "All" )
+            {
+                backend.scan_for_files( boost::log::sinks::file::scan_all );
+            }
+            else if( scanForFiles == "Matching" )
+            {
+                backend.scan_for_files( boost::log::sinks::file::scan_matching );
+            }
+            else
+            {
+                std::string message = "Unsupported scan method \"";
+                message += scanForFiles;
+                message += "\" in " + destination + " configuration";
+                throw std::runtime_error( std::move( message ));
+            }
+        }
+    }
+
+    // Every file opened after the first one follows a rotation.  Counting closes instead
+    // would also count the final close when the sink is destroyed.
+    backend.set_open_handler( [counters = backend.counters(), opened = false]( std::ostream& ) mutable
+    {
+        if( opened )
+        {
+            counters->rotations.fetch_add( 1, std::memory_order_relaxed );
+        }
+        opened = true;
+    });
+}
+
+/**
+ * Returns the formatter compiled from the sink's "Format" setting, or Boost.Log's default
+ * formatter (message only) when the setting is missing.
+*/
+inline boost::log::formatter parse_format_setting( const boost::log::settings_section& settings )
+{
+    if( boost::optional<std::string> oFormat = settings["Format"] )
+    {
+        return format::compile_formatter( *oFormat );
+    }
+    return boost::log::formatter{};
+}
+
+/**
+ * Returns the formatter of a structured encoding: `format::json`, `format::cbor`, or
+ * `format::msgpack`.
+*/
+inline boost::log::formatter structured_formatter( format::Encoding encoding )
+{
+    switch( encoding )
+    {
+        case format::Encoding::CBOR:
+            return &format::cbor;
+        case format::Encoding::MSGPACK:
+            return &format::msgpack;
+        default:
+            return &format::json;
+    }
+}
+
+/**
+ * Sink backend of the "Null" sink, which discards every formatted record.
+*/
+class Null_Backend
+    : public boost::log::sinks::basic_formatted_sink_backend<char,boost::log::sinks::concurrent_feeding>
+{
+    public:
+
+        void consume( const boost::log::record_view&,
+                      const string_type& )
+        {
+        }
+
+}; // End of Null_Backend class
+
+/**
+ * Sink factory for the "Null" destination, which runs the sink pipeline and discards the
+ * result.  Its filter, formatter, and backend are always timed (see `make_sink()`), so
+ * comparing its counters with the cost of a whole log call separates the front end, such
+ * as attribute assembly, from formatting and I/O.
+ *
+ * Records are only formatted when "Format" or "Encoding" ("Text", "Json", "Cbor", or
+ * "MsgPack") is set.  Every other setting of `make_sink()` applies, including
+ * "Asynchronous" and `Timing=false`.
+*/
+class Null_Sink_Factory : public boost::log::sink_factory<char>
+{
+    public:
+
+        boost::shared_ptr<boost::log::sinks::sink> create_sink( const settings_section& settings )
+        {
+            // Without a format, the formatter writes nothing
+            boost::log::formatter formatter = []( const boost::log::record_view&, boost::log::formatting_ostream& ){};
+            if( settings["Format"] )
+            {
+                formatter = parse_format_setting( settings );
+            }
+            if( boost::optional<std::string> oEncoding = settings["Encoding"] )
+            {
+                auto encoding = format::parse_encoding( *oEncoding );
+                if( encoding != format::Encoding::TEXT )
+                {
+                    formatter = structured_formatter( encoding );
+                }
+                else if( !settings["Format"] )
+                {
+                    formatter = boost::log::formatter{};
+                }
+            }
+
+            auto counters = stats::Registry::instance().register_sink( sink_name( settings, "Null" ) );
+            auto p_sink_backend = boost::make_shared<Counting_Backend<Null_Backend>>( counters );
+            p_sink_backend->set_timed( true );
+            return make_sink( p_sink_backend, settings, std::move( formatter ) );
+        }
+
+}; // End of Null_Sink_Factory class
+
+/**
+ * Returns true if the "Index" setting asks for a sidecar index of each file.
+*/
+inline bool is_indexed( const boost::log::settings_section& settings )
+{
+    if( boost::optional<std::string> oIndex = settings["Index"] )
+    {
+        return cast_to_bool( *oIndex, "Index" );
+    }
+    return false;
+}
+
+/**
+ * Creates the backend of a "TextFile" or "JsonFile" sink with `Index=true`.  See
+ * `Indexed_File_Backend`.
+ *
+ * "IndexInterval" sets the seconds of records per index block (1 by default).  The file
+ * settings apply as usual, except "TargetFileName" and "Target", since the index is
+ * written next to the file before Boost.Log would move it.
+*/
+inline boost::shared_ptr<Counting_Backend<Indexed_File_Backend<boost::log::sinks::text_file_backend>>>
+    make_indexed_file_backend( const boost::log::settings_section&   settings,
+                               const std::string&                    destination,
+                               std::shared_ptr<stats::Sink_Counters> counters )
+{
+    for( const char* unsupported : { "TargetFileName", "Target" } )
+    {
+        if( boost::optional<std::string> oValue = settings[unsupported] )
+        {
+            throw std::runtime_error( std::string{ "\"" } + unsupported + "\" is not supported with Index=true in \"" +
+                                      destination + "\" sink" );
+        }
+    }
+
+    int64_t interval = 1;
+    if( boost::optional<std::string> ointerval = settings["IndexInterval"] )
+    {
+        interval = boost::lexical_cast<int64_t>( *ointerval );
+        if( interval <= 0 )
+        {
+            throw std::runtime_error( "\"IndexInterval\" must be positive in \"" + destination + "\" sink" );
+        }
+    }
+
+    auto backend = boost::make_shared<Counting_Backend<Indexed_File_Backend<boost::log::sinks::text_file_backend>>>(
+        counters, interval * 1000000, counters );
+    configure_file_backend( *backend, settings, destination );
+    backend->enable_index();
+    return backend;
+}
+
+/**
+ * Returns true if the "MultiProcess" setting asks for a file shared with other processes.
+*/
+inline bool is_multi_process( const boost::log::settings_section& settings )
+{
+    if( boost::optional<std::string> oMulti = settings["MultiProcess"] )
+    {
+        return cast_to_bool( *oMulti, "MultiProcess" );
+    }
+    return false;
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+/**
+ * Creates the backend of a "TextFile" or "JsonFile" sink with `MultiProcess=true`.  See
+ * `Shared_File_Backend`.
+ *
+ * The file is always appended to.  "FileName" must be a plain path, because every process
+ * must name the same file, and the settings for Boost.Log's file collector and time-based
+ * rotation are not supported.  "BufferSize" sets the bytes of records buffered per write
+ * (`PIPE_BUF` by default), and "RotationSize" and "AutoFlush" apply as usual.
+*/
+inline boost::shared_ptr<Counting_Backend<Shared_File_Backend>>
+    make_shared_file_backend( const boost::log::settings_section&   settings,
+                              const std::string&                    destination,
+                              std::shared_ptr<stats::Sink_Counters> counters )
+{
+    Shared_File_Options options;
+    if( boost::optional<std::string> ofile = settings["FileName"] )
+    {
+        if( ofile->find( '%' ) != std::string::npos )
+        {
+            throw std::runtime_error( "FileName patterns are not supported with MultiProcess=true in \"" + destination + "\" sink" );
+        }
+        options.file_name = *ofile;
+    }
+    else
+    {
+        throw std::runtime_error( R"(Missing "FileName" field in ")" + destination + R"(" sink)" );
+    }
+
+    for( const char* unsupported : { "TargetFileName", "RotationInterval", "RotationTimePoint", "Target", "Index" } )
+    {
+        if( boost::optional<std::string> oValue = settings[unsupported] )
+        {
+            throw std::runtime_error( std::string{ "\"" } + unsupported + "\" is not supported with MultiProcess=true in \"" +
+                                      destination + "\" sink" );
+        }
+    }
+
+    if( boost::optional<std::string> orotation_size = settings["RotationSize"] )
+    {
+        options.rotation_size = boost::lexical_cast<uintmax_t>( *orotation_size );
+    }
+    if( boost::optional<std::string> obuffer_size = settings["BufferSize"] )
+    {
+        options.buffer_size = boost::lexical_cast<size_t>( *obuffer_size );
+    }
+    if( boost::optional<std::string> do_auto_flush = settings["AutoFlush"] )
+    {
+        options.auto_flush = cast_to_bool( *do_auto_flush, "AutoFlush" );
+    }
+    return boost::make_shared<Counting_Backend<Shared_File_Backend>>( counters, std::move( options ), counters );
+}
+#endif // defined(__unix__) || defined(__APPLE__)
+
+/**
+ * Returns true if the "FileName" setting contains "%T", which writes each thread's records
+ * to its own file.
+*/
+inline bool is_sharded( const boost::log::settings_section& settings )
+{
+    boost::optional<std::string> ofile = settings["FileName"];
+    return ofile && ofile->find( "%T" ) != std::string::npos;
+}
+
+/**
+ * Creates a "TextFile" or "JsonFile" sink whose "FileName" contains "%T".  See
+ * `Sharded_File_Backend`.
+ *
+ * The sink uses an unlocked frontend, so threads format and write their records without
+ * waiting for each other, and its formatter time is not reported to the statistics.
+ * "Append", "AutoFlush", "BufferSize" (64 KiB), "Format", and "Filter" apply; rotation,
+ * the file collector, "MultiProcess", and "Asynchronous" are not supported.
+*/
+inline boost::shared_ptr<boost::log::sinks::sink> make_sharded_sink( const boost::log::settings_section&   settings,
+                                                                     const std::string&                    destination,
+                                                                     std::shared_ptr<stats::Sink_Counters> counters,
+                                                                     boost::log::formatter                 formatter )
+{
+    for( const char* unsupported : { "TargetFileName", "RotationSize", "RotationInterval", "RotationTimePoint",
+                                     "Target", "MultiProcess", "Asynchronous", "Index" } )
+    {
+        if( boost::optional<std::string> oValue = settings[unsupported] )
+        {
+            throw std::runtime_error( std::string{ "\"" } + unsupported + "\" is not supported with a %T FileName in \"" +
+                                      destination + "\" sink" );
+        }
+    }
+
+    Sharded_File_Options options;
+    options.file_name = *settings["FileName"].get();
+    if( boost::optional<std::string> do_append = settings["Append"] )
+    {
+        options.append = cast_to_bool( *do_append, "Append" );
+    }
+    if( boost::optional<std::string> do_auto_flush = settings["AutoFlush"] )
+    {
+        options.auto_flush = cast_to_bool( *do_auto_flush, "AutoFlush" );
+    }
+    if( boost::optional<std::string> obuffer_size = settings["BufferSize"] )
+    {
+        options.buffer_size = boost::lexical_cast<size_t>( *obuffer_size );
+    }
+
+    auto backend = boost::make_shared<Sharded_File_Backend>( std::move( options ), std::move( counters ) );
+    auto pSink = boost::make_shared<boost::log::sinks::unlocked_sink<Sharded_File_Backend>>( backend );
+    pSink->set_formatter( std::move( formatter ) );
+    apply_filter_setting( pSink, settings );
+    return pSink;
+}
+
+/**
+ * Creates a "JsonFile" sink whose "Encoding" is "Cbor" or "MsgPack".  Records are written
+ * back to back with no newline, since each encoded record delimits itself.  Sinks reading
+ * files line by line do not apply, so "%T" in "FileName", "MultiProcess", and "Index" are
+ * not supported.
+*/
+inline boost::shared_ptr<boost::log::sinks::sink> make_binary_file_sink( const boost::log::settings_section&   settings,
+                                                                         format::Encoding                      encoding,
+                                                                         std::shared_ptr<stats::Sink_Counters> counters )
+{
+    if( is_sharded( settings ) )
+    {
+        throw std::runtime_error( R"(A %T FileName is not supported with a binary Encoding in "JsonFile" sink)" );
+    }
+    for( const char* unsupported : { "MultiProcess", "Index" } )
+    {
+        if( boost::optional<std::string> oValue = settings[unsupported] )
+        {
+            throw std::runtime_error( std::string{ "\"" } + unsupported +
+                                      "\" is not supported with a binary Encoding in \"JsonFile\" sink" );
+        }
+    }
+
+    auto p_sink_backend = boost::make_shared<Counting_Backend<boost::log::sinks::text_file_backend>>( counters );
+    configure_file_backend( *p_sink_backend, settings, "JsonFile" );
+    p_sink_backend->set_auto_newline_mode( boost::log::sinks::disabled_auto_newline );
+    return make_sink( p_sink_backend, settings, structured_formatter( encoding ) );
+}
+
 /**
  * Creates Sinks that consume log records and write them to a JSON file.
  * The factory is used when the Boost.Log settings file is read and one of
  * the sinks has a Destination field set to "JsonFile".
  *
- * The "JsonFile" sink supports all of the same properties as TextFile sink
- * except the time-based rotation fields.  These are too complicated to replicate.
+ * The "JsonFile" sink supports all of the same properties as the "TextFile" sink,
+ * except "Format".  With `Encoding=Cbor` or `Encoding=MsgPack`, records are written in
+ * that binary encoding instead; see `make_binary_file_sink()`.
 */
 class Json_File_Sink_Factory : public boost::log::sink_factory<char>
 {
     public:
 
-        using SinkBackendType = boost::log::sinks::text_file_backend;
+        using SinkBackendType = Counting_Backend<boost::log::sinks::text_file_backend>;
 
         boost::shared_ptr<boost::log::sinks::sink> create_sink( const settings_section& settings )
         {
-            namespace kw = boost::log::keywords;
+            auto encoding = format::Encoding::JSON;
+            if( boost::optional<std::string> oEncoding = settings["Encoding"] )
+            {
+                encoding = format::parse_encoding( *oEncoding );
+                if( encoding == format::Encoding::TEXT )
+                {
+                    throw std::runtime_error( R"(Encoding "Text" is not supported in "JsonFile" sink)" );
+                }
+            }
+
+            auto counters = stats::Registry::instance().register_sink( sink_name( settings, "JsonFile" ) );
+            if( encoding != format::Encoding::JSON )
+            {
+                return make_binary_file_sink( settings, encoding, counters );
+            }
+            if( is_sharded( settings ) )
+            {
+                return make_sharded_sink( settings, "JsonFile", counters, &format::json );
+            }
+#if defined(__unix__) || defined(__APPLE__)
+            if( is_multi_process( settings ) )
+            {
+                return make_sink( make_shared_file_backend( settings, "JsonFile", counters ), settings, &format::json );
+            }
+#endif
+            if( is_indexed( settings ) )
+            {
+                return make_sink( make_indexed_file_backend( settings, "JsonFile", counters ), settings, &format::json );
+            }
+            auto p_sink_backend = boost::make_shared<SinkBackendType>( counters );
+            configure_file_backend( *p_sink_backend, settings, "JsonFile" );
+            return make_sink( p_sink_backend, settings, &format::json );
+        }
+
+}; // End of JSON File Sync Factory
+
+/**
+ * Creates sinks writing records to a columnar file, used when a sink's Destination field
+ * is set to "ColumnFile".  See `Column_File_Backend`.  The records are not formatted, so
+ * "Format" does not apply, and blocks already batch the writes, so neither does
+ * "Asynchronous".
+ *
+ * Settings, besides "Filter":
+ *
+ * - "FileName": path of the file (required)
+ * - "BlockSize": records per block (65536)
+ * - "Append": "true" to add blocks to an existing columnar file ("false")
+*/
+class Column_File_Sink_Factory : public boost::log::sink_factory<char>
+{
+    public:
 
-            // Construct an empty backend
-            auto p_sink_backend = boost::make_shared<boost::log::sinks::text_file_backend>();
+        boost::shared_ptr<boost::log::sinks::sink> create_sink( const settings_section& settings )
+        {
+            for( const char* unsupported : { "Format", "Asynchronous", "TargetFileName", "Target", "RotationSize",
+                                             "RotationInterval", "RotationTimePoint", "MultiProcess", "Index" } )
+            {
+                if( boost::optional<std::string> oValue = settings[unsupported] )
+                {
+                    throw std::runtime_error( std::string{ "\"" } + unsupported + "\" is not supported in \"ColumnFile\" sink" );
+                }
+            }
 
-            // Active file name
-            if( boost::optional<std::string> ofile = settings["FileName"] )
+            Column_File_Options options;
+            if( boost::optional<std::string> oFile = settings["FileName"] )
             {
-                p_sink_backend->set_file_name_pattern( *ofile );
+                options.file_name = *oFile;
             }
             else
             {
-                throw std::runtime_error( R"(Missing "FileName" field in "JsonFile" sink)" );
+                throw std::runtime_error( R"(Missing "FileName" field in "ColumnFile" sink)" );
+            }
+            if( boost::optional<std::string> oBlock = settings["BlockSize"] )
+            {
+                options.block_size = boost::lexical_cast<uint32_t>( *oBlock );
+                if( options.block_size == 0 )
+                {
+                    throw std::runtime_error( R"("BlockSize" must be greater than 0 in "ColumnFile" sink)" );
+                }
+            }
+            if( boost::optional<std::string> do_append = settings["Append"] )
+            {
+                options.append = cast_to_bool( *do_append, "Append" );
             }
 
-            // Target file name
-            if( boost::optional<std::string> otarget = settings["TargetFileName"])
+            auto counters = stats::Registry::instance().register_sink( sink_name( settings, "ColumnFile" ) );
+            auto backend = boost::make_shared<Column_File_Backend>( std::move( options ), std::move( counters ) );
+            auto pSink = boost::make_shared<boost::log::sinks::synchronous_sink<Column_File_Backend>>( backend );
+            apply_filter_setting( pSink, settings );
+            return pSink;
+        }
+
+}; // End of Column_File_Sink_Factory class
+
+/**
+ * Sink factory for the "Memory" destination, which keeps records as `Captured_Record`
+ * snapshots in a `Memory_Buffer` instead of formatting them.  The buffer is found by the
+ * sink's name with `Memory_Registry`.
+ *
+ * Settings, besides "Filter":
+ *
+ * - "Capacity": records held before the oldest are replaced (4096)
+*/
+class Memory_Sink_Factory : public boost::log::sink_factory<char>
+{
+    public:
+
+        static constexpr size_t DEFAULT_CAPACITY = 4096;
+
+        boost::shared_ptr<boost::log::sinks::sink> create_sink( const settings_section& settings )
+        {
+            for( const char* unsupported : { "Format", "Asynchronous" } )
             {
-                p_sink_backend->set_target_file_name_pattern( *otarget );
+                if( boost::optional<std::string> oValue = settings[unsupported] )
+                {
+                    throw std::runtime_error( std::string{ "\"" } + unsupported + "\" is not supported in \"Memory\" sink" );
+                }
             }
+            size_t capacity = DEFAULT_CAPACITY;
+            if( boost::optional<std::string> oCapacity = settings["Capacity"] )
+            {
+                capacity = boost::lexical_cast<size_t>( *oCapacity );
+            }
+
+            const auto name = sink_name( settings, "Memory" );
+            auto buffer = std::make_shared<Memory_Buffer>( capacity );
+            auto backend = boost::make_shared<Memory_Backend>( buffer, stats::Registry::instance().register_sink( name ) );
+            auto pSink = boost::make_shared<boost::log::sinks::unlocked_sink<Memory_Backend>>( backend );
+            apply_filter_setting( pSink, settings );
+            Memory_Registry::instance().add( name, std::move( buffer ) );
+            return pSink;
+        }
+
+}; // End of Memory_Sink_Factory class
+
+/**
+ * Replacement for Boost.Log's "TextFile" sink factory.  It accepts the same settings
+ * and additionally reports the sink's counters to `tmns::log::stats()`.  With
+ * `MultiProcess=true`, several processes can append to the same file; see
+ * `make_shared_file_backend()`.  With "%T" in "FileName", each thread writes its own
+ * file; see `make_sharded_sink()`.  With `Index=true`, a sidecar index is written next to
+ * each file; see `make_indexed_file_backend()`.
+*/
+class Text_File_Sink_Factory : public boost::log::sink_factory<char>
+{
+    public:
+
+        using SinkBackendType = Counting_Backend<boost::log::sinks::text_file_backend>;
 
-            // Final Rotation
-            if( boost::optional<std::string> enable_final_rot = settings["EnableFinalRotation"] )
+        boost::shared_ptr<boost::log::sinks::sink> create_sink( const settings_section& settings )
+        {
+            auto counters = stats::Registry::instance().register_sink( sink_name( settings, "TextFile" ) );
+            if( is_sharded( settings ) )
+            {
+                return make_sharded_sink( settings, "TextFile", counters, parse_format_setting( settings ) );
+            }
+#if defined(__unix__) || defined(__APPLE__)
+            if( is_multi_process( settings ) )
             {
-                p_sink_backend->enable_final_rotation( cast_to_bool( *enable_final_rot,
-                                                                     "EnableFinalRotation" ) );
+                return make_sink( make_shared_file_backend( settings, "TextFile", counters ), settings,
+                                  parse_format_setting( settings ) );
             }
+#endif
+            if( is_indexed( settings ) )
+            {
+                return make_sink( make_indexed_file_backend( settings, "TextFile", counters ), settings,
+                                  parse_format_setting( settings ) );
+            }
+            auto p_sink_backend = boost::make_shared<SinkBackendType>( counters );
+            configure_file_backend( *p_sink_backend, settings, "TextFile" );
+            return make_sink( p_sink_backend, settings, parse_format_setting( settings ) );
+        }
+
+}; // End of Text_File_Sink_Factory class
+
+/**
+ * Creates a text sink writing to the provided stream.  The stream must outlive the sink.
+*/
+inline boost::shared_ptr<Counting_Backend<boost::log::sinks::text_ostream_backend>>
+    make_stream_backend( std::ostream&      stream,
+                         const std::string& name )
+{
+    using BackendType = Counting_Backend<boost::log::sinks::text_ostream_backend>;
+    auto backend = boost::make_shared<BackendType>( stats::Registry::instance().register_sink( name ) );
+    backend->add_stream( boost::shared_ptr<std::ostream>( &stream, boost::null_deleter() ) );
+    return backend;
+}
+
+/**
+ * Replacement for Boost.Log's "Console" sink factory.  Records are written to `std::clog`
+ * and the sink's counters are reported to `tmns::log::stats()`.
+*/
+class Console_Sink_Factory : public boost::log::sink_factory<char>
+{
+    public:
+
+        boost::shared_ptr<boost::log::sinks::sink> create_sink( const settings_section& settings )
+        {
+            auto p_sink_backend = make_stream_backend( std::clog, sink_name( settings, "Console" ) );
 
             // Auto newline mode
             if( boost::optional<std::string> auto_nl = settings["AutoNewline"] )
@@ -122,10 +1126,7 @@ class Json_File_Sink_Factory : public boost::log::sink_factory<char>
                 }
                 else
                 {
-                    std::string message = "Unsupported auto newline mode \"";
-                    message += val;
-                    message += "\" in JsonFile configuration";
-                    throw std::runtime_error( std::move( message ));
+                    throw std::runtime_error( "Unsupported auto newline mode \"" + val + "\" in Console configuration" );
                 }
             }
 
@@ -135,110 +1136,181 @@ class Json_File_Sink_Factory : public boost::log::sink_factory<char>
                 p_sink_backend->auto_flush( cast_to_bool( *do_auto_flush, "AutoFlush" ) );
             }
 
-            // Append
-            if( boost::optional<std::string> do_append = settings["Append"] )
+            return make_sink( p_sink_backend, settings, parse_format_setting( settings ) );
+        }
+
+}; // End of Console_Sink_Factory class
+
+#if defined(__unix__) || defined(__APPLE__)
+/**
+ * Creates sinks streaming records to a local `AF_UNIX` socket, used when a sink's
+ * Destination field is set to "UnixSocket".  See `Unix_Socket_Backend`.
+ *
+ * Settings, besides "Filter", "Asynchronous", and the queue settings of every sink:
+ *
+ * - "Path": path of the peer's listening socket (required)
+ * - "SocketType": "Stream" (the default), where records end with a newline, or
+ *   "SeqPacket", where each record is one packet
+ * - "Encoding": "Text" (the default), formatted with "Format", or "Json", "Cbor", or
+ *   "MsgPack", formatted like the "JsonFile" sink; the binary encodings need "SeqPacket"
+ * - "BufferSize": bytes of records held while the peer is slow or away (1 MiB)
+ * - "BatchSize": maximum number of records per system call (64)
+ * - "ReconnectInterval": milliseconds between connection attempts (500)
+ * - "FlushTimeout": longest time in milliseconds a flush waits for the peer (5000)
+*/
+class Unix_Socket_Sink_Factory : public boost::log::sink_factory<char>
+{
+    public:
+
+        using SinkBackendType = Counting_Backend<Unix_Socket_Backend>;
+
+        boost::shared_ptr<boost::log::sinks::sink> create_sink( const settings_section& settings )
+        {
+            Unix_Socket_Options options;
+            if( boost::optional<std::string> oPath = settings["Path"] )
             {
-                if( cast_to_bool( *do_append, "Append" ) )
-                {
-                    p_sink_backend->set_open_mode( std::ios_base::out | std::ios_base::app );
-                }
+                options.path = *oPath;
             }
-
-            // Target Directory
-            if( boost::optional<std::string> o_target = settings["Target"] )
+            else
             {
-                boost::filesystem::path target_dir( *o_target );
-
-                // Max Total Size
-                uintmax_t max_size = std::numeric_limits<uintmax_t>::max();
-                if( boost::optional<std::string> oMaxSize = settings["MaxSize"] )
-                {
-                    max_size = boost::lexical_cast<uintmax_t>( *oMaxSize );
-                }
+                throw std::runtime_error( R"(Missing "Path" field in "UnixSocket" sink)" );
+            }
+            if( boost::optional<std::string> oType = settings["SocketType"] )
+            {
+                options.type = parse_socket_type( *oType );
+            }
+            if( boost::optional<std::string> oSize = settings["BufferSize"] )
+            {
+                options.buffer_size = boost::lexical_cast<size_t>( *oSize );
+            }
+            if( boost::optional<std::string> oBatch = settings["BatchSize"] )
+            {
+                options.batch_size = boost::lexical_cast<size_t>( *oBatch );
+            }
+            if( boost::optional<std::string> oInterval = settings["ReconnectInterval"] )
+            {
+                options.reconnect_interval = std::chrono::milliseconds( boost::lexical_cast<int64_t>( *oInterval ) );
+            }
+            if( boost::optional<std::string> oTimeout = settings["FlushTimeout"] )
+            {
+                options.flush_timeout = std::chrono::milliseconds( boost::lexical_cast<int64_t>( *oTimeout ) );
+            }
 
-                // Min Free Space
-                uintmax_t space = 0;
-                if( boost::optional<std::string> oMinSpace = settings["MinFreeSpace"] )
+            boost::log::formatter formatter = parse_format_setting( settings );
+            if( boost::optional<std::string> oEncoding = settings["Encoding"] )
+            {
+                auto encoding = format::parse_encoding( *oEncoding );
+                if( ( encoding == format::Encoding::CBOR || encoding == format::Encoding::MSGPACK ) &&
+                    options.type != Socket_Type::SEQPACKET )
                 {
-                    space = boost::lexical_cast<uintmax_t>( *oMinSpace );
+                    throw std::runtime_error( R"(A binary Encoding requires "SocketType" "SeqPacket" in "UnixSocket" sink)" );
                 }
-
-                // Max Number of Files
-                uintmax_t max_files = std::numeric_limits<uintmax_t>::max();
-                if( boost::optional<std::string> oMaxSize = settings["MaxFiles"] )
+                if( encoding != format::Encoding::TEXT )
                 {
-                    max_files = boost::lexical_cast<uintmax_t>( *oMaxSize );
+                    formatter = structured_formatter( encoding );
                 }
+            }
 
-                p_sink_backend->set_file_collector( boost::log::sinks::file::make_collector(
-                    kw::target = target_dir,
-                    kw::max_size = max_size,
-                    kw::min_free_space = space,
-                    kw::max_files = max_files
-                ));
+            auto counters = stats::Registry::instance().register_sink( sink_name( settings, "UnixSocket" ) );
+            auto p_sink_backend = boost::make_shared<SinkBackendType>( counters, std::move( options ), counters );
+            return make_sink( p_sink_backend, settings, std::move( formatter ) );
+        }
 
-                // Scan for log files
-                if( boost::optional<std::string> oScanForFiles = settings["ScanForFiles"] )
-                {
-                    const auto& scanForFiles = *oScanForFiles;
-                    if( scanForFiles == "All" )
-                    {
-                        p_sink_backend->scan_for_files( boost::log::sinks::file::scan_all );
-                    }
-                    else if( scanForFiles == "Matching" )
-                    {
-                        p_sink_backend->scan_for_files( boost::log::sinks::file::scan_matching );
-                    }
-                    else
-                    {
-                        std::string message = "Unsupported scan method \"";
-                        message += scanForFiles;
-                        message += "\" in JsonFile configuration";
-                       throw std::runtime_error( std::move( message ));
-                    }
-                }
-            }
+}; // End of Unix_Socket_Sink_Factory class
 
-            // Filter
-            boost::log::filter filt;
-            if( boost::optional<std::string> oFilter = settings["Filter"] )
-            {
-                filt = boost::log::parse_filter( *oFilter );
-            }
+/**
+ * Creates sinks handing records to a `terminus_log_writerd` process through a shared-memory
+ * ring, used when a sink's Destination field is set to "SharedMemory".  The records are not
+ * formatted by this process, so "Format" and "Asynchronous" do not apply.
+ *
+ * Settings, besides "Filter":
+ *
+ * - "Segment": name of the POSIX shared-memory segment, such as "/myapp_log" (required)
+ * - "SlotCount": number of records the ring holds, if this process creates it (65536)
+ * - "SlotSize": bytes per record slot, if this process creates it (1024)
+*/
+class Shared_Memory_Sink_Factory : public boost::log::sink_factory<char>
+{
+    public:
 
-            // Define and configure the sink frontend
-            bool async = false;
-            if( boost::optional<std::string> oAsync = settings["Asynchronous"])
+        boost::shared_ptr<boost::log::sinks::sink> create_sink( const settings_section& settings )
+        {
+            boost::optional<std::string> oSegment = settings["Segment"];
+            if( !oSegment )
             {
-                async = cast_to_bool( *oAsync, "Asynchronous" );
+                throw std::runtime_error( R"(Missing "Segment" field in "SharedMemory" sink)" );
             }
-
-            if( !async )
+            uint64_t slot_count = ipc::Shared_Ring::DEFAULT_SLOT_COUNT;
+            if( boost::optional<std::string> oCount = settings["SlotCount"] )
             {
-                using SinkType = boost::log::sinks::synchronous_sink<SinkBackendType>;
-                auto pSink = boost::make_shared<SinkType>( p_sink_backend );
-                pSink->set_filter( filt );
-                pSink->set_formatter( &format::json );
-                return pSink;
+                slot_count = boost::lexical_cast<uint64_t>( *oCount );
             }
-            else
+            uint32_t slot_size = ipc::Shared_Ring::DEFAULT_SLOT_SIZE;
+            if( boost::optional<std::string> oSize = settings["SlotSize"] )
             {
-                using SinkType = boost::log::sinks::asynchronous_sink<SinkBackendType>;
-                auto pSink = boost::make_shared<SinkType>( p_sink_backend );
-                pSink->set_filter( filt );
-                pSink->set_formatter( &format::json );
-                pSink->set_exception_handler( boost::log::nop() );
-                return pSink;
+                slot_size = boost::lexical_cast<uint32_t>( *oSize );
             }
+
+            auto counters = stats::Registry::instance().register_sink( sink_name( settings, "SharedMemory" ) );
+            auto backend = boost::make_shared<Shared_Memory_Backend>( ipc::Shared_Ring::open( *oSegment, slot_count, slot_size ),
+                                                                      counters );
+
+            auto pSink = boost::make_shared<boost::log::sinks::unlocked_sink<Shared_Memory_Backend>>( backend );
+            apply_filter_setting( pSink, settings );
+            return pSink;
         }
 
-}; // End of JSON File Sync Factory
+}; // End of Shared_Memory_Sink_Factory class
+#endif // defined(__unix__) || defined(__APPLE__)
 
+/**
+ * Adds a synchronous sink writing to the provided stream with the provided format string.
+ * This is the counted equivalent of `boost::log::add_console_log`.
+*/
+inline void add_console_sink( std::ostream&      stream,
+                              const std::string& format_str,
+                              const std::string& name )
+{
+    using SinkType = boost::log::sinks::synchronous_sink<Counting_Backend<boost::log::sinks::text_ostream_backend>>;
+    auto backend = make_stream_backend( stream, name );
+    auto sink = boost::make_shared<SinkType>( backend );
+    sink->set_formatter( Timed_Formatter{ format::compile_formatter( format_str ), backend->counters() } );
+    boost::log::core::get()->add_sink( sink );
+    Severity_Threshold::instance().add_sink( sink, ALL_SEVERITIES );
+}
 
-// Register the sync
+/**
+ * Adds a "Memory" sink accepting every record and returns its buffer.  This is the
+ * equivalent of a `[Sinks.<name>]` section with `Destination=Memory`.
+*/
+inline std::shared_ptr<Memory_Buffer> add_memory_sink( const std::string& name,
+                                                       size_t             capacity )
+{
+    auto buffer = std::make_shared<Memory_Buffer>( capacity );
+    auto backend = boost::make_shared<Memory_Backend>( buffer, stats::Registry::instance().register_sink( name ) );
+    auto sink = boost::make_shared<boost::log::sinks::unlocked_sink<Memory_Backend>>( backend );
+    boost::log::core::get()->add_sink( sink );
+    Severity_Threshold::instance().add_sink( sink, ALL_SEVERITIES );
+    Memory_Registry::instance().add( name, buffer );
+    return buffer;
+}
+
+// Register the sinks
 inline void configure()
 {
+    // Sinks created by this configuration share a new filter table
+    filter::reset_table();
+
     boost::log::register_sink_factory( "JsonFile", boost::make_shared<Json_File_Sink_Factory>() );
+    boost::log::register_sink_factory( "TextFile", boost::make_shared<Text_File_Sink_Factory>() );
+    boost::log::register_sink_factory( "ColumnFile", boost::make_shared<Column_File_Sink_Factory>() );
+    boost::log::register_sink_factory( "Console",  boost::make_shared<Console_Sink_Factory>() );
+    boost::log::register_sink_factory( "Memory",   boost::make_shared<Memory_Sink_Factory>() );
+    boost::log::register_sink_factory( "Null",     boost::make_shared<Null_Sink_Factory>() );
+#if defined(__unix__) || defined(__APPLE__)
+    boost::log::register_sink_factory( "UnixSocket", boost::make_shared<Unix_Socket_Sink_Factory>() );
+    boost::log::register_sink_factory( "SharedMemory", boost::make_shared<Shared_Memory_Sink_Factory>() );
+#endif
 }
 
-} // End of tmns::log::impl::sinks namespace
\ No newline at end of file
+} // End of tmns::log::impl::sinks namespace
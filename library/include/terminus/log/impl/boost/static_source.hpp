@@ -0,0 +1,80 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    static_source.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Terminus Libraries
+#include <terminus/log/impl/boost/shared_source.hpp>
+#include <terminus/log/impl/fixed_string.hpp>
+
+// Boost Libraries
+#include <boost/log/core/core.hpp>
+#include <boost/log/core/record.hpp>
+#include <boost/log/keywords/severity.hpp>
+
+// C++ Libraries
+#include <atomic>
+#include <utility>
+
+namespace tmns::log::impl {
+
+/**
+ * Record source for a scope known at compile time.  The source is empty: the pointer to the
+ * scope's interned `Source_State` is `constinit` static data shared by every source of the
+ * scope, so creating a source does no work at all and there is no static-init guard.
+ *
+ * Boost.Log attributes are reference counted heap objects and cannot be built at compile
+ * time, so the state itself is interned by the `Scope_Registry` on the first record opened
+ * for the scope.  After that, opening a record costs one atomic load.
+*/
+template <Fixed_String ScopeT>
+class Static_Source
+{
+    public:
+
+        using char_type = char;
+
+        /**
+         * Opens a record at the severity given by the `keywords::severity` argument.
+        */
+        template <typename ArgsT>
+        boost::log::record open_record( const ArgsT& args ) const
+        {
+            return boost::log::core::get()->open_record( state().attributes( args[boost::log::keywords::severity] ) );
+        }
+
+        void push_record( boost::log::record&& rec ) const
+        {
+            boost::log::core::get()->push_record( std::move( rec ) );
+        }
+
+    private:
+
+        static const Source_State& state()
+        {
+            auto state = s_state.load( std::memory_order_acquire );
+            if( state == nullptr )
+            {
+                // Racing threads intern the same state, so either store is correct
+                state = &Scope_Registry::instance().intern( ScopeT.view() );
+                s_state.store( state, std::memory_order_release );
+            }
+            return *state;
+        }
+
+        static inline constinit std::atomic<const Source_State*> s_state{ nullptr };
+
+}; // End of Static_Source class
+
+} // End of tmns::log::impl namespace
@@ -0,0 +1,152 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    threshold.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Boost Libraries
+#include <boost/log/sinks/sink.hpp>
+#include <boost/log/trivial.hpp>
+#include <boost/weak_ptr.hpp>
+
+// C++ Libraries
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace tmns::log::impl {
+
+/**
+ * Bitset with one bit per severity level, bit 0 being `trace`.
+*/
+using Severity_Mask = uint8_t;
+
+/// Mask with every severity level
+inline constexpr Severity_Mask ALL_SEVERITIES = ( 1u << ( static_cast<unsigned>( boost::log::trivial::fatal ) + 1 ) ) - 1;
+
+/**
+ * Loosest severity level that the core filter and at least one sink may accept, as
+ * computed by the last call to `configure()`.  Starts at `trace`, so nothing is skipped
+ * before the library is configured.
+*/
+inline std::atomic<int>& minimum_severity()
+{
+    static std::atomic<int> s_minimum{ static_cast<int>( boost::log::trivial::trace ) };
+    return s_minimum;
+}
+
+/**
+ * Returns true if no sink can accept a record at the severity level, so the record does
+ * not need to be opened.
+*/
+inline bool below_minimum_severity( boost::log::trivial::severity_level level )
+{
+    return static_cast<int>( level ) < minimum_severity().load( std::memory_order_relaxed );
+}
+
+/**
+ * Severity levels the sinks created by this library may accept, used to compute the
+ * `minimum_severity()` when the library is configured.
+ *
+ * Sinks are tracked through weak pointers, so sinks removed from the Boost.Log core stop
+ * counting once they are destroyed.  Sinks this library does not create, such as sinks
+ * with a destination from Boost.Log's own factories, may accept anything.  Sinks added to
+ * the core or filters changed directly through Boost.Log after configuring the library
+ * are not seen until the library is configured again.
+*/
+class Severity_Threshold
+{
+    public:
+
+        static Severity_Threshold& instance()
+        {
+            static Severity_Threshold s_instance;
+            return s_instance;
+        }
+
+        /**
+         * Tracks a sink accepting at most the severity levels in the mask.
+        */
+        void add_sink( const boost::shared_ptr<boost::log::sinks::sink>& sink,
+                       Severity_Mask                                     levels )
+        {
+            std::lock_guard<std::mutex> lock{ m_mutex };
+            m_sinks.push_back( { sink, levels } );
+            ++m_sinks_added;
+        }
+
+        /**
+         * Number of sinks added so far, used to find the sinks of a configuration that
+         * were not created by this library.
+        */
+        [[nodiscard]] size_t sinks_added() const
+        {
+            std::lock_guard<std::mutex> lock{ m_mutex };
+            return m_sinks_added;
+        }
+
+        /**
+         * Records that a sink this library cannot see was configured.  Such a sink may
+         * accept any level for the rest of the program.
+        */
+        void add_unknown_sink()
+        {
+            std::lock_guard<std::mutex> lock{ m_mutex };
+            m_unknown_sink = true;
+        }
+
+        /**
+         * Recomputes `minimum_severity()` from the levels the core filter accepts and the
+         * levels of every live sink.
+        */
+        void update( Severity_Mask core_levels )
+        {
+            std::lock_guard<std::mutex> lock{ m_mutex };
+            std::erase_if( m_sinks, []( const Tracked_Sink& tracked ){ return tracked.sink.expired(); } );
+
+            Severity_Mask sink_levels = m_unknown_sink ? ALL_SEVERITIES : 0;
+            for( const auto& tracked : m_sinks )
+            {
+                sink_levels |= tracked.levels;
+            }
+
+            // With no level left, every level is below the threshold
+            Severity_Mask levels = core_levels & sink_levels;
+            int minimum = levels == 0 ? static_cast<int>( boost::log::trivial::fatal ) + 1
+                                      : std::countr_zero( static_cast<unsigned>( levels ) );
+            minimum_severity().store( minimum, std::memory_order_relaxed );
+        }
+
+    private:
+
+        Severity_Threshold() = default;
+
+        struct Tracked_Sink
+        {
+            boost::weak_ptr<boost::log::sinks::sink> sink;
+            Severity_Mask                            levels;
+        }; // End of Tracked_Sink struct
+
+        mutable std::mutex m_mutex;
+
+        std::vector<Tracked_Sink> m_sinks;
+
+        size_t m_sinks_added{ 0 };
+
+        bool m_unknown_sink{ false };
+
+}; // End of Severity_Threshold class
+
+} // End of tmns::log::impl namespace
@@ -0,0 +1,490 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    unix_socket_backend.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+#if defined(__unix__) || defined(__APPLE__)
+
+// Project Libraries
+#include <terminus/log/impl/stats.hpp>
+
+// Boost Libraries
+#include <boost/algorithm/string/case_conv.hpp>
+#include <boost/log/core/record_view.hpp>
+#include <boost/log/sinks/basic_sink_backend.hpp>
+#include <boost/log/sinks/frontend_requirements.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// POSIX
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace tmns::log::impl::sinks {
+
+/**
+ * Kind of `AF_UNIX` socket a `Unix_Socket_Backend` connects to.
+*/
+enum class Socket_Type
+{
+    /// `SOCK_STREAM`, records are separated by a newline
+    STREAM,
+
+    /// `SOCK_SEQPACKET`, each record is one packet
+    SEQPACKET,
+}; // End of Socket_Type enum
+
+/**
+ * Parses the "SocketType" setting, which is "Stream" or "SeqPacket" (case-insensitive).
+*/
+inline Socket_Type parse_socket_type( const std::string& value )
+{
+    auto lval = boost::algorithm::to_lower_copy( value );
+    if( lval == "stream" )
+    {
+        return Socket_Type::STREAM;
+    }
+    if( lval == "seqpacket" )
+    {
+        return Socket_Type::SEQPACKET;
+    }
+    throw std::runtime_error( "Invalid SocketType \"" + value + "\": must be \"Stream\" or \"SeqPacket\"" );
+}
+
+/**
+ * Settings of a `Unix_Socket_Backend`.
+*/
+struct Unix_Socket_Options
+{
+    /// Filesystem path of the peer's listening socket
+    std::string path;
+
+    Socket_Type type{ Socket_Type::STREAM };
+
+    /// Bytes of formatted records held while the peer is slow or away
+    size_t buffer_size{ 1024 * 1024 };
+
+    /// Maximum number of records sent by one system call
+    size_t batch_size{ 64 };
+
+    /// Time between connection attempts while the peer is away
+    std::chrono::milliseconds reconnect_interval{ 500 };
+
+    /// Longest time `flush()` waits for buffered records to be sent
+    std::chrono::milliseconds flush_timeout{ 5000 };
+
+}; // End of Unix_Socket_Options struct
+
+/**
+ * Sink backend streaming formatted records to a local `AF_UNIX` socket, such as the
+ * socket of a log shipper.
+ *
+ * `consume` only appends the record to a bounded buffer, so producers never wait for the
+ * peer.  A background thread connects to the peer, sends the buffered records in batches
+ * with gather writes (`sendmmsg` for `SOCK_SEQPACKET` on Linux), and reconnects every
+ * `reconnect_interval` after the peer goes away.  While the buffer holds `buffer_size`
+ * bytes, new records are dropped and counted in the sink's `records_dropped`.  A record
+ * cut off by a lost connection is sent again, whole, on the next connection.  Records are
+ * counted in `records_emitted` by the background thread once they are sent.
+*/
+class Unix_Socket_Backend
+    : public boost::log::sinks::basic_formatted_sink_backend<char,
+                                                             boost::log::sinks::combine_requirements<
+                                                                 boost::log::sinks::synchronized_feeding,
+                                                                 boost::log::sinks::flushing>::type>
+{
+    public:
+
+        /// Records are counted as emitted when sent, not when queued
+        static constexpr bool REPORTS_OWN_OUTPUT = true;
+
+        Unix_Socket_Backend( Unix_Socket_Options                   options,
+                             std::shared_ptr<stats::Sink_Counters> counters )
+          : m_options{ std::move( options ) },
+            m_counters{ std::move( counters ) }
+        {
+            if( m_options.path.size() >= sizeof( sockaddr_un::sun_path ) )
+            {
+                throw std::runtime_error( "UnixSocket path \"" + m_options.path + "\" is too long" );
+            }
+            m_options.batch_size = std::clamp<size_t>( m_options.batch_size, 1, MAX_BATCH );
+            m_thread = std::thread( [this](){ run(); } );
+        }
+
+        Unix_Socket_Backend( const Unix_Socket_Backend& ) = delete;
+        Unix_Socket_Backend& operator=( const Unix_Socket_Backend& ) = delete;
+
+        /**
+         * Sends what the peer accepts without waiting, then closes the connection.
+        */
+        ~Unix_Socket_Backend()
+        {
+            {
+                std::lock_guard<std::mutex> lock{ m_mutex };
+                m_stopping = true;
+            }
+            m_wakeup.notify_all();
+            m_thread.join();
+        }
+
+        /**
+         * Queues the record for sending.  Returns false if the buffer is full and the record
+         * was dropped.
+        */
+        bool consume( const boost::log::record_view& /*rec*/,
+                      const string_type&             formatted_message )
+        {
+            {
+                std::lock_guard<std::mutex> lock{ m_mutex };
+                if( m_queued_bytes + formatted_message.size() > m_options.buffer_size )
+                {
+                    m_counters->records_dropped.fetch_add( 1, std::memory_order_relaxed );
+                    return false;
+                }
+                m_queued_bytes += formatted_message.size();
+                m_queue.push_back( formatted_message );
+            }
+            m_wakeup.notify_one();
+            return true;
+        }
+
+        /**
+         * Waits until every buffered record is sent, the peer is away, or the flush
+         * timeout expires.
+        */
+        void flush()
+        {
+            std::unique_lock<std::mutex> lock{ m_mutex };
+            m_progress.wait_for( lock, m_options.flush_timeout, [this]()
+            {
+                return m_state == State::DISCONNECTED || ( m_queue.empty() && m_in_flight == 0 );
+            });
+        }
+
+        /**
+         * Returns true while connected to the peer.
+        */
+        [[nodiscard]] bool is_connected() const
+        {
+            std::lock_guard<std::mutex> lock{ m_mutex };
+            return m_state == State::CONNECTED;
+        }
+
+    private:
+
+        static constexpr size_t MAX_BATCH = 512;
+
+        /// Time a send waits for the peer before checking whether the backend is stopping
+        static constexpr int POLL_MILLISECONDS = 100;
+
+        enum class State
+        {
+            CONNECTING,
+            CONNECTED,
+            DISCONNECTED,
+        }; // End of State enum
+
+        void run()
+        {
+            std::vector<std::string> batch;
+            int fd = -1;
+
+            std::unique_lock<std::mutex> lock{ m_mutex };
+            while( true )
+            {
+                if( fd < 0 && !m_stopping )
+                {
+                    lock.unlock();
+                    fd = connect_socket();
+                    lock.lock();
+                    m_state = fd < 0 ? State::DISCONNECTED : State::CONNECTED;
+                    m_progress.notify_all();
+                    if( fd < 0 )
+                    {
+                        m_wakeup.wait_for( lock, m_options.reconnect_interval, [this](){ return m_stopping; } );
+                        continue;
+                    }
+                }
+
+                m_wakeup.wait( lock, [this](){ return m_stopping || !m_queue.empty(); } );
+                if( m_queue.empty() || fd < 0 )
+                {
+                    break; // Stopping
+                }
+
+                const size_t count = std::min( m_queue.size(), m_options.batch_size );
+                for( size_t i = 0; i < count; ++i )
+                {
+                    m_queued_bytes -= m_queue.front().size();
+                    batch.push_back( std::move( m_queue.front() ) );
+                    m_queue.pop_front();
+                }
+                m_in_flight = batch.size();
+                lock.unlock();
+
+                size_t sent = m_options.type == Socket_Type::STREAM ? send_stream( fd, batch )
+                                                                    : send_packets( fd, batch );
+
+                lock.lock();
+                if( sent < batch.size() )
+                {
+                    ::close( fd );
+                    fd = -1;
+                    if( m_stopping )
+                    {
+                        m_counters->records_dropped.fetch_add( batch.size() - sent, std::memory_order_relaxed );
+                    }
+                    else
+                    {
+                        // Send the rest again once reconnected, oldest first
+                        for( size_t i = batch.size(); i > sent; --i )
+                        {
+                            m_queued_bytes += batch[i - 1].size();
+                            m_queue.push_front( std::move( batch[i - 1] ) );
+                        }
+                    }
+                }
+                batch.clear();
+                m_in_flight = 0;
+                m_progress.notify_all();
+            }
+
+            m_counters->records_dropped.fetch_add( m_queue.size(), std::memory_order_relaxed );
+            m_queue.clear();
+            m_state = State::DISCONNECTED;
+            m_progress.notify_all();
+            if( fd >= 0 )
+            {
+                ::close( fd );
+            }
+        }
+
+        /**
+         * Connects a non-blocking socket to the peer, returning -1 if the peer is away.
+        */
+        int connect_socket() const
+        {
+            int fd = ::socket( AF_UNIX, m_options.type == Socket_Type::STREAM ? SOCK_STREAM : SOCK_SEQPACKET, 0 );
+            if( fd < 0 )
+            {
+                return -1;
+            }
+            ::fcntl( fd, F_SETFD, FD_CLOEXEC );
+#if defined(SO_NOSIGPIPE)
+            int one = 1;
+            ::setsockopt( fd, SOL_SOCKET, SO_NOSIGPIPE, &one, sizeof( one ) );
+#endif
+
+            sockaddr_un address{};
+            address.sun_family = AF_UNIX;
+            std::memcpy( address.sun_path, m_options.path.c_str(), m_options.path.size() + 1 );
+            if( ::connect( fd, reinterpret_cast<const sockaddr*>( &address ), sizeof( address ) ) != 0 )
+            {
+                ::close( fd );
+                return -1;
+            }
+            ::fcntl( fd, F_SETFL, ::fcntl( fd, F_GETFL ) | O_NONBLOCK );
+            return fd;
+        }
+
+        /**
+         * Waits for the socket to accept more data.  Returns false if the socket failed, or
+         * if the backend is stopping and the peer did not make room in time.
+        */
+        bool wait_writable( int fd ) const
+        {
+            pollfd poll_fd{ fd, POLLOUT, 0 };
+            int ready = ::poll( &poll_fd, 1, POLL_MILLISECONDS );
+            if( ready < 0 )
+            {
+                return errno == EINTR;
+            }
+            if( ready == 0 )
+            {
+                std::lock_guard<std::mutex> lock{ m_mutex };
+                return !m_stopping;
+            }
+            return ( poll_fd.revents & ( POLLERR | POLLHUP | POLLNVAL ) ) == 0;
+        }
+
+        /**
+         * Sends the records separated by newlines with gather writes.  Returns the number
+         * of records sent completely.
+        */
+        size_t send_stream( int                             fd,
+                            const std::vector<std::string>& batch ) const
+        {
+            static constexpr char NEWLINE = '\n';
+            std::vector<iovec> iov;
+            iov.reserve( batch.size() * 2 );
+            for( const auto& record : batch )
+            {
+                iov.push_back( { const_cast<char*>( record.data() ), record.size() } );
+                iov.push_back( { const_cast<char*>( &NEWLINE ), 1 } );
+            }
+
+            size_t next = 0;
+            while( next < iov.size() )
+            {
+                msghdr message{};
+                message.msg_iov    = &iov[next];
+                message.msg_iovlen = static_cast<decltype( message.msg_iovlen )>( iov.size() - next );
+                ssize_t written = ::sendmsg( fd, &message, SEND_FLAGS );
+                if( written < 0 )
+                {
+                    if( errno == EINTR || ( ( errno == EAGAIN || errno == EWOULDBLOCK ) && wait_writable( fd ) ) )
+                    {
+                        continue;
+                    }
+                    break;
+                }
+
+                // Skip what was written, leaving a partly written buffer at its remainder
+                auto remaining = static_cast<size_t>( written );
+                while( next < iov.size() && remaining >= iov[next].iov_len )
+                {
+                    remaining -= iov[next].iov_len;
+                    ++next;
+                }
+                if( remaining > 0 )
+                {
+                    iov[next].iov_base = static_cast<char*>( iov[next].iov_base ) + remaining;
+                    iov[next].iov_len -= remaining;
+                }
+            }
+            count_emitted( batch, 0, next / 2 );
+            return next / 2;
+        }
+
+        /**
+         * Sends each record as one packet.  Returns the number of records handled, counting
+         * records too large for a packet as dropped.
+        */
+        size_t send_packets( int                             fd,
+                             const std::vector<std::string>& batch ) const
+        {
+            std::vector<iovec> iov( batch.size() );
+            for( size_t i = 0; i < batch.size(); ++i )
+            {
+                iov[i] = { const_cast<char*>( batch[i].data() ), batch[i].size() };
+            }
+
+            size_t next = 0;
+            while( next < batch.size() )
+            {
+#if defined(__linux__)
+                std::vector<mmsghdr> messages( batch.size() - next );
+                for( size_t i = 0; i < messages.size(); ++i )
+                {
+                    messages[i].msg_hdr = msghdr{};
+                    messages[i].msg_hdr.msg_iov    = &iov[next + i];
+                    messages[i].msg_hdr.msg_iovlen = 1;
+                }
+                int sent = ::sendmmsg( fd, messages.data(), static_cast<unsigned int>( messages.size() ), SEND_FLAGS );
+#else
+                msghdr message{};
+                message.msg_iov    = &iov[next];
+                message.msg_iovlen = 1;
+                int sent = ::sendmsg( fd, &message, SEND_FLAGS ) < 0 ? -1 : 1;
+#endif
+                if( sent > 0 )
+                {
+                    count_emitted( batch, next, next + static_cast<size_t>( sent ) );
+                    next += static_cast<size_t>( sent );
+                    continue;
+                }
+                if( errno == EMSGSIZE )
+                {
+                    m_counters->records_dropped.fetch_add( 1, std::memory_order_relaxed );
+                    ++next;
+                    continue;
+                }
+                if( errno == EINTR || ( ( errno == EAGAIN || errno == EWOULDBLOCK ) && wait_writable( fd ) ) )
+                {
+                    continue;
+                }
+                break;
+            }
+            return next;
+        }
+
+        /**
+         * Counts the records `[first, last)` of the batch as emitted.
+        */
+        void count_emitted( const std::vector<std::string>& batch,
+                            size_t                          first,
+                            size_t                          last ) const
+        {
+            size_t bytes = 0;
+            for( size_t i = first; i < last; ++i )
+            {
+                bytes += batch[i].size();
+            }
+            m_counters->records_emitted.fetch_add( last - first, std::memory_order_relaxed );
+            m_counters->bytes_written.fetch_add( bytes, std::memory_order_relaxed );
+        }
+
+#if defined(MSG_NOSIGNAL)
+        static constexpr int SEND_FLAGS = MSG_NOSIGNAL;
+#else
+        static constexpr int SEND_FLAGS = 0;
+#endif
+
+        Unix_Socket_Options m_options;
+
+        std::shared_ptr<stats::Sink_Counters> m_counters;
+
+        mutable std::mutex m_mutex;
+
+        /// Signals the sending thread that records were queued or the backend is stopping
+        std::condition_variable m_wakeup;
+
+        /// Signals `flush()` that records were sent or the connection state changed
+        std::condition_variable m_progress;
+
+        std::deque<std::string> m_queue;
+
+        size_t m_queued_bytes{ 0 };
+
+        /// Records taken from the queue by the sending thread and not yet sent
+        size_t m_in_flight{ 0 };
+
+        State m_state{ State::CONNECTING };
+
+        bool m_stopping{ false };
+
+        std::thread m_thread;
+
+}; // End of Unix_Socket_Backend class
+
+} // End of tmns::log::impl::sinks namespace
+
+#endif // defined(__unix__) || defined(__APPLE__)
@@ -15,33 +15,81 @@
 #pragma once
 
 // Project Libraries
+#include <terminus/log/field.hpp>
+#include <terminus/log/impl/boost/attributes.hpp>
+#include <terminus/log/impl/boost/shared_source.hpp>
+#include <terminus/log/impl/boost/threshold.hpp>
 #include <terminus/log/impl/location.hpp>
+#include <terminus/log/impl/stats.hpp>
 
 // Boost Libraries
+#include <boost/log/attributes/attribute_value_impl.hpp>
 #include <boost/log/attributes/scoped_attribute.hpp>
 #include <boost/log/core.hpp>
-#include <boost/log/sources/severity_logger.hpp>
+#include <boost/log/sources/record_ostream.hpp>
 #include <boost/log/trivial.hpp>
 
 // C++ Libraries
 #include <filesystem>
+#include <string>
 
 namespace tmns::log::impl {
 
+/**
+ * Type of the Boost.Log attribute value holding a field's value.
+*/
+template <typename ValueT>
+using field_attribute_t = std::conditional_t<std::is_same_v<ValueT,std::string_view>,std::string,ValueT>;
+
+/**
+ * Adds one argument of a logging call to the open record.  Fields become attributes
+ * of the record and everything else is written to the message.
+*/
+template <typename ArgT>
+void append( boost::log::record&             rec,
+             boost::log::formatting_ostream& stream,
+             ArgT&&                          arg )
+{
+    if constexpr( is_field_v<ArgT> )
+    {
+        using value_type = field_attribute_t<decltype( arg.value )>;
+        rec.attribute_values().insert( std::string{ arg.name },
+                                       boost::log::attributes::make_attribute_value( value_type( arg.value ) ) );
+    }
+    else
+    {
+        stream << std::forward<ArgT>( arg );
+    }
+}
+
 /**
  * Logs a message created from the provided arguments at the specified
- * severity level to the provided logger.
+ * severity level to the provided logger.  Arguments created with `kv()` are
+ * attached to the record as attributes instead of being written to the message.
+ *
+ * Records below the `minimum_severity()` are counted as filtered without being opened.
 */
 template <class LoggerT, typename... ArgsT>
 void write( LoggerT&                            logger,
             boost::log::trivial::severity_level severity,
             ArgsT&&...                          args )
 {
+    if( below_minimum_severity( severity ) )
+    {
+        stats::Registry::instance().records_filtered().add();
+        return;
+    }
+
     auto rec = logger.open_record( boost::log::keywords::severity = severity );
     if( !!rec )
     {
+        stats::Registry::instance().records_opened().add();
         auto pump = boost::log::aux::make_record_pump( logger, rec );
-        (pump.stream() << ... << std::forward<ArgsT>( args ) );
+        ( append( rec, pump.stream(), std::forward<ArgsT>( args ) ), ... );
+    }
+    else
+    {
+        stats::Registry::instance().records_filtered().add();
     }
 }
 
@@ -55,6 +103,12 @@ void write( LoggerT&                            logger,
             std::source_location                location,
             ArgsT&&...                          args )
 {
+    if( below_minimum_severity( severity ) )
+    {
+        stats::Registry::instance().records_filtered().add();
+        return;
+    }
+
     std::filesystem::path file{ location.file_name() };
     BOOST_LOG_SCOPED_THREAD_ATTR(
         "File",
@@ -71,10 +125,21 @@ void write( LoggerT&                            logger,
     write( logger, severity, std::forward<ArgsT>( args )... );
 }
 
+/**
+ * Returns the source of the global logging functions: the interned `Shared_Source` of the
+ * "global" scope, which is the same state a default constructed `Logger` uses.  Every
+ * thread logs through it without locking, and records carry the "Scope" of "global".
+*/
+inline const Shared_Source& global_logger()
+{
+    static const Shared_Source s_logger{ "global" };
+    return s_logger;
+}
+
 template <class... ArgsT>
 void debug( ArgsT&&... args )
 {
-    write( boost::log::trivial::logger::get(),
+    write( global_logger(),
            boost::log::trivial::severity_level::debug,
            std::forward<ArgsT>( args )... );
 }
@@ -83,7 +148,7 @@ template <class... ArgsT>
 void debug( std::source_location loc,
             ArgsT&&...           args )
 {
-    write( boost::log::trivial::logger::get(),
+    write( global_logger(),
            boost::log::trivial::severity_level::debug,
            std::move( loc ),
            std::forward<ArgsT>( args )... );
@@ -92,7 +157,7 @@ void debug( std::source_location loc,
 template <class... ArgsT>
 void trace( ArgsT&&... args )
 {
-    write( boost::log::trivial::logger::get(),
+    write( global_logger(),
            boost::log::trivial::severity_level::trace,
            std::forward<ArgsT>( args )... );
 }
@@ -101,7 +166,7 @@ template <class... ArgsT>
 void trace( std::source_location loc,
             ArgsT&&...           args )
 {
-    write( boost::log::trivial::logger::get(),
+    write( global_logger(),
            boost::log::trivial::severity_level::trace,
            std::move( loc ),
            std::forward<ArgsT>( args )... );
@@ -110,7 +175,7 @@ void trace( std::source_location loc,
 template <class... ArgsT>
 void info( ArgsT&&... args )
 {
-    write( boost::log::trivial::logger::get(),
+    write( global_logger(),
            boost::log::trivial::severity_level::info,
            std::forward<ArgsT>( args )... );
 }
@@ -119,7 +184,7 @@ template <class... ArgsT>
 void info( std::source_location loc,
             ArgsT&&...           args )
 {
-    write( boost::log::trivial::logger::get(),
+    write( global_logger(),
            boost::log::trivial::severity_level::info,
            std::move( loc ),
            std::forward<ArgsT>( args )... );
@@ -128,7 +193,7 @@ void info( std::source_location loc,
 template <class... ArgsT>
 void warn( ArgsT&&... args )
 {
-    write( boost::log::trivial::logger::get(),
+    write( global_logger(),
            boost::log::trivial::severity_level::warning,
            std::forward<ArgsT>( args )... );
 }
@@ -137,7 +202,7 @@ template <class... ArgsT>
 void warn( std::source_location loc,
             ArgsT&&...           args )
 {
-    write( boost::log::trivial::logger::get(),
+    write( global_logger(),
            boost::log::trivial::severity_level::warning,
            std::move( loc ),
            std::forward<ArgsT>( args )... );
@@ -146,7 +211,7 @@ void warn( std::source_location loc,
 template <class... ArgsT>
 void error( ArgsT&&... args )
 {
-    write( boost::log::trivial::logger::get(),
+    write( global_logger(),
            boost::log::trivial::severity_level::error,
            std::forward<ArgsT>( args )... );
 }
@@ -155,7 +220,7 @@ template <class... ArgsT>
 void error( std::source_location loc,
             ArgsT&&...           args )
 {
-    write( boost::log::trivial::logger::get(),
+    write( global_logger(),
            boost::log::trivial::severity_level::error,
            std::move( loc ),
            std::forward<ArgsT>( args )... );
@@ -164,7 +229,7 @@ void error( std::source_location loc,
 template <class... ArgsT>
 void fatal( ArgsT&&... args )
 {
-    write( boost::log::trivial::logger::get(),
+    write( global_logger(),
            boost::log::trivial::severity_level::fatal,
            std::forward<ArgsT>( args )... );
 }
@@ -173,7 +238,7 @@ template <class... ArgsT>
 void fatal( std::source_location loc,
             ArgsT&&...           args )
 {
-    write( boost::log::trivial::logger::get(),
+    write( global_logger(),
            boost::log::trivial::severity_level::fatal,
            std::move( loc ),
            std::forward<ArgsT>( args )... );
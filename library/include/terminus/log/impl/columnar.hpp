@@ -0,0 +1,820 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    columnar.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Project Libraries
+#include <terminus/log/impl/reader.hpp>
+
+// C++ Libraries
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * Columnar log files, written by the "ColumnFile" sink.
+ *
+ * A file starts with the 8-byte magic "TMNSCOL1" and is followed by blocks, each holding
+ * the records the sink buffered before writing them.  Every block describes itself, so a
+ * reader can start at any block and skip columns it does not know:
+ *
+ *     "TCOL"            block magic
+ *     uint32            size of the rest of the block
+ *     uint32            record count
+ *     uint16            column count
+ *     per column:
+ *       uint8, bytes    column name
+ *       uint8           encoding (`Encoding`)
+ *       uint32          size of the column data
+ *       bytes           column data
+ *
+ * Integers in headers are little-endian.  Column data starts with a varint count of the
+ * records that have a value; if that is fewer than the record count, a bitmap of
+ * `(count + 7) / 8` bytes, least significant bit first, marks them.  The values of those
+ * records follow, in an encoding-specific form:
+ *
+ * - `DELTA`: zigzag varints of the difference from the previous value, starting from 0
+ * - `DICTIONARY`: a varint entry count, each entry as a varint size and its bytes, and
+ *   then a varint entry id per value
+ * - `STRINGS`: a varint size per value, and then the bytes of all values
+*/
+namespace tmns::log::impl::columnar {
+
+/// Magic at the start of a columnar file
+inline constexpr std::string_view FILE_MAGIC{ "TMNSCOL1" };
+
+/// Magic at the start of each block
+inline constexpr std::string_view BLOCK_MAGIC{ "TCOL" };
+
+/**
+ * How a column's values are stored.
+*/
+enum class Encoding : uint8_t
+{
+    DELTA      = 1,
+    DICTIONARY = 2,
+    STRINGS    = 3,
+}; // End of Encoding enum
+
+namespace detail {
+
+inline void put_varint( std::string& out,
+                        uint64_t     value )
+{
+    while( value >= 0x80 )
+    {
+        out.push_back( static_cast<char>( ( value & 0x7F ) | 0x80 ) );
+        value >>= 7;
+    }
+    out.push_back( static_cast<char>( value ) );
+}
+
+template <typename UnsignedT>
+void put_le( std::string& out,
+             UnsignedT    value )
+{
+    for( size_t i = 0; i < sizeof( UnsignedT ); ++i )
+    {
+        out.push_back( static_cast<char>( ( value >> ( 8 * i ) ) & 0xFF ) );
+    }
+}
+
+/**
+ * Reads values from column or block data, failing once the data is exhausted.
+*/
+class Cursor
+{
+    public:
+
+        explicit Cursor( std::string_view data )
+          : m_pos{ data.data() },
+            m_end{ data.data() + data.size() }
+        {
+        }
+
+        bool varint( uint64_t& value )
+        {
+            value = 0;
+            for( int shift = 0; shift < 64 && m_pos < m_end; shift += 7 )
+            {
+                const auto byte = static_cast<uint8_t>( *m_pos++ );
+                value |= static_cast<uint64_t>( byte & 0x7F ) << shift;
+                if( ( byte & 0x80 ) == 0 )
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        template <typename UnsignedT>
+        bool le( UnsignedT& value )
+        {
+            if( static_cast<size_t>( m_end - m_pos ) < sizeof( UnsignedT ) )
+            {
+                return false;
+            }
+            value = 0;
+            for( size_t i = 0; i < sizeof( UnsignedT ); ++i )
+            {
+                value |= static_cast<UnsignedT>( static_cast<UnsignedT>( static_cast<uint8_t>( m_pos[i] ) ) << ( 8 * i ) );
+            }
+            m_pos += sizeof( UnsignedT );
+            return true;
+        }
+
+        bool bytes( std::string_view& value,
+                    uint64_t          size )
+        {
+            if( static_cast<uint64_t>( m_end - m_pos ) < size )
+            {
+                return false;
+            }
+            value = { m_pos, static_cast<size_t>( size ) };
+            m_pos += size;
+            return true;
+        }
+
+        [[nodiscard]] std::string_view rest() const
+        {
+            return { m_pos, static_cast<size_t>( m_end - m_pos ) };
+        }
+
+    private:
+
+        const char* m_pos;
+
+        const char* m_end;
+
+}; // End of Cursor class
+
+inline uint64_t zigzag( int64_t value )
+{
+    return ( static_cast<uint64_t>( value ) << 1 ) ^ static_cast<uint64_t>( value >> 63 );
+}
+
+inline int64_t unzigzag( uint64_t value )
+{
+    return static_cast<int64_t>( value >> 1 ) ^ -static_cast<int64_t>( value & 1 );
+}
+
+/**
+ * Hash allowing `std::string_view` lookups in a map keyed by `std::string`.
+*/
+struct String_Hash
+{
+    using is_transparent = void;
+
+    size_t operator()( std::string_view value ) const
+    {
+        return std::hash<std::string_view>{}( value );
+    }
+
+}; // End of String_Hash struct
+
+} // End of detail namespace
+
+/**
+ * Values of one column of the block being built.
+*/
+class Column_Builder
+{
+    public:
+
+        Column_Builder( std::string name,
+                        Encoding    encoding )
+          : m_name{ std::move( name ) },
+            m_encoding{ encoding }
+        {
+        }
+
+        void add( int64_t value )
+        {
+            // Differences wrap around like unsigned integers, so any two values have one
+            detail::put_varint( m_values, detail::zigzag( static_cast<int64_t>( static_cast<uint64_t>( value ) -
+                                                                                static_cast<uint64_t>( m_previous ) ) ) );
+            m_previous = value;
+            mark_present();
+        }
+
+        void add( std::string_view value )
+        {
+            if( m_encoding == Encoding::DICTIONARY )
+            {
+                auto it = m_ids.find( value );
+                if( it == m_ids.end() )
+                {
+                    it = m_ids.emplace( std::string{ value }, static_cast<uint32_t>( m_ids.size() ) ).first;
+                    detail::put_varint( m_entries, value.size() );
+                    m_entries.append( value );
+                }
+                detail::put_varint( m_values, it->second );
+            }
+            else
+            {
+                detail::put_varint( m_values, value.size() );
+                m_heap.append( value );
+            }
+            mark_present();
+        }
+
+        /**
+         * Records that the current record has no value.
+        */
+        void skip()
+        {
+            m_present.push_back( false );
+        }
+
+        [[nodiscard]] bool empty() const
+        {
+            return m_present_count == 0;
+        }
+
+        /**
+         * Appends the column's header and data to `out` and clears it for the next block.
+        */
+        void write( std::string& out )
+        {
+            std::string data;
+            detail::put_varint( data, m_present_count );
+            if( m_present_count != m_present.size() )
+            {
+                std::string bitmap( ( m_present.size() + 7 ) / 8, '\0' );
+                for( size_t i = 0; i < m_present.size(); ++i )
+                {
+                    if( m_present[i] )
+                    {
+                        bitmap[i / 8] = static_cast<char>( bitmap[i / 8] | ( 1 << ( i % 8 ) ) );
+                    }
+                }
+                data.append( bitmap );
+            }
+            if( m_encoding == Encoding::DICTIONARY )
+            {
+                detail::put_varint( data, m_ids.size() );
+                data.append( m_entries );
+            }
+            data.append( m_values );
+            data.append( m_heap );
+
+            out.push_back( static_cast<char>( m_name.size() ) );
+            out.append( m_name );
+            out.push_back( static_cast<char>( m_encoding ) );
+            detail::put_le( out, static_cast<uint32_t>( data.size() ) );
+            out.append( data );
+            clear();
+        }
+
+        void clear()
+        {
+            m_values.clear();
+            m_heap.clear();
+            m_entries.clear();
+            m_ids.clear();
+            m_present.clear();
+            m_present_count = 0;
+            m_previous = 0;
+        }
+
+    private:
+
+        void mark_present()
+        {
+            m_present.push_back( true );
+            ++m_present_count;
+        }
+
+        std::string m_name;
+
+        Encoding m_encoding;
+
+        /// Varint values, sizes, or dictionary ids
+        std::string m_values;
+
+        /// Bytes of `STRINGS` values
+        std::string m_heap;
+
+        /// Encoded dictionary entries, and their ids
+        std::string m_entries;
+        std::unordered_map<std::string,uint32_t,detail::String_Hash,std::equal_to<>> m_ids;
+
+        std::vector<bool> m_present;
+
+        uint64_t m_present_count{ 0 };
+
+        int64_t m_previous{ 0 };
+
+}; // End of Column_Builder class
+
+/**
+ * One record's values, as the "ColumnFile" sink stores them.
+*/
+struct Row
+{
+    std::optional<uint64_t> record_id;
+
+    /// Microseconds since the Unix epoch
+    std::optional<int64_t> time_stamp;
+
+    std::optional<std::string_view> severity;
+
+    std::optional<std::string_view> scope;
+
+    std::optional<uint64_t> thread_id;
+
+    std::optional<std::string_view> file;
+
+    std::optional<int64_t> line;
+
+    std::optional<std::string_view> function;
+
+    std::optional<std::string_view> message;
+
+}; // End of Row struct
+
+/**
+ * Buffers `Row`s into the columns of a block.  Time stamps, record ids, thread ids, and
+ * lines are delta-encoded, severities, scopes, files, and functions are
+ * dictionary-encoded, and messages go to a string heap.
+*/
+class Block_Builder
+{
+    public:
+
+        Block_Builder()
+          : m_columns{ { "RecordID",  Encoding::DELTA },
+                       { "TimeStamp", Encoding::DELTA },
+                       { "Severity",  Encoding::DICTIONARY },
+                       { "Scope",     Encoding::DICTIONARY },
+                       { "ThreadID",  Encoding::DELTA },
+                       { "File",      Encoding::DICTIONARY },
+                       { "Line",      Encoding::DELTA },
+                       { "Function",  Encoding::DICTIONARY },
+                       { "Message",   Encoding::STRINGS } }
+        {
+        }
+
+        void add( const Row& row )
+        {
+            put( m_columns[0], row.record_id );
+            put( m_columns[1], row.time_stamp );
+            put( m_columns[2], row.severity );
+            put( m_columns[3], row.scope );
+            put( m_columns[4], row.thread_id );
+            put( m_columns[5], row.file );
+            put( m_columns[6], row.line );
+            put( m_columns[7], row.function );
+            put( m_columns[8], row.message );
+            ++m_count;
+        }
+
+        [[nodiscard]] uint32_t size() const
+        {
+            return m_count;
+        }
+
+        /**
+         * Appends the block to `out` and starts a new one.  Columns with no values are
+         * left out.  Nothing is appended for an empty block.
+        */
+        void write( std::string& out )
+        {
+            if( m_count == 0 )
+            {
+                return;
+            }
+            std::string body;
+            detail::put_le( body, m_count );
+            uint16_t columns = 0;
+            for( const auto& column : m_columns )
+            {
+                columns = static_cast<uint16_t>( columns + ( column.empty() ? 0 : 1 ) );
+            }
+            detail::put_le( body, columns );
+            for( auto& column : m_columns )
+            {
+                if( column.empty() )
+                {
+                    column.clear();
+                    continue;
+                }
+                column.write( body );
+            }
+
+            out.append( BLOCK_MAGIC );
+            detail::put_le( out, static_cast<uint32_t>( body.size() ) );
+            out.append( body );
+            m_count = 0;
+        }
+
+    private:
+
+        template <typename ValueT>
+        static void put( Column_Builder&               column,
+                         const std::optional<ValueT>&  value )
+        {
+            if( !value )
+            {
+                column.skip();
+            }
+            else if constexpr( std::is_same_v<ValueT,std::string_view> )
+            {
+                column.add( *value );
+            }
+            else
+            {
+                column.add( static_cast<int64_t>( *value ) );
+            }
+        }
+
+        std::vector<Column_Builder> m_columns;
+
+        uint32_t m_count{ 0 };
+
+}; // End of Block_Builder class
+
+/**
+ * One column of a block.  Its values are decoded on request into arrays holding one
+ * entry per record of the block; records without a value get 0, id 0, or an empty view,
+ * and `has_value()` tells them apart.
+*/
+class Column_View
+{
+    public:
+
+        /**
+         * @throws std::runtime_error if the column data is malformed.
+        */
+        Column_View( std::string_view name,
+                     Encoding         encoding,
+                     uint32_t         record_count,
+                     std::string_view data )
+          : m_name{ name },
+            m_encoding{ encoding },
+            m_record_count{ record_count }
+        {
+            detail::Cursor cursor{ data };
+            if( !cursor.varint( m_present_count ) || m_present_count > record_count )
+            {
+                throw std::runtime_error( "Malformed column \"" + std::string{ name } + "\"" );
+            }
+            if( m_present_count != record_count &&
+                !cursor.bytes( m_bitmap, ( static_cast<uint64_t>( record_count ) + 7 ) / 8 ) )
+            {
+                throw std::runtime_error( "Malformed column \"" + std::string{ name } + "\"" );
+            }
+            m_values = cursor.rest();
+        }
+
+        [[nodiscard]] std::string_view name() const
+        {
+            return m_name;
+        }
+
+        [[nodiscard]] Encoding encoding() const
+        {
+            return m_encoding;
+        }
+
+        [[nodiscard]] uint32_t record_count() const
+        {
+            return m_record_count;
+        }
+
+        /// True if every record of the block has a value
+        [[nodiscard]] bool all_present() const
+        {
+            return m_present_count == m_record_count;
+        }
+
+        [[nodiscard]] bool has_value( size_t record ) const
+        {
+            return m_bitmap.empty() || ( static_cast<uint8_t>( m_bitmap[record / 8] ) >> ( record % 8 ) & 1 ) != 0;
+        }
+
+        /**
+         * Decodes a `DELTA` column.
+        */
+        void integers( std::vector<int64_t>& out ) const
+        {
+            expect( Encoding::DELTA );
+            out.assign( m_record_count, 0 );
+            detail::Cursor cursor{ m_values };
+            int64_t value = 0;
+            for_each_present( [&]( size_t record )
+            {
+                uint64_t delta;
+                if( !cursor.varint( delta ) )
+                {
+                    malformed();
+                }
+                value = static_cast<int64_t>( static_cast<uint64_t>( value ) +
+                                              static_cast<uint64_t>( detail::unzigzag( delta ) ) );
+                out[record] = value;
+            });
+        }
+
+        /**
+         * Returns the entries of a `DICTIONARY` column.
+        */
+        [[nodiscard]] std::vector<std::string_view> dictionary() const
+        {
+            expect( Encoding::DICTIONARY );
+            std::vector<std::string_view> entries;
+            detail::Cursor cursor{ m_values };
+            read_dictionary( cursor, entries );
+            return entries;
+        }
+
+        /**
+         * Decodes the dictionary ids of a `DICTIONARY` column, which index `dictionary()`.
+        */
+        void ids( std::vector<uint32_t>& out ) const
+        {
+            expect( Encoding::DICTIONARY );
+            std::vector<std::string_view> entries;
+            detail::Cursor cursor{ m_values };
+            read_dictionary( cursor, entries );
+            out.assign( m_record_count, 0 );
+            for_each_present( [&]( size_t record )
+            {
+                uint64_t id;
+                if( !cursor.varint( id ) || id >= entries.size() )
+                {
+                    malformed();
+                }
+                out[record] = static_cast<uint32_t>( id );
+            });
+        }
+
+        /**
+         * Decodes a `DICTIONARY` or `STRINGS` column into views of the mapped file.
+        */
+        void strings( std::vector<std::string_view>& out ) const
+        {
+            out.assign( m_record_count, {} );
+            if( m_encoding == Encoding::DICTIONARY )
+            {
+                const auto entries = dictionary();
+                std::vector<uint32_t> values;
+                ids( values );
+                for_each_present( [&]( size_t record ){ out[record] = entries[values[record]]; } );
+                return;
+            }
+            expect( Encoding::STRINGS );
+
+            // Sizes come first and the heap follows them
+            detail::Cursor cursor{ m_values };
+            std::vector<uint64_t> sizes;
+            sizes.reserve( m_present_count );
+            uint64_t total = 0;
+            for( uint64_t i = 0; i < m_present_count; ++i )
+            {
+                uint64_t size;
+                if( !cursor.varint( size ) )
+                {
+                    malformed();
+                }
+                sizes.push_back( size );
+                total += size;
+            }
+            std::string_view heap;
+            if( !cursor.bytes( heap, total ) )
+            {
+                malformed();
+            }
+            size_t next = 0;
+            size_t offset = 0;
+            for_each_present( [&]( size_t record )
+            {
+                out[record] = heap.substr( offset, sizes[next] );
+                offset += sizes[next++];
+            });
+        }
+
+    private:
+
+        template <typename FnT>
+        void for_each_present( FnT&& fn ) const
+        {
+            for( size_t record = 0; record < m_record_count; ++record )
+            {
+                if( has_value( record ) )
+                {
+                    fn( record );
+                }
+            }
+        }
+
+        void read_dictionary( detail::Cursor&                 cursor,
+                              std::vector<std::string_view>& entries ) const
+        {
+            uint64_t count;
+            if( !cursor.varint( count ) )
+            {
+                malformed();
+            }
+            for( uint64_t i = 0; i < count; ++i )
+            {
+                uint64_t size;
+                std::string_view entry;
+                if( !cursor.varint( size ) || !cursor.bytes( entry, size ) )
+                {
+                    malformed();
+                }
+                entries.push_back( entry );
+            }
+        }
+
+        void expect( Encoding encoding ) const
+        {
+            if( m_encoding != encoding )
+            {
+                throw std::runtime_error( "Column \"" + std::string{ m_name } + "\" has a different encoding" );
+            }
+        }
+
+        [[noreturn]] void malformed() const
+        {
+            throw std::runtime_error( "Malformed column \"" + std::string{ m_name } + "\"" );
+        }
+
+        std::string_view m_name;
+
+        Encoding m_encoding;
+
+        uint32_t m_record_count;
+
+        uint64_t m_present_count{ 0 };
+
+        std::string_view m_bitmap;
+
+        std::string_view m_values;
+
+}; // End of Column_View class
+
+/**
+ * One block of a columnar file.  Only the block's column directory is parsed; the
+ * values of a column are decoded when that column is asked for.
+*/
+class Block_View
+{
+    public:
+
+        /**
+         * @throws std::runtime_error if the block is malformed.
+        */
+        Block_View( std::string_view body,
+                    uint64_t         offset )
+          : m_offset{ offset }
+        {
+            detail::Cursor cursor{ body };
+            uint16_t columns;
+            if( !cursor.le( m_record_count ) || !cursor.le( columns ) )
+            {
+                throw std::runtime_error( "Malformed block at offset " + std::to_string( offset ) );
+            }
+            for( uint16_t i = 0; i < columns; ++i )
+            {
+                uint8_t name_size;
+                uint8_t encoding;
+                uint32_t size;
+                std::string_view name;
+                std::string_view data;
+                if( !cursor.le( name_size ) || !cursor.bytes( name, name_size ) || !cursor.le( encoding ) ||
+                    !cursor.le( size ) || !cursor.bytes( data, size ) )
+                {
+                    throw std::runtime_error( "Malformed block at offset " + std::to_string( offset ) );
+                }
+                m_columns.emplace_back( name, static_cast<Encoding>( encoding ), m_record_count, data );
+            }
+        }
+
+        [[nodiscard]] uint32_t record_count() const
+        {
+            return m_record_count;
+        }
+
+        /// Offset of the block in its file
+        [[nodiscard]] uint64_t offset() const
+        {
+            return m_offset;
+        }
+
+        [[nodiscard]] const std::vector<Column_View>& columns() const
+        {
+            return m_columns;
+        }
+
+        /**
+         * Returns the named column, or nothing if no record of the block has a value.
+        */
+        [[nodiscard]] std::optional<Column_View> column( std::string_view name ) const
+        {
+            for( const auto& column : m_columns )
+            {
+                if( column.name() == name )
+                {
+                    return column;
+                }
+            }
+            return std::nullopt;
+        }
+
+    private:
+
+        uint64_t m_offset;
+
+        uint32_t m_record_count{ 0 };
+
+        std::vector<Column_View> m_columns;
+
+}; // End of Block_View class
+
+/**
+ * Memory-mapped columnar file and its blocks.  A block cut short at the end of the file,
+ * such as one being written, is left out.
+*/
+class Column_File
+{
+    public:
+
+        /**
+         * @throws std::runtime_error if the file cannot be read or is not a columnar file.
+        */
+        explicit Column_File( const std::string& path )
+          : m_file{ path }
+        {
+            const auto data = m_file.data();
+            if( !data.starts_with( FILE_MAGIC ) )
+            {
+                throw std::runtime_error( "\"" + path + "\" is not a columnar log file" );
+            }
+            detail::Cursor cursor{ data.substr( FILE_MAGIC.size() ) };
+            while( !cursor.rest().empty() )
+            {
+                const auto offset = static_cast<uint64_t>( cursor.rest().data() - data.data() );
+                std::string_view magic;
+                uint32_t size;
+                std::string_view body;
+                if( !cursor.bytes( magic, BLOCK_MAGIC.size() ) || !cursor.le( size ) || !cursor.bytes( body, size ) )
+                {
+                    break;
+                }
+                if( magic != BLOCK_MAGIC )
+                {
+                    throw std::runtime_error( "Malformed block at offset " + std::to_string( offset ) + " of \"" + path + "\"" );
+                }
+                m_blocks.emplace_back( body, offset );
+            }
+        }
+
+        [[nodiscard]] const std::vector<Block_View>& blocks() const
+        {
+            return m_blocks;
+        }
+
+        [[nodiscard]] uint64_t record_count() const
+        {
+            uint64_t count = 0;
+            for( const auto& block : m_blocks )
+            {
+                count += block.record_count();
+            }
+            return count;
+        }
+
+        [[nodiscard]] const std::string& path() const
+        {
+            return m_file.path();
+        }
+
+    private:
+
+        reader::Mapped_File m_file;
+
+        std::vector<Block_View> m_blocks;
+
+}; // End of Column_File class
+
+} // End of tmns::log::impl::columnar namespace
@@ -0,0 +1,428 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    file_index.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Project Libraries
+#include <terminus/log/impl/reader.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <optional>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace tmns::log::impl::index {
+
+/**
+ * One block of consecutive records in a log file.  Times are microseconds since the UNIX
+ * epoch in UTC, and ids are "RecordID" values.
+*/
+struct Index_Entry
+{
+    /// Byte offset of the block's first record
+    uint64_t offset{ 0 };
+
+    int64_t min_time{ 0 };
+
+    int64_t max_time{ 0 };
+
+    uint64_t min_id{ 0 };
+
+    uint64_t max_id{ 0 };
+
+}; // End of Index_Entry struct
+
+/**
+ * Returns the sidecar index file name of a log file: "<file>.idx".
+*/
+inline std::string index_file_name( const std::string& log_file )
+{
+    return log_file + ".idx";
+}
+
+using reader::parse_time_stamp;
+
+/**
+ * Builds the index of one log file as records are written.  A block ends when a record
+ * falls in a different time bucket of `interval` microseconds, or when it holds
+ * `max_records` records.
+*/
+class Index_Builder
+{
+    public:
+
+        explicit Index_Builder( int64_t  interval    = 1000000,
+                                uint64_t max_records = 10000 )
+          : m_interval{ std::max<int64_t>( interval, 1 ) },
+            m_max_records{ std::max<uint64_t>( max_records, 1 ) }
+        {
+        }
+
+        /**
+         * Starts the index of a new file, keeping `entries` of an existing index.
+        */
+        void reset( std::vector<Index_Entry> entries = {} )
+        {
+            m_entries = std::move( entries );
+            m_block_records = 0;
+        }
+
+        /**
+         * Returns true if a record at `time` cannot join the current block.
+        */
+        [[nodiscard]] bool starts_block( int64_t time ) const
+        {
+            return m_block_records == 0 || m_block_records >= m_max_records ||
+                   bucket( time ) != bucket( m_entries.back().min_time );
+        }
+
+        void begin_block( uint64_t offset )
+        {
+            m_entries.push_back( { offset,
+                                   std::numeric_limits<int64_t>::max(), std::numeric_limits<int64_t>::min(),
+                                   std::numeric_limits<uint64_t>::max(), 0 } );
+            m_block_records = 0;
+        }
+
+        void add( int64_t  time,
+                  uint64_t id )
+        {
+            auto& entry = m_entries.back();
+            entry.min_time = std::min( entry.min_time, time );
+            entry.max_time = std::max( entry.max_time, time );
+            entry.min_id   = std::min( entry.min_id, id );
+            entry.max_id   = std::max( entry.max_id, id );
+            ++m_block_records;
+        }
+
+        [[nodiscard]] const std::vector<Index_Entry>& entries() const
+        {
+            return m_entries;
+        }
+
+    private:
+
+        int64_t bucket( int64_t time ) const
+        {
+            return time >= 0 ? time / m_interval : ( time + 1 ) / m_interval - 1;
+        }
+
+        int64_t m_interval;
+
+        uint64_t m_max_records;
+
+        std::vector<Index_Entry> m_entries;
+
+        /// Records in the last entry
+        uint64_t m_block_records{ 0 };
+
+}; // End of Index_Builder class
+
+namespace detail {
+
+constexpr std::string_view INDEX_MAGIC{ "TMNSIDX1" };
+
+inline void put_u64( std::string& out, uint64_t value )
+{
+    for( int i = 0; i < 8; ++i )
+    {
+        out.push_back( static_cast<char>( ( value >> ( 8 * i ) ) & 0xff ) );
+    }
+}
+
+inline uint64_t get_u64( const char* data )
+{
+    uint64_t value = 0;
+    for( int i = 7; i >= 0; --i )
+    {
+        value = ( value << 8 ) | static_cast<unsigned char>( data[i] );
+    }
+    return value;
+}
+
+} // End of detail namespace
+
+/**
+ * Writes an index file: the magic "TMNSIDX1", the byte size of the log file covered by
+ * the index, the number of entries, and the entries, all as little-endian 64-bit values.
+ * The file is written under a temporary name and renamed, so readers never see a partial
+ * index.  Returns false if it cannot be written.
+*/
+inline bool write_index( const std::string&              index_file,
+                         uint64_t                        indexed_size,
+                         const std::vector<Index_Entry>& entries )
+{
+    std::string data{ detail::INDEX_MAGIC };
+    data.reserve( data.size() + 16 + entries.size() * 40 );
+    detail::put_u64( data, indexed_size );
+    detail::put_u64( data, entries.size() );
+    for( const auto& entry : entries )
+    {
+        detail::put_u64( data, entry.offset );
+        detail::put_u64( data, static_cast<uint64_t>( entry.min_time ) );
+        detail::put_u64( data, static_cast<uint64_t>( entry.max_time ) );
+        detail::put_u64( data, entry.min_id );
+        detail::put_u64( data, entry.max_id );
+    }
+
+    const auto temporary = index_file + ".tmp";
+    {
+        std::ofstream output{ temporary, std::ios::binary | std::ios::trunc };
+        if( !output.write( data.data(), static_cast<std::streamsize>( data.size() ) ) )
+        {
+            return false;
+        }
+    }
+    std::error_code error;
+    std::filesystem::rename( temporary, index_file, error );
+    return !error;
+}
+
+/**
+ * Index of a log file, answering which byte range of the file can hold the records of a
+ * time or "RecordID" window.
+ *
+ * Records are written in nearly, not strictly, increasing time and id order, so the
+ * searches run on the running maximum and the trailing minimum of the blocks.  Both are
+ * sorted, which makes every search a binary search that never skips a matching record.
+*/
+class File_Index
+{
+    public:
+
+        File_Index( uint64_t                 indexed_size,
+                    std::vector<Index_Entry> entries )
+          : m_indexed_size{ indexed_size },
+            m_entries{ std::move( entries ) },
+            m_max_time( m_entries.size() ),
+            m_max_id( m_entries.size() ),
+            m_min_time( m_entries.size() ),
+            m_min_id( m_entries.size() )
+        {
+            for( size_t i = 0; i < m_entries.size(); ++i )
+            {
+                m_max_time[i] = std::max( m_entries[i].max_time, i > 0 ? m_max_time[i - 1] : m_entries[i].max_time );
+                m_max_id[i]   = std::max( m_entries[i].max_id, i > 0 ? m_max_id[i - 1] : m_entries[i].max_id );
+            }
+            for( size_t i = m_entries.size(); i-- > 0; )
+            {
+                const bool last = i + 1 == m_entries.size();
+                m_min_time[i] = std::min( m_entries[i].min_time, last ? m_entries[i].min_time : m_min_time[i + 1] );
+                m_min_id[i]   = std::min( m_entries[i].min_id, last ? m_entries[i].min_id : m_min_id[i + 1] );
+            }
+        }
+
+        /**
+         * Reads an index file.  Returns nothing if it is missing or malformed.
+        */
+        static std::optional<File_Index> load( const std::string& index_file )
+        {
+            std::ifstream input{ index_file, std::ios::binary };
+            std::array<char,24> header{};
+            if( !input.read( header.data(), header.size() ) ||
+                std::string_view{ header.data(), detail::INDEX_MAGIC.size() } != detail::INDEX_MAGIC )
+            {
+                return std::nullopt;
+            }
+            const uint64_t indexed_size = detail::get_u64( header.data() + 8 );
+            const uint64_t count        = detail::get_u64( header.data() + 16 );
+
+            std::vector<Index_Entry> entries;
+            std::array<char,40> data{};
+            for( uint64_t i = 0; i < count; ++i )
+            {
+                if( !input.read( data.data(), data.size() ) )
+                {
+                    return std::nullopt;
+                }
+                entries.push_back( { detail::get_u64( data.data() ),
+                                     static_cast<int64_t>( detail::get_u64( data.data() + 8 ) ),
+                                     static_cast<int64_t>( detail::get_u64( data.data() + 16 ) ),
+                                     detail::get_u64( data.data() + 24 ),
+                                     detail::get_u64( data.data() + 32 ) } );
+            }
+            return File_Index{ indexed_size, std::move( entries ) };
+        }
+
+        /**
+         * Returns the offset to start reading at for records at or after `time`.  Returns
+         * the indexed size if no indexed record is, since later records were not indexed.
+        */
+        [[nodiscard]] uint64_t time_begin( int64_t time ) const
+        {
+            return begin( m_max_time, time );
+        }
+
+        /**
+         * Returns the offset to stop reading at for records at or before `time`, or
+         * nothing to read to the end of the file.
+        */
+        [[nodiscard]] std::optional<uint64_t> time_end( int64_t time ) const
+        {
+            return end( m_min_time, time );
+        }
+
+        [[nodiscard]] uint64_t id_begin( uint64_t id ) const
+        {
+            return begin( m_max_id, id );
+        }
+
+        [[nodiscard]] std::optional<uint64_t> id_end( uint64_t id ) const
+        {
+            return end( m_min_id, id );
+        }
+
+        [[nodiscard]] uint64_t indexed_size() const
+        {
+            return m_indexed_size;
+        }
+
+        [[nodiscard]] const std::vector<Index_Entry>& entries() const
+        {
+            return m_entries;
+        }
+
+    private:
+
+        template <typename ValueT>
+        uint64_t begin( const std::vector<ValueT>& running_max,
+                        ValueT                     value ) const
+        {
+            auto it = std::lower_bound( running_max.begin(), running_max.end(), value );
+            return it == running_max.end() ? m_indexed_size : m_entries[static_cast<size_t>( it - running_max.begin() )].offset;
+        }
+
+        template <typename ValueT>
+        std::optional<uint64_t> end( const std::vector<ValueT>& trailing_min,
+                                     ValueT                     value ) const
+        {
+            auto it = std::upper_bound( trailing_min.begin(), trailing_min.end(), value );
+            if( it == trailing_min.end() )
+            {
+                return std::nullopt;
+            }
+            return m_entries[static_cast<size_t>( it - trailing_min.begin() )].offset;
+        }
+
+        uint64_t m_indexed_size;
+
+        std::vector<Index_Entry> m_entries;
+
+        std::vector<int64_t> m_max_time;
+
+        std::vector<uint64_t> m_max_id;
+
+        std::vector<int64_t> m_min_time;
+
+        std::vector<uint64_t> m_min_id;
+
+}; // End of File_Index class
+
+/**
+ * Time and "RecordID" bounds of the records to read, all inclusive.
+*/
+struct Window
+{
+    std::optional<int64_t> from_time;
+
+    std::optional<int64_t> to_time;
+
+    std::optional<uint64_t> from_id;
+
+    std::optional<uint64_t> to_id;
+
+}; // End of Window struct
+
+/**
+ * Writes the lines of a log file that fall in `window` to `output`, and returns how many
+ * were written.  The file is memory-mapped; see `reader::Log_File`.
+ *
+ * With a sidecar index, reading starts at the first block that can hold a record in the
+ * window and stops once the index shows no later record can, so only a few blocks are
+ * read.  Without one, the whole file is read.  Lines of `format::json` are then checked
+ * against the window by their "TimeStamp" and "RecordID"; other lines are written when
+ * their block is read.
+ *
+ * @throws std::runtime_error if the log file cannot be mapped.
+*/
+inline uint64_t read_window( const std::string& log_file,
+                             const Window&      window,
+                             std::ostream&      output )
+{
+    reader::Log_File file{ log_file };
+
+    uint64_t begin = 0;
+    uint64_t end   = file.data().size();
+    if( auto index = File_Index::load( index_file_name( log_file ) ) )
+    {
+        auto narrow = [&end]( std::optional<uint64_t> offset )
+        {
+            if( offset )
+            {
+                end = std::min( end, *offset );
+            }
+        };
+        if( window.from_time )
+        {
+            begin = std::max( begin, index->time_begin( *window.from_time ) );
+        }
+        if( window.from_id )
+        {
+            begin = std::max( begin, index->id_begin( *window.from_id ) );
+        }
+        if( window.to_time )
+        {
+            narrow( index->time_end( *window.to_time ) );
+        }
+        if( window.to_id )
+        {
+            narrow( index->id_end( *window.to_id ) );
+        }
+    }
+
+    uint64_t count = 0;
+    for( const auto& record : file.records( begin, end ) )
+    {
+        if( auto time = record.time_stamp() )
+        {
+            if( ( window.from_time && *time < *window.from_time ) || ( window.to_time && *time > *window.to_time ) )
+            {
+                continue;
+            }
+        }
+        if( auto id = record.record_id() )
+        {
+            if( ( window.from_id && *id < *window.from_id ) || ( window.to_id && *id > *window.to_id ) )
+            {
+                continue;
+            }
+        }
+        output << record.line() << '\n';
+        ++count;
+    }
+    return count;
+}
+
+} // End of tmns::log::impl::index namespace
@@ -0,0 +1,46 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    fixed_string.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// C++ Libraries
+#include <cstddef>
+#include <string_view>
+
+namespace tmns::log::impl {
+
+/**
+ * String literal usable as a template argument, e.g. the scope of `Static_Logger<"net.http">`.
+*/
+template <size_t N>
+struct Fixed_String
+{
+    constexpr Fixed_String( const char (&str)[N] )
+    {
+        for( size_t i = 0; i < N; ++i )
+        {
+            value[i] = str[i];
+        }
+    }
+
+    [[nodiscard]] constexpr std::string_view view() const
+    {
+        return { value, N - 1 };
+    }
+
+    char value[N];
+
+}; // End of Fixed_String struct
+
+} // End of tmns::log::impl namespace
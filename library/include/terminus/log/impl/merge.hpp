@@ -0,0 +1,225 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    merge.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// C++ Libraries
+#include <charconv>
+#include <cstdint>
+#include <fstream>
+#include <istream>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace tmns::log::impl::merge {
+
+/**
+ * What `merge_streams()` orders records by.
+*/
+enum class Merge_Key
+{
+    /// The "RecordID" of JSON records, the order the records were opened in one process
+    RECORD_ID,
+
+    /// The "TimeStamp" of JSON records, to merge the files of several processes
+    TIME_STAMP,
+
+    /// The whole line, for text formats that start with the time stamp
+    LINE,
+}; // End of Merge_Key enum
+
+/**
+ * Parses the name of a merge key: "RecordID", "TimeStamp", or "Line".
+*/
+inline Merge_Key parse_merge_key( std::string_view name )
+{
+    if( name == "RecordID" )
+    {
+        return Merge_Key::RECORD_ID;
+    }
+    if( name == "TimeStamp" )
+    {
+        return Merge_Key::TIME_STAMP;
+    }
+    if( name == "Line" )
+    {
+        return Merge_Key::LINE;
+    }
+    throw std::runtime_error( "Invalid merge key \"" + std::string{ name } + "\": must be RecordID, TimeStamp, or Line" );
+}
+
+namespace detail {
+
+/**
+ * Returns the raw value of a top-level member of a JSON line written by `format::json`:
+ * the digits of a number, or the contents of a string without its quotes.  Returns
+ * nothing if the line has no such member.
+*/
+inline std::optional<std::string_view> find_json_value( std::string_view line,
+                                                        std::string_view name )
+{
+    std::string key;
+    key.reserve( name.size() + 3 );
+    key.push_back( '"' );
+    key.append( name );
+    key.append( "\":" );
+
+    auto pos = line.find( key );
+    if( pos == std::string_view::npos )
+    {
+        return std::nullopt;
+    }
+    auto value = line.substr( pos + key.size() );
+    if( !value.empty() && value.front() == '"' )
+    {
+        auto end = value.find( '"', 1 );
+        return end == std::string_view::npos ? std::nullopt : std::optional{ value.substr( 1, end - 1 ) };
+    }
+    auto end = value.find_first_not_of( "0123456789" );
+    return value.substr( 0, end );
+}
+
+/**
+ * One input and its current line.  The key of a line without the merge key is the key of
+ * the line before it, so such lines stay next to their neighbours.
+*/
+struct Cursor
+{
+    std::istream* input{ nullptr };
+
+    std::string line;
+
+    uint64_t record_id{ 0 };
+
+    std::string time_stamp;
+
+    bool next( Merge_Key key )
+    {
+        if( !std::getline( *input, line ) )
+        {
+            return false;
+        }
+        if( key == Merge_Key::RECORD_ID )
+        {
+            if( auto value = find_json_value( line, "RecordID" ) )
+            {
+                std::from_chars( value->data(), value->data() + value->size(), record_id );
+            }
+        }
+        else if( key == Merge_Key::TIME_STAMP )
+        {
+            if( auto value = find_json_value( line, "TimeStamp" ) )
+            {
+                time_stamp.assign( *value );
+            }
+        }
+        return true;
+    }
+
+}; // End of Cursor struct
+
+} // End of detail namespace
+
+/**
+ * Merges log files that are each ordered by `key`, such as the per-thread shards of a
+ * "%T" file sink, into one ordered stream.  Lines with equal keys keep the order of the
+ * inputs.  Returns the number of lines written.
+*/
+inline uint64_t merge_streams( const std::vector<std::istream*>& inputs,
+                               std::ostream&                     output,
+                               Merge_Key                         key )
+{
+    std::vector<detail::Cursor> cursors;
+    cursors.reserve( inputs.size() );
+    for( auto* input : inputs )
+    {
+        detail::Cursor cursor;
+        cursor.input = input;
+        cursors.push_back( std::move( cursor ) );
+    }
+
+    auto later = [&cursors, key]( size_t lhs, size_t rhs )
+    {
+        const auto& a = cursors[lhs];
+        const auto& b = cursors[rhs];
+        int order = 0;
+        switch( key )
+        {
+            case Merge_Key::RECORD_ID:
+                order = a.record_id < b.record_id ? -1 : ( a.record_id > b.record_id ? 1 : 0 );
+                break;
+            case Merge_Key::TIME_STAMP:
+                order = a.time_stamp.compare( b.time_stamp );
+                break;
+            case Merge_Key::LINE:
+                order = a.line.compare( b.line );
+                break;
+        }
+        return order > 0 || ( order == 0 && lhs > rhs );
+    };
+    std::priority_queue<size_t,std::vector<size_t>,decltype( later )> heap{ later };
+    for( size_t i = 0; i < cursors.size(); ++i )
+    {
+        if( cursors[i].next( key ) )
+        {
+            heap.push( i );
+        }
+    }
+
+    uint64_t count = 0;
+    while( !heap.empty() )
+    {
+        auto index = heap.top();
+        heap.pop();
+        output << cursors[index].line << '\n';
+        ++count;
+        if( cursors[index].next( key ) )
+        {
+            heap.push( index );
+        }
+    }
+    return count;
+}
+
+/**
+ * Merges the provided files.  See `merge_streams()`.
+ *
+ * @throws std::runtime_error if a file cannot be opened.
+*/
+inline uint64_t merge_files( const std::vector<std::string>& files,
+                             std::ostream&                   output,
+                             Merge_Key                       key )
+{
+    std::vector<std::unique_ptr<std::ifstream>> streams;
+    std::vector<std::istream*> inputs;
+    for( const auto& file : files )
+    {
+        auto stream = std::make_unique<std::ifstream>( file );
+        if( !stream->is_open() )
+        {
+            throw std::runtime_error( "Failed to open \"" + file + "\"" );
+        }
+        inputs.push_back( stream.get() );
+        streams.push_back( std::move( stream ) );
+    }
+    return merge_streams( inputs, output, key );
+}
+
+} // End of tmns::log::impl::merge namespace
@@ -0,0 +1,866 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    reader.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// C++ Libraries
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+// POSIX
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace tmns::log::impl::reader {
+
+/**
+ * Returns the first '\n' in [begin, end), or `end` if there is none.  Compares 32 bytes
+ * per step with AVX2, 16 with SSE2 or NEON, and falls back to `memchr` elsewhere and for
+ * the tail.
+*/
+inline const char* find_newline( const char* begin,
+                                 const char* end )
+{
+    const char* pos = begin;
+#if defined(__AVX2__)
+    const __m256i newline = _mm256_set1_epi8( '\n' );
+    for( ; end - pos >= 32; pos += 32 )
+    {
+        const __m256i block = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( pos ) );
+        const auto mask = static_cast<uint32_t>( _mm256_movemask_epi8( _mm256_cmpeq_epi8( block, newline ) ) );
+        if( mask != 0 )
+        {
+            return pos + __builtin_ctz( mask );
+        }
+    }
+#elif defined(__SSE2__)
+    const __m128i newline = _mm_set1_epi8( '\n' );
+    for( ; end - pos >= 16; pos += 16 )
+    {
+        const __m128i block = _mm_loadu_si128( reinterpret_cast<const __m128i*>( pos ) );
+        const auto mask = static_cast<uint32_t>( _mm_movemask_epi8( _mm_cmpeq_epi8( block, newline ) ) );
+        if( mask != 0 )
+        {
+            return pos + __builtin_ctz( mask );
+        }
+    }
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+    const uint8x16_t newline = vdupq_n_u8( '\n' );
+    for( ; end - pos >= 16; pos += 16 )
+    {
+        const uint8x16_t block = vld1q_u8( reinterpret_cast<const uint8_t*>( pos ) );
+        if( vmaxvq_u8( vceqq_u8( block, newline ) ) != 0 )
+        {
+            break;
+        }
+    }
+#endif
+    const void* found = pos < end ? std::memchr( pos, '\n', static_cast<size_t>( end - pos ) ) : nullptr;
+    return found == nullptr ? end : static_cast<const char*>( found );
+}
+
+/**
+ * Parses an ISO 8601 time such as "2026-10-19T10:00:01.123456", as written by the
+ * "TimeStamp" of `format::json`, into microseconds since the UNIX epoch.  A space may
+ * separate the date and time, the fraction is optional, and a trailing 'Z' is ignored.
+ * Times are taken as UTC.
+*/
+inline std::optional<int64_t> parse_time_stamp( std::string_view text )
+{
+    auto number = [&text]( size_t pos, size_t digits ) -> std::optional<int64_t>
+    {
+        int64_t value = 0;
+        if( pos + digits > text.size() )
+        {
+            return std::nullopt;
+        }
+        auto [end, error] = std::from_chars( text.data() + pos, text.data() + pos + digits, value );
+        if( error != std::errc{} || end != text.data() + pos + digits )
+        {
+            return std::nullopt;
+        }
+        return value;
+    };
+
+    auto year   = number( 0, 4 );
+    auto month  = number( 5, 2 );
+    auto day    = number( 8, 2 );
+    auto hour   = number( 11, 2 );
+    auto minute = number( 14, 2 );
+    auto second = number( 17, 2 );
+    if( !year || !month || !day || !hour || !minute || !second ||
+        text[4] != '-' || text[7] != '-' || ( text[10] != 'T' && text[10] != ' ' ) ||
+        text[13] != ':' || text[16] != ':' )
+    {
+        return std::nullopt;
+    }
+
+    // Days from the civil date, after Howard Hinnant's days_from_civil
+    const int64_t y   = *year - ( *month <= 2 ? 1 : 0 );
+    const int64_t era = ( y >= 0 ? y : y - 399 ) / 400;
+    const int64_t yoe = y - era * 400;
+    const int64_t doy = ( 153 * ( *month + ( *month > 2 ? -3 : 9 ) ) + 2 ) / 5 + *day - 1;
+    const int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    const int64_t days = era * 146097 + doe - 719468;
+
+    int64_t micros = ( ( days * 24 + *hour ) * 60 + *minute ) * 60 + *second;
+    micros *= 1000000;
+
+    if( text.size() > 19 && text[19] == '.' )
+    {
+        int64_t scale = 100000;
+        for( size_t pos = 20; pos < text.size() && text[pos] >= '0' && text[pos] <= '9'; ++pos, scale /= 10 )
+        {
+            micros += ( text[pos] - '0' ) * scale;
+        }
+    }
+    return micros;
+}
+
+/**
+ * Read-only view of a whole file.  On POSIX systems the file is memory-mapped, so the
+ * view is backed by the page cache and reading it copies nothing; elsewhere the file is
+ * read into memory.
+*/
+class Mapped_File
+{
+    public:
+
+        /**
+         * @throws std::runtime_error if the file cannot be opened or mapped.
+        */
+        explicit Mapped_File( const std::string& path )
+          : m_path{ path }
+        {
+#if defined(__unix__) || defined(__APPLE__)
+            int fd = ::open( path.c_str(), O_RDONLY | O_CLOEXEC );
+            if( fd < 0 )
+            {
+                throw std::runtime_error( "Failed to open \"" + path + "\": " + std::strerror( errno ) );
+            }
+            struct stat status{};
+            if( ::fstat( fd, &status ) != 0 )
+            {
+                ::close( fd );
+                throw std::runtime_error( "Failed to stat \"" + path + "\": " + std::strerror( errno ) );
+            }
+            m_size = static_cast<size_t>( status.st_size );
+            if( m_size > 0 )
+            {
+                void* address = ::mmap( nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+                if( address == MAP_FAILED )
+                {
+                    ::close( fd );
+                    throw std::runtime_error( "Failed to map \"" + path + "\": " + std::strerror( errno ) );
+                }
+                ::madvise( address, m_size, MADV_SEQUENTIAL );
+                m_data = static_cast<const char*>( address );
+            }
+            ::close( fd );
+#else
+            std::ifstream input{ path, std::ios::binary };
+            if( !input.is_open() )
+            {
+                throw std::runtime_error( "Failed to open \"" + path + "\"" );
+            }
+            m_buffer.assign( std::istreambuf_iterator<char>{ input }, std::istreambuf_iterator<char>{} );
+            m_data = m_buffer.data();
+            m_size = m_buffer.size();
+#endif
+        }
+
+        Mapped_File( const Mapped_File& ) = delete;
+        Mapped_File& operator=( const Mapped_File& ) = delete;
+
+        ~Mapped_File()
+        {
+#if defined(__unix__) || defined(__APPLE__)
+            if( m_data != nullptr )
+            {
+                ::munmap( const_cast<char*>( m_data ), m_size );
+            }
+#endif
+        }
+
+        [[nodiscard]] std::string_view data() const
+        {
+            return { m_data, m_size };
+        }
+
+        [[nodiscard]] const std::string& path() const
+        {
+            return m_path;
+        }
+
+    private:
+
+        std::string m_path;
+
+        const char* m_data{ nullptr };
+
+        size_t m_size{ 0 };
+
+#if !defined(__unix__) && !defined(__APPLE__)
+        std::string m_buffer;
+#endif
+
+}; // End of Mapped_File class
+
+namespace detail {
+
+/**
+ * Returns the end of the JSON string starting after its opening quote at `pos`: the
+ * position of the closing quote, or `end`.
+*/
+inline const char* skip_json_string( const char* pos,
+                                     const char* end )
+{
+    while( pos < end )
+    {
+        const void* found = std::memchr( pos, '"', static_cast<size_t>( end - pos ) );
+        if( found == nullptr )
+        {
+            return end;
+        }
+        const char* quote = static_cast<const char*>( found );
+        size_t backslashes = 0;
+        for( const char* back = quote; back > pos && back[-1] == '\\'; --back )
+        {
+            ++backslashes;
+        }
+        if( backslashes % 2 == 0 )
+        {
+            return quote;
+        }
+        pos = quote + 1;
+    }
+    return end;
+}
+
+/**
+ * Returns the end of the JSON value starting at `pos`.
+*/
+inline const char* skip_json_value( const char* pos,
+                                    const char* end )
+{
+    if( pos >= end )
+    {
+        return end;
+    }
+    if( *pos == '"' )
+    {
+        const char* close = skip_json_string( pos + 1, end );
+        return close == end ? end : close + 1;
+    }
+    if( *pos == '{' || *pos == '[' )
+    {
+        int depth = 0;
+        for( ; pos < end; ++pos )
+        {
+            if( *pos == '"' )
+            {
+                pos = skip_json_string( pos + 1, end );
+                if( pos == end )
+                {
+                    return end;
+                }
+            }
+            else if( *pos == '{' || *pos == '[' )
+            {
+                ++depth;
+            }
+            else if( ( *pos == '}' || *pos == ']' ) && --depth == 0 )
+            {
+                return pos + 1;
+            }
+        }
+        return end;
+    }
+    while( pos < end && *pos != ',' && *pos != '}' && *pos != ']' && *pos != ' ' )
+    {
+        ++pos;
+    }
+    return pos;
+}
+
+inline void append_utf8( std::string& out,
+                         uint32_t     code )
+{
+    if( code < 0x80 )
+    {
+        out.push_back( static_cast<char>( code ) );
+    }
+    else if( code < 0x800 )
+    {
+        out.push_back( static_cast<char>( 0xc0 | ( code >> 6 ) ) );
+        out.push_back( static_cast<char>( 0x80 | ( code & 0x3f ) ) );
+    }
+    else if( code < 0x10000 )
+    {
+        out.push_back( static_cast<char>( 0xe0 | ( code >> 12 ) ) );
+        out.push_back( static_cast<char>( 0x80 | ( ( code >> 6 ) & 0x3f ) ) );
+        out.push_back( static_cast<char>( 0x80 | ( code & 0x3f ) ) );
+    }
+    else
+    {
+        out.push_back( static_cast<char>( 0xf0 | ( code >> 18 ) ) );
+        out.push_back( static_cast<char>( 0x80 | ( ( code >> 12 ) & 0x3f ) ) );
+        out.push_back( static_cast<char>( 0x80 | ( ( code >> 6 ) & 0x3f ) ) );
+        out.push_back( static_cast<char>( 0x80 | ( code & 0x3f ) ) );
+    }
+}
+
+} // End of detail namespace
+
+/**
+ * Decodes the escapes of a raw JSON string value, such as one returned by
+ * `Record_View::field()`.  This is the only reader function that copies.
+*/
+inline std::string unescape( std::string_view raw )
+{
+    std::string out;
+    out.reserve( raw.size() );
+    for( size_t i = 0; i < raw.size(); ++i )
+    {
+        if( raw[i] != '\\' || i + 1 == raw.size() )
+        {
+            out.push_back( raw[i] );
+            continue;
+        }
+        const char escape = raw[++i];
+        switch( escape )
+        {
+            case 'b': out.push_back( '\b' ); break;
+            case 'f': out.push_back( '\f' ); break;
+            case 'n': out.push_back( '\n' ); break;
+            case 'r': out.push_back( '\r' ); break;
+            case 't': out.push_back( '\t' ); break;
+            case 'u':
+            {
+                auto hex = [&raw]( size_t pos ) -> std::optional<uint32_t>
+                {
+                    uint32_t value = 0;
+                    if( pos + 4 > raw.size() ||
+                        std::from_chars( raw.data() + pos, raw.data() + pos + 4, value, 16 ).ptr != raw.data() + pos + 4 )
+                    {
+                        return std::nullopt;
+                    }
+                    return value;
+                };
+                auto code = hex( i + 1 );
+                if( !code )
+                {
+                    out.push_back( escape );
+                    break;
+                }
+                i += 4;
+                if( *code >= 0xd800 && *code < 0xdc00 && i + 2 < raw.size() && raw[i + 1] == '\\' && raw[i + 2] == 'u' )
+                {
+                    if( auto low = hex( i + 3 ); low && *low >= 0xdc00 && *low < 0xe000 )
+                    {
+                        *code = 0x10000 + ( ( *code - 0xd800 ) << 10 ) + ( *low - 0xdc00 );
+                        i += 6;
+                    }
+                }
+                detail::append_utf8( out, *code );
+                break;
+            }
+            default: out.push_back( escape ); break;
+        }
+    }
+    return out;
+}
+
+/**
+ * One record of a log file: a line, without its newline, pointing into the mapped file.
+ *
+ * Fields of `format::json` records are found on demand by scanning the line's top-level
+ * members, so a record costs nothing until a field is asked for and a field costs one
+ * pass over the members before it.  Field values are raw: strings without their quotes
+ * and with their escapes (see `unescape()`), numbers as written, and objects or arrays
+ * as their JSON text.
+*/
+class Record_View
+{
+    public:
+
+        Record_View() = default;
+
+        Record_View( std::string_view line,
+                     uint64_t         offset )
+          : m_line{ line },
+            m_offset{ offset }
+        {
+        }
+
+        /// The whole line
+        [[nodiscard]] std::string_view line() const
+        {
+            return m_line;
+        }
+
+        /// Byte offset of the line in its file
+        [[nodiscard]] uint64_t offset() const
+        {
+            return m_offset;
+        }
+
+        [[nodiscard]] bool is_json() const
+        {
+            return !m_line.empty() && m_line.front() == '{';
+        }
+
+        /**
+         * Returns the raw value of a top-level member of a JSON record, or nothing if the
+         * record is not JSON or has no such member.
+        */
+        [[nodiscard]] std::optional<std::string_view> field( std::string_view name ) const
+        {
+            if( !is_json() )
+            {
+                return std::nullopt;
+            }
+            const char* pos = m_line.data() + 1;
+            const char* end = m_line.data() + m_line.size();
+            while( pos < end )
+            {
+                while( pos < end && ( *pos == ' ' || *pos == ',' ) )
+                {
+                    ++pos;
+                }
+                if( pos >= end || *pos != '"' )
+                {
+                    return std::nullopt;
+                }
+                const char* key_end = detail::skip_json_string( pos + 1, end );
+                std::string_view key{ pos + 1, static_cast<size_t>( key_end - pos - 1 ) };
+                pos = key_end + 1;
+                while( pos < end && ( *pos == ' ' || *pos == ':' ) )
+                {
+                    ++pos;
+                }
+                const char* value_end = detail::skip_json_value( pos, end );
+                if( key == name )
+                {
+                    if( value_end - pos >= 2 && *pos == '"' )
+                    {
+                        return std::string_view{ pos + 1, static_cast<size_t>( value_end - pos - 2 ) };
+                    }
+                    return std::string_view{ pos, static_cast<size_t>( value_end - pos ) };
+                }
+                pos = value_end;
+            }
+            return std::nullopt;
+        }
+
+        [[nodiscard]] std::optional<uint64_t> record_id() const
+        {
+            return number<uint64_t>( "RecordID" );
+        }
+
+        /**
+         * Returns the "TimeStamp" in microseconds since the UNIX epoch.
+        */
+        [[nodiscard]] std::optional<int64_t> time_stamp() const
+        {
+            if( auto value = field( "TimeStamp" ) )
+            {
+                return parse_time_stamp( *value );
+            }
+            return std::nullopt;
+        }
+
+        [[nodiscard]] std::optional<std::string_view> severity() const
+        {
+            return field( "Severity" );
+        }
+
+        [[nodiscard]] std::optional<std::string_view> scope() const
+        {
+            return field( "Scope" );
+        }
+
+        /// Raw message, with its JSON escapes
+        [[nodiscard]] std::optional<std::string_view> message() const
+        {
+            return field( "Message" );
+        }
+
+        template <typename NumberT>
+        [[nodiscard]] std::optional<NumberT> number( std::string_view name ) const
+        {
+            auto value = field( name );
+            NumberT result{};
+            if( !value || std::from_chars( value->data(), value->data() + value->size(), result ).ec != std::errc{} )
+            {
+                return std::nullopt;
+            }
+            return result;
+        }
+
+    private:
+
+        std::string_view m_line;
+
+        uint64_t m_offset{ 0 };
+
+}; // End of Record_View class
+
+/**
+ * Forward range over the records of a block of text.  Iterating finds each newline with
+ * `find_newline()` and yields views into the text; a last line without a newline is
+ * yielded too.
+*/
+class Record_Range
+{
+    public:
+
+        class Iterator
+        {
+            public:
+
+                using iterator_category = std::forward_iterator_tag;
+                using value_type        = Record_View;
+                using difference_type   = std::ptrdiff_t;
+                using pointer           = const Record_View*;
+                using reference         = const Record_View&;
+
+                Iterator() = default;
+
+                Iterator( const char* pos,
+                          const char* end,
+                          const char* base )
+                  : m_pos{ pos },
+                    m_end{ end },
+                    m_base{ base },
+                    m_done{ false }
+                {
+                    read();
+                }
+
+                reference operator*() const
+                {
+                    return m_record;
+                }
+
+                pointer operator->() const
+                {
+                    return &m_record;
+                }
+
+                Iterator& operator++()
+                {
+                    read();
+                    return *this;
+                }
+
+                Iterator operator++( int )
+                {
+                    auto copy = *this;
+                    read();
+                    return copy;
+                }
+
+                bool operator==( const Iterator& rhs ) const
+                {
+                    return m_done == rhs.m_done && ( m_done || m_record.line().data() == rhs.m_record.line().data() );
+                }
+
+            private:
+
+                void read()
+                {
+                    if( m_pos >= m_end )
+                    {
+                        m_done = true;
+                        return;
+                    }
+                    const char* newline = find_newline( m_pos, m_end );
+                    m_record = Record_View{ { m_pos, static_cast<size_t>( newline - m_pos ) },
+                                            static_cast<uint64_t>( m_pos - m_base ) };
+                    m_pos = newline == m_end ? m_end : newline + 1;
+                }
+
+                const char* m_pos{ nullptr };
+
+                const char* m_end{ nullptr };
+
+                /// Start of the file, for record offsets
+                const char* m_base{ nullptr };
+
+                Record_View m_record;
+
+                bool m_done{ true };
+
+        }; // End of Iterator class
+
+        Record_Range( std::string_view text,
+                      const char*      base )
+          : m_text{ text },
+            m_base{ base }
+        {
+        }
+
+        [[nodiscard]] Iterator begin() const
+        {
+            return { m_text.data(), m_text.data() + m_text.size(), m_base };
+        }
+
+        [[nodiscard]] Iterator end() const
+        {
+            return {};
+        }
+
+    private:
+
+        std::string_view m_text;
+
+        const char* m_base;
+
+}; // End of Record_Range class
+
+/**
+ * A mapped log file.  Records are views into the mapping and stay valid as long as the
+ * `Log_File` does.
+*/
+class Log_File
+{
+    public:
+
+        explicit Log_File( const std::string& path )
+          : m_file{ path }
+        {
+        }
+
+        [[nodiscard]] Record_Range records() const
+        {
+            return { m_file.data(), m_file.data().data() };
+        }
+
+        /**
+         * Returns the records whose lines start in [begin, end), for reading a byte range
+         * such as a block of a sidecar index.  `begin` must be the start of a line.
+        */
+        [[nodiscard]] Record_Range records( uint64_t begin,
+                                            uint64_t end ) const
+        {
+            const auto data = m_file.data();
+            begin = std::min<uint64_t>( begin, data.size() );
+            end   = std::clamp<uint64_t>( end, begin, data.size() );
+            return { data.substr( begin, end - begin ), data.data() };
+        }
+
+        [[nodiscard]] std::string_view data() const
+        {
+            return m_file.data();
+        }
+
+        [[nodiscard]] const std::string& path() const
+        {
+            return m_file.path();
+        }
+
+        /**
+         * Splits the file into chunks of about `chunk_size` bytes that start and end at
+         * line boundaries, returned as [begin, end) offsets.
+        */
+        [[nodiscard]] std::vector<std::pair<uint64_t,uint64_t>> chunks( uint64_t chunk_size ) const
+        {
+            const auto data = m_file.data();
+            const char* base = data.data();
+            const char* end  = base + data.size();
+            std::vector<std::pair<uint64_t,uint64_t>> result;
+            uint64_t begin = 0;
+            while( begin < data.size() )
+            {
+                uint64_t next = data.size();
+                if( data.size() - begin > chunk_size )
+                {
+                    const char* newline = find_newline( base + begin + chunk_size - 1, end );
+                    next = newline == end ? data.size() : static_cast<uint64_t>( newline - base ) + 1;
+                }
+                result.emplace_back( begin, next );
+                begin = next;
+            }
+            return result;
+        }
+
+    private:
+
+        Mapped_File m_file;
+
+}; // End of Log_File class
+
+/**
+ * Settings of `for_each_chunk()` and `scan()`.
+*/
+struct Scan_Options
+{
+    /// Worker threads, or 0 for one per hardware thread
+    size_t threads{ 0 };
+
+    /// Bytes per chunk handed to a worker
+    uint64_t chunk_size{ 8 * 1024 * 1024 };
+
+}; // End of Scan_Options struct
+
+/**
+ * A line-aligned piece of one file, handed to a `for_each_chunk()` callback.
+*/
+struct Chunk
+{
+    const Log_File* file;
+
+    /// Position of the file in the list given to `for_each_chunk()`
+    size_t file_index;
+
+    /// Position of the chunk across all files, in file order
+    size_t sequence;
+
+    uint64_t begin;
+
+    uint64_t end;
+
+    [[nodiscard]] Record_Range records() const
+    {
+        return file->records( begin, end );
+    }
+
+}; // End of Chunk struct
+
+/**
+ * Maps the files, splits them into line-aligned chunks, and calls `fn( const Chunk& )`
+ * for every chunk from a pool of worker threads.  Chunks are handed out in file order,
+ * and their `sequence` lets callers put per-chunk results back in that order.  The first
+ * exception thrown by `fn` stops the scan and is rethrown.
+ *
+ * @throws std::runtime_error if a file cannot be mapped.
+*/
+template <typename FnT>
+void for_each_chunk( const std::vector<std::string>& paths,
+                     FnT&&                           fn,
+                     const Scan_Options&             options = {} )
+{
+    std::vector<std::unique_ptr<Log_File>> files;
+    std::vector<Chunk> chunks;
+    for( size_t i = 0; i < paths.size(); ++i )
+    {
+        files.push_back( std::make_unique<Log_File>( paths[i] ) );
+        for( const auto& [begin, end] : files.back()->chunks( std::max<uint64_t>( options.chunk_size, 1 ) ) )
+        {
+            chunks.push_back( { files.back().get(), i, chunks.size(), begin, end } );
+        }
+    }
+
+    size_t threads = options.threads != 0 ? options.threads : std::max( 1u, std::thread::hardware_concurrency() );
+    threads = std::min( threads, chunks.size() );
+
+    std::atomic<size_t> next{ 0 };
+    std::atomic<bool> failed{ false };
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    auto work = [&]()
+    {
+        for( size_t i = next.fetch_add( 1 ); i < chunks.size() && !failed.load(); i = next.fetch_add( 1 ) )
+        {
+            try
+            {
+                fn( chunks[i] );
+            }
+            catch( ... )
+            {
+                std::lock_guard<std::mutex> lock{ error_mutex };
+                if( !error )
+                {
+                    error = std::current_exception();
+                }
+                failed = true;
+            }
+        }
+    };
+
+    if( threads <= 1 )
+    {
+        work();
+    }
+    else
+    {
+        std::vector<std::thread> workers;
+        for( size_t t = 0; t < threads; ++t )
+        {
+            workers.emplace_back( work );
+        }
+        for( auto& worker : workers )
+        {
+            worker.join();
+        }
+    }
+    if( error )
+    {
+        std::rethrow_exception( error );
+    }
+}
+
+/**
+ * Calls `fn( const Record_View& )` for every record of the files, from several threads
+ * at once, and returns the number of records.  `fn` must be safe to call concurrently.
+ * See `for_each_chunk()`.
+*/
+template <typename FnT>
+uint64_t scan( const std::vector<std::string>& paths,
+               FnT&&                           fn,
+               const Scan_Options&             options = {} )
+{
+    std::atomic<uint64_t> count{ 0 };
+    for_each_chunk( paths, [&fn, &count]( const Chunk& chunk )
+    {
+        uint64_t records = 0;
+        for( const auto& record : chunk.records() )
+        {
+            fn( record );
+            ++records;
+        }
+        count.fetch_add( records, std::memory_order_relaxed );
+    }, options );
+    return count.load();
+}
+
+} // End of tmns::log::impl::reader namespace
@@ -0,0 +1,514 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    search.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Project Libraries
+#include <terminus/log/impl/file_index.hpp>
+#include <terminus/log/impl/reader.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <regex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace tmns::log::impl::search {
+
+/**
+ * Returns the first occurrence of `needle` in [begin, end), or `end`.  With SSE2 or AVX2,
+ * candidate positions are found by comparing the needle's first and last bytes against
+ * 16 or 32 positions at once, and only those are compared in full.
+*/
+inline const char* find_literal( const char*      begin,
+                                 const char*      end,
+                                 std::string_view needle )
+{
+    const size_t size = needle.size();
+    if( size == 0 )
+    {
+        return begin;
+    }
+    if( static_cast<size_t>( end - begin ) < size )
+    {
+        return end;
+    }
+    if( size == 1 )
+    {
+        const void* found = std::memchr( begin, needle.front(), static_cast<size_t>( end - begin ) );
+        return found == nullptr ? end : static_cast<const char*>( found );
+    }
+
+    const char* pos = begin;
+#if defined(__AVX2__)
+    const __m256i first = _mm256_set1_epi8( needle.front() );
+    const __m256i last  = _mm256_set1_epi8( needle.back() );
+    for( ; static_cast<size_t>( end - pos ) >= size + 31; pos += 32 )
+    {
+        const __m256i block_first = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( pos ) );
+        const __m256i block_last  = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( pos + size - 1 ) );
+        auto mask = static_cast<uint32_t>( _mm256_movemask_epi8(
+            _mm256_and_si256( _mm256_cmpeq_epi8( first, block_first ), _mm256_cmpeq_epi8( last, block_last ) ) ) );
+        while( mask != 0 )
+        {
+            const int bit = __builtin_ctz( mask );
+            if( std::memcmp( pos + bit + 1, needle.data() + 1, size - 2 ) == 0 )
+            {
+                return pos + bit;
+            }
+            mask &= mask - 1;
+        }
+    }
+#elif defined(__SSE2__)
+    const __m128i first = _mm_set1_epi8( needle.front() );
+    const __m128i last  = _mm_set1_epi8( needle.back() );
+    for( ; static_cast<size_t>( end - pos ) >= size + 15; pos += 16 )
+    {
+        const __m128i block_first = _mm_loadu_si128( reinterpret_cast<const __m128i*>( pos ) );
+        const __m128i block_last  = _mm_loadu_si128( reinterpret_cast<const __m128i*>( pos + size - 1 ) );
+        auto mask = static_cast<uint32_t>( _mm_movemask_epi8(
+            _mm_and_si128( _mm_cmpeq_epi8( first, block_first ), _mm_cmpeq_epi8( last, block_last ) ) ) );
+        while( mask != 0 )
+        {
+            const int bit = __builtin_ctz( mask );
+            if( std::memcmp( pos + bit + 1, needle.data() + 1, size - 2 ) == 0 )
+            {
+                return pos + bit;
+            }
+            mask &= mask - 1;
+        }
+    }
+#endif
+    std::string_view rest{ pos, static_cast<size_t>( end - pos ) };
+    auto found = rest.find( needle );
+    return found == std::string_view::npos ? end : pos + found;
+}
+
+/**
+ * Returns the longest run of characters every match of an ECMAScript regular expression
+ * must contain, or an empty string if none can be found.  Expressions with top-level
+ * alternation have none; groups, classes, and characters made optional by a quantifier
+ * end a run.
+*/
+inline std::string required_literal( std::string_view regex )
+{
+    std::string best;
+    std::string run;
+    auto end_run = [&best, &run]()
+    {
+        if( run.size() > best.size() )
+        {
+            best = run;
+        }
+        run.clear();
+    };
+
+    int depth = 0;
+    for( size_t i = 0; i < regex.size(); ++i )
+    {
+        const char c = regex[i];
+        if( c == '(' )
+        {
+            ++depth;
+            end_run();
+            continue;
+        }
+        if( c == ')' )
+        {
+            --depth;
+            continue;
+        }
+        if( depth > 0 )
+        {
+            if( c == '\\' )
+            {
+                ++i;
+            }
+            continue;
+        }
+        if( c == '|' )
+        {
+            return {};
+        }
+        if( c == '[' )
+        {
+            end_run();
+            for( ++i; i < regex.size() && regex[i] != ']'; ++i )
+            {
+                i += regex[i] == '\\' ? 1 : 0;
+            }
+            continue;
+        }
+
+        std::optional<char> literal;
+        if( c == '\\' && i + 1 < regex.size() )
+        {
+            const char escaped = regex[++i];
+            if( std::strchr( ".^$*+?()[]{}|\\/-", escaped ) != nullptr )
+            {
+                literal = escaped;
+            }
+        }
+        else if( std::strchr( ".^$*+?{}", c ) == nullptr )
+        {
+            literal = c;
+        }
+
+        if( !literal )
+        {
+            // A quantifier makes the character before it optional or repeated
+            if( ( c == '*' || c == '?' || c == '{' ) && !run.empty() )
+            {
+                run.pop_back();
+            }
+            end_run();
+            if( c == '{' )
+            {
+                while( i < regex.size() && regex[i] != '}' )
+                {
+                    ++i;
+                }
+            }
+            continue;
+        }
+        const char next = i + 1 < regex.size() ? regex[i + 1] : '\0';
+        if( next == '*' || next == '?' || next == '{' )
+        {
+            end_run();
+            continue;
+        }
+        run.push_back( *literal );
+    }
+    end_run();
+    return best;
+}
+
+/**
+ * Returns the rank of a severity name as written by `format::json`, from 0 for "trace"
+ * to 5 for "fatal".  "warn" is accepted for "warning".
+*/
+inline std::optional<int> severity_rank( std::string_view name )
+{
+    static constexpr std::array<std::string_view,6> NAMES{ "trace", "debug", "info", "warning", "error", "fatal" };
+    if( name == "warn" )
+    {
+        return 3;
+    }
+    for( size_t i = 0; i < NAMES.size(); ++i )
+    {
+        if( NAMES[i] == name )
+        {
+            return static_cast<int>( i );
+        }
+    }
+    return std::nullopt;
+}
+
+/**
+ * What a search matches.  Every condition that is set must hold.
+ *
+ * The literals, and the "Scope" member a scope condition implies, are searched for in
+ * the raw text before any line is looked at, so lines that cannot match are skipped
+ * without being split or parsed.  The JSON conditions ("Scope", "Severity", and the time
+ * range) only match `format::json` records; the regular expression is checked last.
+*/
+struct Query
+{
+    /// Text every matching line contains
+    std::vector<std::string> literals;
+
+    /// ECMAScript regular expression a matching line contains a match of
+    std::optional<std::string> regex;
+
+    /// "Scope" equal to this or below it, such as "app.db" for "app"
+    std::optional<std::string> scope;
+
+    /// Lowest "Severity" rank; see `severity_rank()`
+    std::optional<int> min_severity;
+
+    std::optional<int64_t> from_time;
+
+    std::optional<int64_t> to_time;
+
+}; // End of Query struct
+
+/**
+ * A `Query` prepared for searching: its regular expression compiled and the literal to
+ * scan for chosen.
+*/
+class Matcher
+{
+    public:
+
+        /**
+         * @throws std::regex_error if the regular expression is invalid.
+        */
+        explicit Matcher( Query query )
+          : m_query{ std::move( query ) }
+        {
+            m_required = m_query.literals;
+            if( m_query.scope && m_query.scope->find_first_of( "\"\\" ) == std::string::npos )
+            {
+                m_required.push_back( "\"Scope\":\"" + *m_query.scope );
+            }
+            if( m_query.regex )
+            {
+                m_regex = std::regex{ *m_query.regex, std::regex::ECMAScript | std::regex::optimize };
+                if( auto literal = required_literal( *m_query.regex ); !literal.empty() )
+                {
+                    m_required.push_back( std::move( literal ) );
+                }
+            }
+
+            // Scan for the longest literal, which is usually the rarest
+            auto longest = std::max_element( m_required.begin(), m_required.end(),
+                                             []( const auto& a, const auto& b ){ return a.size() < b.size(); } );
+            if( longest != m_required.end() && !longest->empty() )
+            {
+                m_scan = *longest;
+            }
+        }
+
+        [[nodiscard]] const Query& query() const
+        {
+            return m_query;
+        }
+
+        /// Literal searched for in the raw text, empty if every line is checked
+        [[nodiscard]] const std::string& scan_literal() const
+        {
+            return m_scan;
+        }
+
+        /**
+         * Returns true if the record matches every condition.
+        */
+        [[nodiscard]] bool matches( const reader::Record_View& record ) const
+        {
+            const auto line = record.line();
+            for( const auto& literal : m_required )
+            {
+                if( find_literal( line.data(), line.data() + line.size(), literal ) == line.data() + line.size() )
+                {
+                    return false;
+                }
+            }
+            if( m_query.scope )
+            {
+                auto scope = record.scope();
+                if( !scope || !( *scope == *m_query.scope ||
+                                 ( scope->starts_with( *m_query.scope ) && ( *scope )[m_query.scope->size()] == '.' ) ) )
+                {
+                    return false;
+                }
+            }
+            if( m_query.min_severity )
+            {
+                auto severity = record.severity();
+                auto rank = severity ? severity_rank( *severity ) : std::nullopt;
+                if( !rank || *rank < *m_query.min_severity )
+                {
+                    return false;
+                }
+            }
+            if( m_query.from_time || m_query.to_time )
+            {
+                auto time = record.time_stamp();
+                if( !time || ( m_query.from_time && *time < *m_query.from_time ) ||
+                    ( m_query.to_time && *time > *m_query.to_time ) )
+                {
+                    return false;
+                }
+            }
+            if( m_regex && !std::regex_search( line.begin(), line.end(), *m_regex ) )
+            {
+                return false;
+            }
+            return true;
+        }
+
+        /**
+         * Calls `fn( const reader::Record_View& )` for every matching record whose line
+         * starts in `text`, which must start at a line.  `base` is the start of the file,
+         * for record offsets.
+        */
+        template <typename FnT>
+        void search( std::string_view text,
+                     const char*      base,
+                     FnT&&            fn ) const
+        {
+            const char* pos = text.data();
+            const char* end = text.data() + text.size();
+            while( pos < end )
+            {
+                const char* start = pos;
+                if( !m_scan.empty() )
+                {
+                    const char* hit = find_literal( pos, end, m_scan );
+                    if( hit == end )
+                    {
+                        return;
+                    }
+                    start = hit;
+                    while( start > pos && start[-1] != '\n' )
+                    {
+                        --start;
+                    }
+                }
+                const char* newline = reader::find_newline( start, end );
+                reader::Record_View record{ { start, static_cast<size_t>( newline - start ) },
+                                            static_cast<uint64_t>( start - base ) };
+                if( matches( record ) )
+                {
+                    fn( record );
+                }
+                pos = newline == end ? end : newline + 1;
+            }
+        }
+
+    private:
+
+        Query m_query;
+
+        std::optional<std::regex> m_regex;
+
+        /// Literals every match contains
+        std::vector<std::string> m_required;
+
+        std::string m_scan;
+
+}; // End of Matcher class
+
+/**
+ * Settings of `search_files()`.
+*/
+struct Search_Options
+{
+    reader::Scan_Options scan;
+
+    /// Print the number of matching records instead of the records
+    bool count_only{ false };
+
+    /// Prefix each record, or each count, with its file name
+    bool with_file_name{ false };
+
+}; // End of Search_Options struct
+
+/**
+ * Searches the files in parallel and writes the matching records, in file order, to
+ * `output`.  Returns the number of matching records.
+ *
+ * Files are split into chunks searched by a thread pool (see `reader::for_each_chunk()`),
+ * and each chunk's output is written once the chunks before it are done.  When the query
+ * has a time range and a file has a sidecar index, only the part of the file the index
+ * allows is searched.
+*/
+inline uint64_t search_files( const std::vector<std::string>& paths,
+                              const Matcher&                  matcher,
+                              std::ostream&                   output,
+                              const Search_Options&           options = {} )
+{
+    const auto& query = matcher.query();
+    std::vector<std::pair<uint64_t,uint64_t>> ranges( paths.size(), { 0, std::numeric_limits<uint64_t>::max() } );
+    if( query.from_time || query.to_time )
+    {
+        for( size_t i = 0; i < paths.size(); ++i )
+        {
+            if( auto index = index::File_Index::load( index::index_file_name( paths[i] ) ) )
+            {
+                if( query.from_time )
+                {
+                    ranges[i].first = index->time_begin( *query.from_time );
+                }
+                if( query.to_time )
+                {
+                    ranges[i].second = index->time_end( *query.to_time ).value_or( ranges[i].second );
+                }
+            }
+        }
+    }
+
+    std::vector<std::atomic<uint64_t>> counts( paths.size() );
+    std::mutex output_mutex;
+    std::map<size_t,std::string> pending;
+    size_t next_sequence = 0;
+
+    reader::for_each_chunk( paths, [&]( const reader::Chunk& chunk )
+    {
+        const auto [first, last] = ranges[chunk.file_index];
+        const uint64_t begin = std::max( first, chunk.begin );
+        const uint64_t end   = std::min( last, chunk.end );
+
+        std::string text;
+        uint64_t count = 0;
+        if( begin < end )
+        {
+            const auto data = chunk.file->data();
+            matcher.search( data.substr( begin, end - begin ), data.data(), [&]( const reader::Record_View& record )
+            {
+                ++count;
+                if( !options.count_only )
+                {
+                    if( options.with_file_name )
+                    {
+                        text.append( chunk.file->path() ).push_back( ':' );
+                    }
+                    text.append( record.line() ).push_back( '\n' );
+                }
+            });
+        }
+        counts[chunk.file_index].fetch_add( count, std::memory_order_relaxed );
+
+        std::lock_guard<std::mutex> lock{ output_mutex };
+        pending.emplace( chunk.sequence, std::move( text ) );
+        for( auto it = pending.begin(); it != pending.end() && it->first == next_sequence; it = pending.erase( it ) )
+        {
+            output << it->second;
+            ++next_sequence;
+        }
+    }, options.scan );
+
+    uint64_t total = 0;
+    for( size_t i = 0; i < paths.size(); ++i )
+    {
+        total += counts[i].load();
+        if( options.count_only && options.with_file_name )
+        {
+            output << paths[i] << ':' << counts[i].load() << '\n';
+        }
+    }
+    if( options.count_only && !options.with_file_name )
+    {
+        output << total << '\n';
+    }
+    return total;
+}
+
+} // End of tmns::log::impl::search namespace
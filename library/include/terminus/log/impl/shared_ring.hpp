@@ -0,0 +1,371 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    shared_ring.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+#if defined(__unix__) || defined(__APPLE__)
+
+// C++ Libraries
+#include <atomic>
+#include <bit>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+
+// POSIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace tmns::log::impl::ipc {
+
+static_assert( std::atomic<uint64_t>::is_always_lock_free,
+               "The shared ring requires lock-free 64-bit atomics" );
+
+/**
+ * Bounded, lock-free ring of fixed-size slots in a named POSIX shared-memory segment,
+ * written by any number of processes and read by the log writer.
+ *
+ * The ring is the bounded multi-producer queue of Dmitry Vyukov: each slot carries a
+ * sequence number telling producers and the reader whether it is free or filled, so
+ * neither side ever takes a lock.  A producer finding the ring full drops its record and
+ * counts it in `dropped()` instead of waiting for the reader.
+ *
+ * The first process to open a segment creates and initializes it, and later processes
+ * use the slot count and size stored in the segment.  The segment outlives the processes
+ * until `remove()` is called.  A producer that dies while filling a slot leaves the slot
+ * unpublished, which stops the reader at that slot.
+*/
+class Shared_Ring
+{
+    public:
+
+        /// Default number of slots
+        static constexpr uint64_t DEFAULT_SLOT_COUNT = 65536;
+
+        /// Default bytes per slot, including the slot header
+        static constexpr uint32_t DEFAULT_SLOT_SIZE = 1024;
+
+        /**
+         * Opens the segment with the provided name, creating it if it does not exist.  The
+         * slot count is rounded up to a power of two and the slot size to a cache line.
+         *
+         * @throws std::runtime_error if the segment cannot be created or mapped, or if an
+         *         existing segment is not a ring.
+        */
+        static std::shared_ptr<Shared_Ring> open( const std::string& name,
+                                                  uint64_t           slot_count = DEFAULT_SLOT_COUNT,
+                                                  uint32_t           slot_size  = DEFAULT_SLOT_SIZE )
+        {
+            slot_count = std::bit_ceil( std::max<uint64_t>( slot_count, 2 ) );
+            slot_size  = ( std::max<uint32_t>( slot_size, 2 * CACHE_LINE ) + CACHE_LINE - 1 ) / CACHE_LINE * CACHE_LINE;
+
+            int fd = ::shm_open( name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600 );
+            if( fd >= 0 )
+            {
+                return create( name, fd, slot_count, slot_size );
+            }
+            if( errno != EEXIST )
+            {
+                throw std::runtime_error( "Failed to create shared memory segment \"" + name + "\": " + std::strerror( errno ) );
+            }
+            fd = ::shm_open( name.c_str(), O_RDWR, 0600 );
+            if( fd < 0 )
+            {
+                throw std::runtime_error( "Failed to open shared memory segment \"" + name + "\": " + std::strerror( errno ) );
+            }
+            return attach( name, fd );
+        }
+
+        /**
+         * Removes the segment's name.  Processes that opened the segment keep using it.
+        */
+        static void remove( const std::string& name )
+        {
+            ::shm_unlink( name.c_str() );
+        }
+
+        Shared_Ring( const Shared_Ring& ) = delete;
+        Shared_Ring& operator=( const Shared_Ring& ) = delete;
+
+        ~Shared_Ring()
+        {
+            ::munmap( m_memory, m_size );
+        }
+
+        /**
+         * Copies the record into a free slot.  Returns false, counting the record as
+         * dropped, if the ring is full or the record does not fit in a slot.
+        */
+        bool try_push( std::string_view record )
+        {
+            if( record.size() > max_record_size() )
+            {
+                m_header->dropped.fetch_add( 1, std::memory_order_relaxed );
+                return false;
+            }
+
+            uint64_t position = m_header->enqueue_position.load( std::memory_order_relaxed );
+            Slot* current;
+            while( true )
+            {
+                current = slot( position );
+                uint64_t sequence = current->sequence.load( std::memory_order_acquire );
+                auto difference = static_cast<int64_t>( sequence - position );
+                if( difference == 0 )
+                {
+                    if( m_header->enqueue_position.compare_exchange_weak( position, position + 1,
+                                                                          std::memory_order_relaxed ) )
+                    {
+                        break;
+                    }
+                }
+                else if( difference < 0 )
+                {
+                    m_header->dropped.fetch_add( 1, std::memory_order_relaxed );
+                    return false;
+                }
+                else
+                {
+                    position = m_header->enqueue_position.load( std::memory_order_relaxed );
+                }
+            }
+
+            current->size = static_cast<uint32_t>( record.size() );
+            std::memcpy( current->data(), record.data(), record.size() );
+            current->sequence.store( position + 1, std::memory_order_release );
+            return true;
+        }
+
+        /**
+         * Passes the oldest record to the provided function and frees its slot.  The view
+         * is only valid during the call.  Returns false if the ring is empty.
+        */
+        template <typename ConsumerT>
+        bool try_pop( ConsumerT&& consumer )
+        {
+            uint64_t position = m_header->dequeue_position.load( std::memory_order_relaxed );
+            Slot* current;
+            while( true )
+            {
+                current = slot( position );
+                uint64_t sequence = current->sequence.load( std::memory_order_acquire );
+                auto difference = static_cast<int64_t>( sequence - ( position + 1 ) );
+                if( difference == 0 )
+                {
+                    if( m_header->dequeue_position.compare_exchange_weak( position, position + 1,
+                                                                          std::memory_order_relaxed ) )
+                    {
+                        break;
+                    }
+                }
+                else if( difference < 0 )
+                {
+                    return false;
+                }
+                else
+                {
+                    position = m_header->dequeue_position.load( std::memory_order_relaxed );
+                }
+            }
+
+            consumer( std::string_view{ current->data(), current->size } );
+            current->sequence.store( position + m_header->slot_count, std::memory_order_release );
+            return true;
+        }
+
+        /**
+         * Number of records dropped by every producer since the segment was created.
+        */
+        [[nodiscard]] uint64_t dropped() const
+        {
+            return m_header->dropped.load( std::memory_order_relaxed );
+        }
+
+        [[nodiscard]] uint64_t slot_count() const
+        {
+            return m_header->slot_count;
+        }
+
+        /**
+         * Largest record that fits in a slot.
+        */
+        [[nodiscard]] size_t max_record_size() const
+        {
+            return m_header->slot_size - sizeof( Slot );
+        }
+
+        [[nodiscard]] const std::string& name() const
+        {
+            return m_name;
+        }
+
+    private:
+
+        static constexpr uint32_t CACHE_LINE = 64;
+
+        /// Marks an initialized segment ("tmnslog1")
+        static constexpr uint64_t MAGIC = 0x746D6E736C6F6731;
+
+        /// Longest time `attach()` waits for the creating process to initialize the segment
+        static constexpr std::chrono::milliseconds INIT_TIMEOUT{ 1000 };
+
+        struct Header
+        {
+            std::atomic<uint64_t> magic;
+
+            uint64_t slot_count;
+
+            uint32_t slot_size;
+
+            alignas(CACHE_LINE) std::atomic<uint64_t> enqueue_position;
+
+            alignas(CACHE_LINE) std::atomic<uint64_t> dequeue_position;
+
+            alignas(CACHE_LINE) std::atomic<uint64_t> dropped;
+
+        }; // End of Header struct
+
+        struct Slot
+        {
+            std::atomic<uint64_t> sequence;
+
+            uint32_t size;
+
+            char* data()
+            {
+                return reinterpret_cast<char*>( this + 1 );
+            }
+
+        }; // End of Slot struct
+
+        static constexpr size_t HEADER_SIZE = ( sizeof( Header ) + CACHE_LINE - 1 ) / CACHE_LINE * CACHE_LINE;
+
+        Shared_Ring( std::string name,
+                     void*       memory,
+                     size_t      size )
+          : m_name{ std::move( name ) },
+            m_memory{ memory },
+            m_size{ size },
+            m_header{ static_cast<Header*>( memory ) },
+            m_slots{ static_cast<char*>( memory ) + HEADER_SIZE }
+        {
+        }
+
+        static std::shared_ptr<Shared_Ring> create( const std::string& name,
+                                                    int                fd,
+                                                    uint64_t           slot_count,
+                                                    uint32_t           slot_size )
+        {
+            const size_t size = HEADER_SIZE + slot_count * slot_size;
+            void* memory = MAP_FAILED;
+            if( ::ftruncate( fd, static_cast<off_t>( size ) ) == 0 )
+            {
+                memory = ::mmap( nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+            }
+            int error = errno;
+            ::close( fd );
+            if( memory == MAP_FAILED )
+            {
+                ::shm_unlink( name.c_str() );
+                throw std::runtime_error( "Failed to map shared memory segment \"" + name + "\": " + std::strerror( error ) );
+            }
+
+            auto ring = std::shared_ptr<Shared_Ring>( new Shared_Ring( name, memory, size ) );
+            auto header = new( memory ) Header{};
+            header->slot_count = slot_count;
+            header->slot_size  = slot_size;
+            for( uint64_t i = 0; i < slot_count; ++i )
+            {
+                new( ring->slot( i ) ) Slot{ i, 0 };
+            }
+            header->magic.store( MAGIC, std::memory_order_release );
+            return ring;
+        }
+
+        static std::shared_ptr<Shared_Ring> attach( const std::string& name,
+                                                    int                fd )
+        {
+            // The creating process may still be sizing and initializing the segment
+            const auto deadline = std::chrono::steady_clock::now() + INIT_TIMEOUT;
+            void* memory = MAP_FAILED;
+            size_t size = 0;
+            while( true )
+            {
+                struct stat status{};
+                if( ::fstat( fd, &status ) == 0 && static_cast<size_t>( status.st_size ) >= HEADER_SIZE )
+                {
+                    if( memory == MAP_FAILED )
+                    {
+                        size = static_cast<size_t>( status.st_size );
+                        memory = ::mmap( nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+                    }
+                    if( memory != MAP_FAILED &&
+                        static_cast<Header*>( memory )->magic.load( std::memory_order_acquire ) == MAGIC )
+                    {
+                        break;
+                    }
+                }
+                if( std::chrono::steady_clock::now() > deadline )
+                {
+                    if( memory != MAP_FAILED )
+                    {
+                        ::munmap( memory, size );
+                    }
+                    ::close( fd );
+                    throw std::runtime_error( "Shared memory segment \"" + name + "\" is not a log ring" );
+                }
+                std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+            }
+            ::close( fd );
+
+            auto header = static_cast<Header*>( memory );
+            if( size < HEADER_SIZE + header->slot_count * header->slot_size )
+            {
+                ::munmap( memory, size );
+                throw std::runtime_error( "Shared memory segment \"" + name + "\" is truncated" );
+            }
+            return std::shared_ptr<Shared_Ring>( new Shared_Ring( name, memory, size ) );
+        }
+
+        Slot* slot( uint64_t position ) const
+        {
+            auto index = position & ( m_header->slot_count - 1 );
+            return reinterpret_cast<Slot*>( m_slots + index * m_header->slot_size );
+        }
+
+        std::string m_name;
+
+        void* m_memory;
+
+        size_t m_size;
+
+        Header* m_header;
+
+        char* m_slots;
+
+}; // End of Shared_Ring class
+
+} // End of tmns::log::impl::ipc namespace
+
+#endif // defined(__unix__) || defined(__APPLE__)
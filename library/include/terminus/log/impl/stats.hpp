@@ -0,0 +1,278 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    stats.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace tmns::log::impl::stats {
+
+/**
+ * Counter that is cheap to increment from many threads at once.  Each thread increments
+ * one of several cache-line sized slots, so producers on different cores rarely touch the
+ * same line.  Reading the value sums every slot, which is only done when taking a snapshot.
+*/
+class Sharded_Counter
+{
+    public:
+
+        /**
+         * Adds to the slot owned by the calling thread.
+        */
+        void add( uint64_t value = 1 )
+        {
+            m_slots[thread_slot()].value.fetch_add( value, std::memory_order_relaxed );
+        }
+
+        /**
+         * Sum of all slots.  Concurrent increments may or may not be included.
+        */
+        [[nodiscard]] uint64_t load() const
+        {
+            uint64_t total = 0;
+            for( const auto& slot : m_slots )
+            {
+                total += slot.value.load( std::memory_order_relaxed );
+            }
+            return total;
+        }
+
+    private:
+
+        static constexpr size_t SLOT_COUNT = 64;
+
+        struct alignas(64) Slot
+        {
+            std::atomic<uint64_t> value{ 0 };
+        }; // End of Slot struct
+
+        static size_t thread_slot()
+        {
+            static std::atomic<size_t> s_next_slot{ 0 };
+            thread_local size_t slot = s_next_slot.fetch_add( 1, std::memory_order_relaxed ) % SLOT_COUNT;
+            return slot;
+        }
+
+        std::array<Slot,SLOT_COUNT> m_slots;
+
+}; // End of Sharded_Counter class
+
+/**
+ * Counters kept by a single sink.  Every field is a relaxed atomic updated by the sink's
+ * frontend, queue, backend, or formatter.
+*/
+struct Sink_Counters
+{
+    explicit Sink_Counters( std::string sink_name )
+      : name{ std::move( sink_name ) }
+    {
+    }
+
+    /**
+     * Records that an entry was added to the sink's asynchronous queue.
+    */
+    void enqueued()
+    {
+        auto depth = queue_depth.fetch_add( 1, std::memory_order_relaxed ) + 1;
+        auto high  = queue_high_water.load( std::memory_order_relaxed );
+        while( depth > high &&
+               !queue_high_water.compare_exchange_weak( high, depth, std::memory_order_relaxed ) )
+        {
+        }
+    }
+
+    /**
+     * Records that an entry was removed from the sink's asynchronous queue.
+    */
+    void dequeued()
+    {
+        queue_depth.fetch_sub( 1, std::memory_order_relaxed );
+    }
+
+    /// Name of the sink, usually the INI section name
+    const std::string name;
+
+    std::atomic<uint64_t> records_emitted{ 0 };
+    std::atomic<uint64_t> bytes_written{ 0 };
+    std::atomic<uint64_t> queue_depth{ 0 };
+    std::atomic<uint64_t> queue_high_water{ 0 };
+    std::atomic<uint64_t> records_dropped{ 0 };
+    std::atomic<uint64_t> rotations{ 0 };
+    std::atomic<uint64_t> format_calls{ 0 };
+    std::atomic<uint64_t> format_nanoseconds{ 0 };
+    std::atomic<uint64_t> filter_calls{ 0 };
+    std::atomic<uint64_t> filter_nanoseconds{ 0 };
+    std::atomic<uint64_t> backend_nanoseconds{ 0 };
+
+}; // End of Sink_Counters struct
+
+/**
+ * Snapshot of a single sink's counters.
+*/
+struct Sink_Stats
+{
+    /// Name of the sink, usually the INI section name
+    std::string name;
+
+    /// Records written to the sink's destination
+    uint64_t records_emitted{ 0 };
+
+    /// Bytes of formatted output handed to the destination
+    uint64_t bytes_written{ 0 };
+
+    /// Records waiting in the asynchronous queue (zero for synchronous sinks)
+    uint64_t queue_depth{ 0 };
+
+    /// Largest queue depth observed
+    uint64_t queue_high_water{ 0 };
+
+    /// Records accepted by the sink but never written
+    uint64_t records_dropped{ 0 };
+
+    /// Number of file rotations
+    uint64_t rotations{ 0 };
+
+    /// Number of records formatted
+    uint64_t format_calls{ 0 };
+
+    /// Total time spent in the sink's formatter
+    std::chrono::nanoseconds format_time{ 0 };
+
+    /// Number of records the sink's filter was applied to (zero unless the sink is timed)
+    uint64_t filter_calls{ 0 };
+
+    /// Total time spent in the sink's filter (zero unless the sink is timed)
+    std::chrono::nanoseconds filter_time{ 0 };
+
+    /// Total time spent in the sink's backend writing formatted records (zero unless the sink is timed)
+    std::chrono::nanoseconds backend_time{ 0 };
+
+}; // End of Sink_Stats struct
+
+/**
+ * Snapshot of the logging pipeline's counters.
+*/
+struct Stats
+{
+    /// Records that passed filtering and were opened
+    uint64_t records_opened{ 0 };
+
+    /// Log calls rejected by filtering before a record was opened
+    uint64_t records_filtered{ 0 };
+
+    /// Sum of `records_dropped` across all sinks
+    uint64_t records_dropped{ 0 };
+
+    /// Per-sink counters, in the order the sinks were created
+    std::vector<Sink_Stats> sinks;
+
+}; // End of Stats struct
+
+/**
+ * Process-wide registry of pipeline counters.  Sinks register their counters when they are
+ * created and the registry only keeps weak references, so sinks removed from the core drop
+ * out of later snapshots.
+*/
+class Registry
+{
+    public:
+
+        static Registry& instance()
+        {
+            static Registry s_instance;
+            return s_instance;
+        }
+
+        /**
+         * Creates and registers the counters for a new sink.
+        */
+        std::shared_ptr<Sink_Counters> register_sink( std::string name )
+        {
+            auto counters = std::make_shared<Sink_Counters>( std::move( name ) );
+            std::lock_guard<std::mutex> lock{ m_mutex };
+            std::erase_if( m_sinks, []( const auto& sink ){ return sink.expired(); } );
+            m_sinks.push_back( counters );
+            return counters;
+        }
+
+        Sharded_Counter& records_opened()
+        {
+            return m_records_opened;
+        }
+
+        Sharded_Counter& records_filtered()
+        {
+            return m_records_filtered;
+        }
+
+        /**
+         * Takes a snapshot of every counter.
+        */
+        Stats snapshot()
+        {
+            Stats result;
+            result.records_opened   = m_records_opened.load();
+            result.records_filtered = m_records_filtered.load();
+
+            std::lock_guard<std::mutex> lock{ m_mutex };
+            for( const auto& weak_sink : m_sinks )
+            {
+                auto sink = weak_sink.lock();
+                if( !sink )
+                {
+                    continue;
+                }
+                Sink_Stats entry;
+                entry.name             = sink->name;
+                entry.records_emitted  = sink->records_emitted.load( std::memory_order_relaxed );
+                entry.bytes_written    = sink->bytes_written.load( std::memory_order_relaxed );
+                entry.queue_depth      = sink->queue_depth.load( std::memory_order_relaxed );
+                entry.queue_high_water = sink->queue_high_water.load( std::memory_order_relaxed );
+                entry.records_dropped  = sink->records_dropped.load( std::memory_order_relaxed );
+                entry.rotations        = sink->rotations.load( std::memory_order_relaxed );
+                entry.format_calls     = sink->format_calls.load( std::memory_order_relaxed );
+                entry.format_time      = std::chrono::nanoseconds( sink->format_nanoseconds.load( std::memory_order_relaxed ) );
+                entry.filter_calls     = sink->filter_calls.load( std::memory_order_relaxed );
+                entry.filter_time      = std::chrono::nanoseconds( sink->filter_nanoseconds.load( std::memory_order_relaxed ) );
+                entry.backend_time     = std::chrono::nanoseconds( sink->backend_nanoseconds.load( std::memory_order_relaxed ) );
+                result.records_dropped += entry.records_dropped;
+                result.sinks.push_back( std::move( entry ) );
+            }
+            return result;
+        }
+
+    private:
+
+        Registry() = default;
+
+        std::mutex m_mutex;
+
+        std::vector<std::weak_ptr<Sink_Counters>> m_sinks;
+
+        Sharded_Counter m_records_opened;
+
+        Sharded_Counter m_records_filtered;
+
+}; // End of Registry class
+
+} // End of tmns::log::impl::stats namespace
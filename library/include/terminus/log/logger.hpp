@@ -15,12 +15,15 @@
 #pragma once
 
 // Terminus Libraries
+#include <terminus/log/field.hpp>
 #include <terminus/log/impl/boost/logger.hpp>
 #include <terminus/log/impl/location.hpp>
 
 // C++ Libraries
 #include <memory>
 #include <string>
+#include <string_view>
+#include <utility>
 
 namespace tmns::log {
 
@@ -30,27 +33,49 @@ namespace tmns::log {
  * can also be used to determine which component produced the log record when looking at log
  * records from multiple components in a single file.
  *
- * There is no guarantee that the backend implementation of this scoped logger is thread safe.
- * A single logger instance should not be used from multiple threads.  Logger instances are cheap,
- * so if you need to log at the same scope in multiple threads, create a different logger for each
- * thread.
+ * Whether one instance can be used from multiple threads depends on the backend implementation.
+ * Use `Logger` or `Static_Logger` rather than this template directly.
+ *
+ * Any argument created with `kv()` is attached to the record as a typed attribute instead
+ * of being written to the message, e.g. `logger.info( "order filled", kv( "qty", 5 ) )`.
+ * Fields shared by many records, such as a request id, can be bound once with `with()`.
 */
-class Logger
+template <class ImplT>
+class Basic_Logger
 {
     public:
 
+        /**
+         * Constructs a new instance at the default scope of the implementation, which is
+         * "global" for `Logger` and the template argument for `Static_Logger`.
+         */
+        Basic_Logger() = default;
+
         /**
          * Constructs a new instances and assigns it to the provided scope.
          */
-        Logger() : Logger( "global" )
+        Basic_Logger( std::string_view scope ) : m_logger { scope }
         {
         }
 
         /**
-         * Constructs a new instances and assigns it to the provided scope.
-         */
-        Logger( std::string scope ) : m_logger { std::move( scope ) }
+         * Creates a child logger at the same scope that attaches the provided fields to every
+         * record it produces, in addition to the fields passed to each call.  The fields are
+         * captured once, so string values are copied and may go out of scope afterwards.
+         * This logger is not modified.
+         *
+         * @code
+         * auto request_logger = logger.with( kv( "request_id", id ), kv( "tenant", tenant ) );
+         * request_logger.info( "request accepted" );
+         * @endcode
+         *
+         * @param fields The fields created with `kv()`.  A field naming an attribute the logger
+         *               already has, such as "Scope", is ignored.
+        */
+        template <class... ValuesT>
+        [[nodiscard]] Basic_Logger with( const Field<ValuesT>&... fields ) const
         {
+            return Basic_Logger{ m_logger.with( fields... ) };
         }
 
         /**
@@ -229,9 +254,79 @@ class Logger
 
     private:
 
+        /**
+         * Wraps a backend logger created by `with()`.
+        */
+        explicit Basic_Logger( ImplT logger ) : m_logger { std::move( logger ) }
+        {
+        }
+
         /// Backend logging implementation
-        impl::Logger m_logger;
+        [[no_unique_address]] ImplT m_logger;
+
+}; // End of Basic_Logger class
+
+/**
+ * Scoped logger.  A logger is a pointer-sized handle to state shared by every logger of the
+ * same scope, which is created the first time the scope is used.  Constructing a logger for
+ * a known scope and copying a logger do not allocate.
+ *
+ * One instance can serve many threads at once without a mutex, for example when it is handed
+ * to tasks whose running thread changes.
+ *
+ * The state of each distinct scope name is kept for the life of the process.  Scope names
+ * built at runtime, such as one per request or per tenant, therefore grow memory without
+ * bound.  Use a fixed scope and attach the varying value as a field with `with()` or `kv()`
+ * instead.
+*/
+class Logger : public Basic_Logger<impl::Logger>
+{
+    public:
+
+        using Basic_Logger::Basic_Logger;
+
+        /**
+         * Wraps a logger created by `Basic_Logger::with()`.
+        */
+        Logger( Basic_Logger logger ) : Basic_Logger{ std::move( logger ) }
+        {
+        }
+
+        /**
+         * Creates a child logger at the same scope that attaches the provided fields to every
+         * record it produces.  See `Basic_Logger::with()`.
+        */
+        template <class... ValuesT>
+        [[nodiscard]] Logger with( const Field<ValuesT>&... fields ) const
+        {
+            return Basic_Logger::with( fields... );
+        }
 
 }; // End of Logger class
 
+/**
+ * Kept for code written when `Logger` could not be shared between threads.  It behaves
+ * exactly like `Logger`.
+*/
+class Shared_Logger : public Logger
+{
+    public:
+
+        using Logger::Logger;
+
+        Shared_Logger( Logger logger ) : Logger{ std::move( logger ) }
+        {
+        }
+
+}; // End of Shared_Logger class
+
+/**
+ * Scoped logger whose scope is known at compile time, e.g. `Static_Logger<"net.http">`.  It
+ * has the same logging functions as `Logger` but is an empty object: the scope's state is
+ * reached through static data, so constructing one does no work and no string handling.
+ * `with()` is not available, use a `Logger` for child loggers.
+*/
+template <impl::Fixed_String ScopeT>
+using Static_Logger = Basic_Logger<impl::Static_Logger<ScopeT>>;
+
 } // End of tmns::log namespace
\ No newline at end of file
@@ -0,0 +1,64 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    reader.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Terminus Libraries
+#include <terminus/log/impl/reader.hpp>
+
+/**
+ * Zero-copy reading of the files written by the file sinks.
+ *
+ * A `Log_File` memory-maps a file, and its records are `Record_View`s pointing into the
+ * mapping, so iterating a file copies nothing and allocates nothing:
+ *
+ *     tmns::log::reader::Log_File file{ "Json-000.log" };
+ *     for( const auto& record : file.records() )
+ *     {
+ *         if( record.severity() == "error" )
+ *         {
+ *             std::cout << record.line() << std::endl;
+ *         }
+ *     }
+ *
+ * `scan()` and `for_each_chunk()` read many files, or one large file, from several
+ * threads by splitting them into line-aligned chunks.
+*/
+namespace tmns::log::reader {
+
+/// Memory-mapped file
+using Mapped_File = impl::reader::Mapped_File;
+
+/// Memory-mapped log file and the ranges of its records
+using Log_File = impl::reader::Log_File;
+
+/// One line of a log file, with lazily parsed JSON fields
+using Record_View = impl::reader::Record_View;
+
+/// Range of the records in a block of a log file
+using Record_Range = impl::reader::Record_Range;
+
+/// Line-aligned piece of a file handed to a `for_each_chunk()` callback
+using Chunk = impl::reader::Chunk;
+
+/// Thread count and chunk size of `scan()` and `for_each_chunk()`
+using Scan_Options = impl::reader::Scan_Options;
+
+using impl::reader::find_newline;
+using impl::reader::for_each_chunk;
+using impl::reader::parse_time_stamp;
+using impl::reader::scan;
+using impl::reader::unescape;
+
+} // End of tmns::log::reader namespace
@@ -0,0 +1,44 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    stats.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Terminus Libraries
+#include <terminus/log/impl/stats.hpp>
+
+namespace tmns::log {
+
+/// Snapshot of the logging pipeline's counters
+using Stats = impl::stats::Stats;
+
+/// Snapshot of a single sink's counters
+using Sink_Stats = impl::stats::Sink_Stats;
+
+/**
+ * Returns a snapshot of the logging pipeline's own counters: records opened and filtered
+ * out by the core, and for each live sink the records emitted, bytes written, queue depth
+ * and high-water mark, dropped records, file rotations, and time spent formatting.  Sinks
+ * with `Timing=true`, and "Null" sinks, also report the time spent in their filter and
+ * backend.
+ *
+ * Counters are updated with relaxed atomics, so a snapshot taken while other threads are
+ * logging is approximate.  Sinks are named after their section in the settings file, e.g.
+ * `[Sinks.Json]` reports as "Json".
+*/
+inline Stats stats()
+{
+    return impl::stats::Registry::instance().snapshot();
+}
+
+} // End of tmns::log namespace
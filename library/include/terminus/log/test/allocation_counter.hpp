@@ -0,0 +1,104 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    allocation_counter.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <cstddef>
+#include <cstdint>
+
+namespace tmns::log::test {
+
+/**
+ * Counts heap allocations made by the calling thread while an instance is alive.  Counting
+ * relies on the replacement global `operator new` functions in `allocation_hooks.hpp`, which
+ * must be included in exactly one translation unit of the executable.  Without the hooks the
+ * count stays at zero.
+ *
+ * Only allocations on the constructing thread are counted, which is what matters when pinning
+ * the cost of a log call on the producer.  Work done by asynchronous sink threads is excluded.
+ *
+ * Counters may be nested; each instance reports the allocations made during its own lifetime.
+*/
+class Allocation_Counter
+{
+    public:
+
+        /**
+         * Starts counting allocations on the calling thread.
+        */
+        Allocation_Counter()
+          : m_start{ s_allocations }
+        {
+            ++s_active;
+        }
+
+        Allocation_Counter( const Allocation_Counter& )            = delete;
+        Allocation_Counter& operator=( const Allocation_Counter& ) = delete;
+
+        /**
+         * Stops counting allocations for this instance.
+        */
+        ~Allocation_Counter()
+        {
+            --s_active;
+        }
+
+        /**
+         * Number of allocations made on this thread since construction.
+        */
+        [[nodiscard]] uint64_t count() const
+        {
+            return s_allocations - m_start;
+        }
+
+        /**
+         * Invokes the functor and returns how many allocations it made on the calling thread.
+         *
+         * @param func Function to invoke with no arguments.
+        */
+        template <class CallableT>
+        [[nodiscard]] static uint64_t count_allocations( CallableT&& func )
+        {
+            Allocation_Counter counter;
+            func();
+            return counter.count();
+        }
+
+        /**
+         * Records one allocation if counting is active on this thread.  Called by the
+         * replacement allocation functions.
+        */
+        static void record_allocation() noexcept
+        {
+            if( s_active > 0 )
+            {
+                ++s_allocations;
+            }
+        }
+
+    private:
+
+        /// Allocations made on this thread while any counter was active
+        static inline thread_local uint64_t s_allocations{ 0 };
+
+        /// Number of live counters on this thread
+        static inline thread_local uint32_t s_active{ 0 };
+
+        /// Value of the thread's allocation count when this instance was created
+        uint64_t m_start;
+
+}; // End of Allocation_Counter class
+
+} // End of tmns::log::test namespace
@@ -0,0 +1,152 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    allocation_hooks.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * Replacement global allocation functions that report every allocation to
+ * `tmns::log::test::Allocation_Counter`.  Replacing `operator new` in the executable
+ * also replaces it for the shared Boost.Log libraries, so allocations made inside the
+ * logging core are counted too.
+ *
+ * These are real (non-inline) definitions.  Include this header in exactly ONE
+ * translation unit of a test executable.
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <cstdlib>
+#include <new>
+
+// Terminus Libraries
+#include <terminus/log/test/allocation_counter.hpp>
+
+namespace tmns::log::test::impl {
+
+inline void* counted_allocate( std::size_t size )
+{
+    Allocation_Counter::record_allocation();
+    if( void* ptr = std::malloc( size == 0 ? 1 : size ) )
+    {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+inline void* counted_allocate( std::size_t size, std::align_val_t align )
+{
+    Allocation_Counter::record_allocation();
+    auto alignment = static_cast<std::size_t>( align );
+    auto rounded   = ( ( size == 0 ? 1 : size ) + alignment - 1 ) / alignment * alignment;
+    if( void* ptr = std::aligned_alloc( alignment, rounded ) )
+    {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+/**
+ * Releases memory from `counted_allocate`.  Kept out of line so the compiler does not
+ * inline `std::free` into call sites of `operator delete` and flag a mismatched pair.
+*/
+#if defined(__GNUC__)
+[[gnu::noinline]]
+#endif
+inline void counted_deallocate( void* ptr ) noexcept
+{
+    std::free( ptr );
+}
+
+} // End of tmns::log::test::impl namespace
+
+void* operator new( std::size_t size )
+{
+    return tmns::log::test::impl::counted_allocate( size );
+}
+
+void* operator new[]( std::size_t size )
+{
+    return tmns::log::test::impl::counted_allocate( size );
+}
+
+void* operator new( std::size_t size, const std::nothrow_t& ) noexcept
+{
+    try
+    {
+        return tmns::log::test::impl::counted_allocate( size );
+    }
+    catch( ... )
+    {
+        return nullptr;
+    }
+}
+
+void* operator new[]( std::size_t size, const std::nothrow_t& ) noexcept
+{
+    try
+    {
+        return tmns::log::test::impl::counted_allocate( size );
+    }
+    catch( ... )
+    {
+        return nullptr;
+    }
+}
+
+void* operator new( std::size_t size, std::align_val_t align )
+{
+    return tmns::log::test::impl::counted_allocate( size, align );
+}
+
+void* operator new[]( std::size_t size, std::align_val_t align )
+{
+    return tmns::log::test::impl::counted_allocate( size, align );
+}
+
+void operator delete( void* ptr ) noexcept
+{
+    tmns::log::test::impl::counted_deallocate( ptr );
+}
+
+void operator delete[]( void* ptr ) noexcept
+{
+    tmns::log::test::impl::counted_deallocate( ptr );
+}
+
+void operator delete( void* ptr, std::size_t ) noexcept
+{
+    tmns::log::test::impl::counted_deallocate( ptr );
+}
+
+void operator delete[]( void* ptr, std::size_t ) noexcept
+{
+    tmns::log::test::impl::counted_deallocate( ptr );
+}
+
+void operator delete( void* ptr, std::align_val_t ) noexcept
+{
+    tmns::log::test::impl::counted_deallocate( ptr );
+}
+
+void operator delete[]( void* ptr, std::align_val_t ) noexcept
+{
+    tmns::log::test::impl::counted_deallocate( ptr );
+}
+
+void operator delete( void* ptr, std::size_t, std::align_val_t ) noexcept
+{
+    tmns::log::test::impl::counted_deallocate( ptr );
+}
+
+void operator delete[]( void* ptr, std::size_t, std::align_val_t ) noexcept
+{
+    tmns::log::test::impl::counted_deallocate( ptr );
+}
@@ -0,0 +1,68 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    memory_sink.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Terminus Libraries
+#include <terminus/log/impl/boost/sinks.hpp>
+
+// C++ Standard Libraries
+#include <memory>
+#include <string>
+
+/**
+ * Capturing records in memory for tests and benchmarks.
+ *
+ * A "Memory" sink keeps a snapshot of each record's attributes, unformatted, in a buffer
+ * allocated up front.  Tests query the snapshots instead of parsing captured text:
+ *
+ *     auto capture = tmns::log::test::add_memory_sink();
+ *     tmns::log::Logger{ "app" }.warn( "disk ", kv( "free_mb", 12 ) );
+ *     EXPECT_EQ( capture->count( []( const auto& rec ){ return rec.scope == "app"; } ), 1u );
+ *     EXPECT_EQ( capture->records().front().field_as<int64_t>( "free_mb" ), 12 );
+ *
+ * A sink configured with `Destination=Memory` is found by its section name with
+ * `memory_sink()`.
+*/
+namespace tmns::log::test {
+
+/// Attribute snapshot of one captured record
+using Captured_Record = impl::sinks::Captured_Record;
+
+/// Value of a captured field
+using Field_Value = impl::sinks::Field_Value;
+
+/// Thread-safe store of a sink's captured records
+using Memory_Buffer = impl::sinks::Memory_Buffer;
+
+/**
+ * Adds a "Memory" sink accepting every record to the logging core, and returns its buffer.
+ * The sink's counters are reported under `name`.
+*/
+inline std::shared_ptr<Memory_Buffer> add_memory_sink( const std::string& name     = "Memory",
+                                                       size_t             capacity = impl::sinks::Memory_Sink_Factory::DEFAULT_CAPACITY )
+{
+    return impl::sinks::add_memory_sink( name, capacity );
+}
+
+/**
+ * Returns the buffer of the live "Memory" sink with this name, such as the section name
+ * of a configured sink, or nullptr if there is none.
+*/
+inline std::shared_ptr<Memory_Buffer> memory_sink( const std::string& name )
+{
+    return impl::sinks::Memory_Registry::instance().find( name );
+}
+
+} // End of tmns::log::test namespace
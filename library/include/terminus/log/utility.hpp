@@ -15,6 +15,7 @@
 #pragma once
 
 // Terminus Libraries
+#include <terminus/log/field.hpp>
 #include <terminus/log/impl/boost/utility.hpp>
 #include <terminus/log/impl/location.hpp>
 
@@ -0,0 +1,128 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    BENCH_Columnar.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * Logs the same records to a `JsonFile` and a `ColumnFile` sink, then counts the records
+ * per scope and severity from each file and prints the file sizes and read rates.
+ *
+ * Usage:
+ *
+ *     bench_terminus_log_columnar [--records=N]
+*/
+
+// C++ Standard Libraries
+#include <cstdio>
+#include <map>
+#include <string>
+#include <vector>
+
+// Terminus Libraries
+#include <terminus/log/columnar.hpp>
+#include <terminus/log/logger.hpp>
+#include <terminus/log/reader.hpp>
+
+// Project Libraries
+#include "benchmark_utility.hpp"
+
+using namespace tmns::log;
+
+using Counts = std::map<std::string,uint64_t>;
+
+/**
+ * Runs `fn`, which returns the counts per scope and severity, and prints its rate.
+*/
+template <typename FnT>
+Counts time_aggregate( const char* name,
+                       uint64_t    bytes,
+                       uint64_t    records,
+                       FnT&&       fn )
+{
+    auto start = bench::Clock::now();
+    Counts counts = fn();
+    auto elapsed = std::chrono::duration<double>( bench::Clock::now() - start ).count();
+    std::printf( "%-8s %10llu bytes %8.1f M records/s\n", name, static_cast<unsigned long long>( bytes ),
+                 static_cast<double>( records ) / elapsed / 1e6 );
+    return counts;
+}
+
+int main( int argc, char* argv[] )
+{
+    const auto records = bench::parse_option( argc, argv, "records", 2000000 );
+
+    const auto directory = bench::scratch_directory( "columnar" );
+    const auto json_file   = ( directory / "records.log" ).string();
+    const auto column_file = ( directory / "records.col" ).string();
+    bench::reconfigure( "[Sinks.Json]\nDestination=JsonFile\nFileName=\"" + json_file + "\"\n"
+                        "[Sinks.Columns]\nDestination=ColumnFile\nFileName=\"" + column_file + "\"\n" );
+    std::vector<Logger> loggers{ Logger{ "app" }, Logger{ "app.db" }, Logger{ "app.http" }, Logger{ "worker" } };
+    for( uint64_t i = 0; i < records; ++i )
+    {
+        auto& logger = loggers[i % loggers.size()];
+        if( i % 100 == 0 )
+        {
+            logger.error( "record ", i, " failed" );
+        }
+        else
+        {
+            logger.info( "record ", i, " succeeded with a message of typical length" );
+        }
+    }
+    bench::reconfigure( "" );
+
+    auto json = time_aggregate( "json", std::filesystem::file_size( json_file ), records, [&json_file]()
+    {
+        Counts counts;
+        reader::Log_File log{ json_file };
+        for( const auto& record : log.records() )
+        {
+            counts[std::string{ record.scope().value_or( "" ) } + "/" + std::string{ record.severity().value_or( "" ) }]++;
+        }
+        return counts;
+    });
+
+    auto columnar = time_aggregate( "columnar", std::filesystem::file_size( column_file ), records, [&column_file]()
+    {
+        Counts counts;
+        columnar::Column_File file{ column_file };
+        std::vector<uint32_t> scopes;
+        std::vector<uint32_t> severities;
+        for( const auto& block : file.blocks() )
+        {
+            auto scope    = block.column( "Scope" );
+            auto severity = block.column( "Severity" );
+            const auto scope_names    = scope->dictionary();
+            const auto severity_names = severity->dictionary();
+            scope->ids( scopes );
+            severity->ids( severities );
+
+            // Count dictionary id pairs, and look up names once per block
+            std::vector<uint64_t> pairs( scope_names.size() * severity_names.size(), 0 );
+            for( size_t i = 0; i < scopes.size(); ++i )
+            {
+                ++pairs[scopes[i] * severity_names.size() + severities[i]];
+            }
+            for( size_t i = 0; i < pairs.size(); ++i )
+            {
+                if( pairs[i] > 0 )
+                {
+                    counts[std::string{ scope_names[i / severity_names.size()] } + "/" +
+                           std::string{ severity_names[i % severity_names.size()] }] += pairs[i];
+                }
+            }
+        }
+        return counts;
+    });
+
+    std::filesystem::remove_all( directory );
+    return json == columnar ? 0 : 1;
+}
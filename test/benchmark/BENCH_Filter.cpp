@@ -0,0 +1,111 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    BENCH_Filter.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * Compares the per-record cost of evaluating the filters of `--sinks` sinks with the
+ * filters Boost.Log parses from the "Filter" settings against the ones
+ * `impl::filter::compile_filter()` builds from the same strings.  Each sink filters on
+ * its own scope, like a configuration routing subsystems to their own files, and the
+ * records cycle through `--scopes` scopes.
+ *
+ * Usage:
+ *
+ *     bench_terminus_log_filter [--sinks=N] [--scopes=N] [--records=N]
+*/
+
+// C++ Standard Libraries
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// Boost Libraries
+#include <boost/log/attributes/attribute_set.hpp>
+#include <boost/log/attributes/attribute_value_set.hpp>
+#include <boost/log/attributes/constant.hpp>
+#include <boost/log/utility/setup/filter_parser.hpp>
+
+// Terminus Libraries
+#include <terminus/log/configure.hpp>
+#include <terminus/log/impl/boost/filter_compiler.hpp>
+
+// Project Libraries
+#include "benchmark_utility.hpp"
+
+using namespace tmns::log;
+
+using severity_level = boost::log::trivial::severity_level;
+
+/**
+ * Returns the average nanoseconds per record spent running every filter on the record.
+*/
+double time_filters( const std::vector<boost::log::filter>&          filters,
+                     const std::vector<boost::log::attribute_value_set>& records,
+                     uint64_t                                        count,
+                     uint64_t&                                       accepted )
+{
+    auto start = bench::Clock::now();
+    for( uint64_t i = 0; i < count; ++i )
+    {
+        const auto& values = records[i % records.size()];
+        for( const auto& filter : filters )
+        {
+            accepted += filter( values ) ? 1 : 0;
+        }
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>( bench::Clock::now() - start );
+    return static_cast<double>( elapsed.count() ) / static_cast<double>( count );
+}
+
+int main( int argc, char* argv[] )
+{
+    const auto sinks   = bench::parse_option( argc, argv, "sinks", 12 );
+    const auto scopes  = bench::parse_option( argc, argv, "scopes", 32 );
+    const auto records = bench::parse_option( argc, argv, "records", 1000000 );
+
+    configure();
+
+    std::vector<boost::log::filter> parsed, compiled;
+    for( uint64_t sink = 0; sink < sinks; ++sink )
+    {
+        auto text = "(%Scope% contains \"subsystem" + std::to_string( sink ) + "\" and %Severity% >= info)"
+                    " or %Severity% >= error";
+        parsed.push_back( boost::log::parse_filter( text ) );
+        compiled.push_back( impl::filter::compile_filter( text ) );
+    }
+
+    boost::log::attribute_set empty;
+    std::vector<boost::log::attribute_value_set> values;
+    for( uint64_t scope = 0; scope < scopes; ++scope )
+    {
+        boost::log::attribute_set attributes;
+        attributes.insert( "Scope", boost::log::attributes::constant<std::string>(
+                                        "app.subsystem" + std::to_string( scope ) ) );
+        attributes.insert( "Severity", boost::log::attributes::constant<severity_level>(
+                                           static_cast<severity_level>( scope % 6 ) ) );
+        values.emplace_back( attributes, empty, empty );
+        values.back().freeze();
+    }
+
+    uint64_t parsed_accepted = 0, compiled_accepted = 0;
+    double parsed_ns   = time_filters( parsed, values, records, parsed_accepted );
+    double compiled_ns = time_filters( compiled, values, records, compiled_accepted );
+
+    std::printf( "%llu sinks, %llu scopes\n", static_cast<unsigned long long>( sinks ),
+                 static_cast<unsigned long long>( scopes ) );
+    std::printf( "parsed:   %8.1f ns/record (%llu accepted)\n", parsed_ns,
+                 static_cast<unsigned long long>( parsed_accepted ) );
+    std::printf( "compiled: %8.1f ns/record (%llu accepted)\n", compiled_ns,
+                 static_cast<unsigned long long>( compiled_accepted ) );
+    std::printf( "speedup:  %8.2fx\n", parsed_ns / compiled_ns );
+    return parsed_accepted == compiled_accepted ? 0 : 1;
+}
@@ -0,0 +1,141 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    BENCH_Formatter.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * Compares the per-record cost of text formatting with the formatter Boost.Log parses
+ * from a format string against the one `impl::format::compile_formatter()` builds from
+ * the same string.  Records are captured once and then formatted `--iterations` times
+ * into a reused buffer, so only the formatter is measured.  The JSON, CBOR, and
+ * MessagePack formatters are then compared by time and record size.
+ *
+ * Usage:
+ *
+ *     bench_terminus_log_formatter [--records=N] [--iterations=N]
+*/
+
+// C++ Standard Libraries
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// Boost Libraries
+#include <boost/log/core.hpp>
+#include <boost/log/sinks/basic_sink_backend.hpp>
+#include <boost/log/sinks/sync_frontend.hpp>
+#include <boost/log/utility/formatting_ostream.hpp>
+#include <boost/log/utility/setup/formatter_parser.hpp>
+
+// Terminus Libraries
+#include <terminus/log/configure.hpp>
+#include <terminus/log/impl/boost/binary_format.hpp>
+#include <terminus/log/impl/boost/format_compiler.hpp>
+#include <terminus/log/logger.hpp>
+#include <terminus/log/utility.hpp>
+
+// Project Libraries
+#include "benchmark_utility.hpp"
+
+using namespace tmns::log;
+
+/**
+ * Sink backend keeping every record it receives.
+*/
+class Capture_Backend : public boost::log::sinks::basic_sink_backend<boost::log::sinks::synchronized_feeding>
+{
+    public:
+
+        void consume( const boost::log::record_view& rec )
+        {
+            records.push_back( rec );
+        }
+
+        std::vector<boost::log::record_view> records;
+
+}; // End of Capture_Backend class
+
+/**
+ * Returns the average nanoseconds per record spent formatting the records.
+*/
+double time_formatter( const boost::log::formatter&                formatter,
+                       const std::vector<boost::log::record_view>& records,
+                       uint64_t                                    iterations )
+{
+    std::string buffer;
+    boost::log::formatting_ostream stream{ buffer };
+
+    auto start = bench::Clock::now();
+    for( uint64_t i = 0; i < iterations; ++i )
+    {
+        for( const auto& rec : records )
+        {
+            buffer.clear();
+            formatter( rec, stream );
+            stream.flush();
+        }
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>( bench::Clock::now() - start );
+    return static_cast<double>( elapsed.count() ) / static_cast<double>( iterations * records.size() );
+}
+
+int main( int argc, char* argv[] )
+{
+    const auto records    = bench::parse_option( argc, argv, "records", 1000 );
+    const auto iterations = bench::parse_option( argc, argv, "iterations", 200 );
+
+    configure();
+    boost::log::core::get()->remove_all_sinks();
+    auto backend = boost::make_shared<Capture_Backend>();
+    boost::log::core::get()->add_sink(
+        boost::make_shared<boost::log::sinks::synchronous_sink<Capture_Backend>>( backend ) );
+
+    Logger logger{ "bench" };
+    for( uint64_t i = 0; i < records; ++i )
+    {
+        logger.info( "order filled", kv( "qty", static_cast<int64_t>( i ) ), kv( "side", "buy" ) );
+    }
+    boost::log::core::get()->remove_all_sinks();
+
+    const std::vector<std::string> patterns {
+        R"([%TimeStamp%] %Severity(align=true,brackets=true)% %File%:%LineID% (%Scope%) %Message%)",
+        R"(%TimeStamp(format="%H:%M:%S.%f")% %Severity% %Message%)",
+        R"(%Severity(brackets=true)% %Scope%: %Message% qty=%qty% side=%side%)",
+    };
+
+    std::printf( "%-90s %12s %12s %8s\n", "format", "parsed ns", "compiled ns", "speedup" );
+    for( const auto& pattern : patterns )
+    {
+        double parsed   = time_formatter( boost::log::parse_formatter( pattern ), backend->records, iterations );
+        double compiled = time_formatter( impl::format::compile_formatter( pattern ), backend->records, iterations );
+        std::printf( "%-90s %12.1f %12.1f %7.2fx\n", pattern.c_str(), parsed, compiled, parsed / compiled );
+    }
+
+    // Structured encodings: time per record and average record size
+    std::printf( "\n%-10s %12s %12s\n", "encoding", "ns", "bytes" );
+    for( const auto& [name, formatter] : { std::pair{ "json",    boost::log::formatter{ &impl::format::json } },
+                                           std::pair{ "cbor",    boost::log::formatter{ &impl::format::cbor } },
+                                           std::pair{ "msgpack", boost::log::formatter{ &impl::format::msgpack } } } )
+    {
+        std::string buffer;
+        boost::log::formatting_ostream stream{ buffer };
+        for( const auto& rec : backend->records )
+        {
+            formatter( rec, stream );
+        }
+        stream.flush();
+        std::printf( "%-10s %12.1f %12.1f\n", name, time_formatter( formatter, backend->records, iterations ),
+                     static_cast<double>( buffer.size() ) / static_cast<double>( backend->records.size() ) );
+    }
+
+    configure();
+    return 0;
+}
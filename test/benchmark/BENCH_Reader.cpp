@@ -0,0 +1,116 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    BENCH_Reader.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * Compares reading a `JsonFile` log and counting its "error" records with `std::getline`
+ * against the memory-mapped `tmns::log::reader`, on one thread and with a parallel scan.
+ *
+ * Usage:
+ *
+ *     bench_terminus_log_reader [--records=N] [--threads=N]
+*/
+
+// C++ Standard Libraries
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+// Terminus Libraries
+#include <terminus/log/reader.hpp>
+
+// Project Libraries
+#include "benchmark_utility.hpp"
+
+using namespace tmns::log;
+
+/**
+ * Runs `fn`, which returns the number of matching records, and prints its throughput.
+*/
+template <typename FnT>
+uint64_t time_read( const char* name,
+                    uint64_t    bytes,
+                    FnT&&       fn )
+{
+    auto start = bench::Clock::now();
+    const uint64_t matches = fn();
+    auto elapsed = std::chrono::duration<double>( bench::Clock::now() - start ).count();
+    std::printf( "%-10s %8.1f MB/s (%llu errors)\n", name, static_cast<double>( bytes ) / elapsed / 1e6,
+                 static_cast<unsigned long long>( matches ) );
+    return matches;
+}
+
+int main( int argc, char* argv[] )
+{
+    const auto records = bench::parse_option( argc, argv, "records", 2000000 );
+    const auto threads = bench::parse_option( argc, argv, "threads", 0 );
+
+    const auto file = ( bench::scratch_directory( "reader" ) / "reader.log" ).string();
+    bench::reconfigure( "[Sinks.Json]\nDestination=JsonFile\nFileName=\"" + file + "\"\n" );
+    for( uint64_t i = 0; i < records; ++i )
+    {
+        if( i % 100 == 0 )
+        {
+            tmns::log::error( "record ", i, " failed" );
+        }
+        else
+        {
+            tmns::log::info( "record ", i, " succeeded with a message of typical length" );
+        }
+    }
+    bench::reconfigure( "" );
+    const auto bytes = std::filesystem::file_size( file );
+
+    auto getline = time_read( "getline", bytes, [&file]()
+    {
+        std::ifstream input{ file };
+        std::string line;
+        uint64_t matches = 0;
+        while( std::getline( input, line ) )
+        {
+            matches += line.find( "\"Severity\":\"error\"" ) != std::string::npos ? 1 : 0;
+        }
+        return matches;
+    });
+
+    auto mapped = time_read( "mapped", bytes, [&file]()
+    {
+        reader::Log_File log{ file };
+        uint64_t matches = 0;
+        for( const auto& record : log.records() )
+        {
+            matches += record.severity() == "error" ? 1 : 0;
+        }
+        return matches;
+    });
+
+    auto parallel = time_read( "parallel", bytes, [&file, threads]()
+    {
+        std::atomic<uint64_t> matches{ 0 };
+        reader::Scan_Options options;
+        options.threads = threads;
+        reader::for_each_chunk( { file }, [&matches]( const reader::Chunk& chunk )
+        {
+            uint64_t local = 0;
+            for( const auto& record : chunk.records() )
+            {
+                local += record.severity() == "error" ? 1 : 0;
+            }
+            matches.fetch_add( local );
+        }, options );
+        return matches.load();
+    });
+
+    std::filesystem::remove( file );
+    return getline == mapped && mapped == parallel ? 0 : 1;
+}
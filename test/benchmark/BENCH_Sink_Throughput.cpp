@@ -0,0 +1,235 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    BENCH_Sink_Throughput.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * Measures end-to-end throughput of the file sinks.  Each scenario configures a
+ * `JsonFile` or `TextFile` sink from a generated INI string (the same way `File_Fixture`
+ * does), enables size-based rotation, and pushes a sustained load through it.  For each
+ * scenario the benchmark reports:
+ *
+ *  - bytes/sec that reached the disk (measured from the files left behind),
+ *  - rotation stalls, i.e. calls slower than `--stall-factor` times the median call,
+ *  - how long `tmns::log::flush()` took to drain the sink after the last record.
+ *
+ * Results are written to `--output` as JSON so runs can be compared.
+ *
+ * Usage:
+ *
+ *     bench_terminus_log_sink_throughput [--records=N] [--message-size=N]
+ *                                        [--rotation-size=N] [--stall-factor=N]
+ *                                        [--output=path]
+*/
+
+// C++ Standard Libraries
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Boost Libraries
+#include <boost/json.hpp>
+
+// Terminus Libraries
+#include <terminus/log/configure.hpp>
+#include <terminus/log/logger.hpp>
+#include <terminus/log/utility.hpp>
+
+// Project Libraries
+#include "benchmark_utility.hpp"
+
+using namespace tmns::log;
+
+struct Scenario
+{
+    std::string destination;
+    bool        async;
+}; // End of Scenario struct
+
+struct Options
+{
+    size_t      records;
+    size_t      message_size;
+    size_t      rotation_size;
+    uint64_t    stall_factor;
+    std::string output;
+}; // End of Options struct
+
+/**
+ * Builds the INI configuration for the scenario.  Rotated files share the directory
+ * with the active file so the bytes written can be measured after the run.
+*/
+std::string make_config( const Scenario&              scenario,
+                         const Options&               options,
+                         const std::filesystem::path& directory )
+{
+    std::string contents;
+    contents += "[Sinks.Throughput]\n";
+    contents += "Destination=" + scenario.destination + "\n";
+    contents += "FileName=\"" + ( directory / "throughput-%3N.log" ).string() + "\"\n";
+    contents += "RotationSize=" + std::to_string( options.rotation_size ) + "\n";
+    contents += std::string{ "Asynchronous=" } + ( scenario.async ? "true" : "false" ) + "\n";
+    if( scenario.destination == "TextFile" )
+    {
+        contents += "Format=\"[%TimeStamp%] %Severity(align=true,brackets=true)% (%Scope%) %Message%\"\n";
+    }
+    return contents;
+}
+
+/**
+ * Returns the number of files in the directory and their total size.
+*/
+std::pair<size_t,uintmax_t> measure_directory( const std::filesystem::path& directory )
+{
+    size_t    files = 0;
+    uintmax_t bytes = 0;
+    for( const auto& entry : std::filesystem::directory_iterator( directory ) )
+    {
+        if( entry.is_regular_file() )
+        {
+            ++files;
+            bytes += entry.file_size();
+        }
+    }
+    return { files, bytes };
+}
+
+boost::json::object run_scenario( const Scenario& scenario,
+                                  const Options&  options )
+{
+    const std::string name = scenario.destination + ( scenario.async ? "-async" : "-sync" );
+    auto directory = bench::scratch_directory( "sink_throughput" ) / name;
+    std::filesystem::remove_all( directory );
+    std::filesystem::create_directories( directory );
+
+    boost::json::object result;
+    result["scenario"]    = name;
+    result["destination"] = scenario.destination;
+    result["async"]       = scenario.async;
+
+    if( !bench::reconfigure( make_config( scenario, options, directory ) ) )
+    {
+        std::fprintf( stderr, "Failed to configure logging for scenario %s\n", name.c_str() );
+        result["error"] = "configuration failed";
+        return result;
+    }
+
+    const std::string payload( options.message_size, 'x' );
+    std::vector<uint64_t> latencies( options.records );
+
+    Logger logger{ "throughput" };
+    auto begin = bench::Clock::now();
+    for( size_t i = 0; i < options.records; ++i )
+    {
+        auto call_begin = bench::Clock::now();
+        logger.info( i, ' ', payload );
+        auto call_end = bench::Clock::now();
+        latencies[i] = static_cast<uint64_t>( std::chrono::duration_cast<std::chrono::nanoseconds>( call_end - call_begin ).count() );
+    }
+    auto produced = bench::Clock::now();
+    tmns::log::flush();
+    auto drained = bench::Clock::now();
+
+    // Rotation happens inline with the record that crosses the size limit, so those calls
+    // stand out as outliers against the median.
+    auto sorted = latencies;
+    auto pct = bench::compute_percentiles( sorted );
+    const uint64_t stall_threshold = pct.p50 * options.stall_factor;
+    uint64_t stalls      = 0;
+    uint64_t stall_total = 0;
+    for( auto latency : latencies )
+    {
+        if( latency > stall_threshold )
+        {
+            ++stalls;
+            stall_total += latency;
+        }
+    }
+
+    bench::reconfigure( "" );
+    auto [files, bytes] = measure_directory( directory );
+
+    double produce_seconds = std::chrono::duration<double>( produced - begin ).count();
+    double total_seconds   = std::chrono::duration<double>( drained - begin ).count();
+
+    result["records"]             = options.records;
+    result["message_size"]        = options.message_size;
+    result["rotation_size"]       = options.rotation_size;
+    result["files"]               = files;
+    result["bytes"]               = bytes;
+    result["records_per_sec"]     = static_cast<double>( options.records ) / produce_seconds;
+    result["bytes_per_sec"]       = static_cast<double>( bytes ) / total_seconds;
+    result["latency_p50_ns"]      = pct.p50;
+    result["latency_p99_ns"]      = pct.p99;
+    result["latency_p999_ns"]     = pct.p999;
+    result["latency_max_ns"]      = pct.max;
+    result["stall_threshold_ns"]  = stall_threshold;
+    result["stalls"]              = stalls;
+    result["stall_total_ns"]      = stall_total;
+    result["flush_ms"]            = std::chrono::duration<double, std::milli>( drained - produced ).count();
+
+    std::printf( "%-16s %12.0f %14.0f %6zu %8llu %12llu %10.2f\n",
+                 name.c_str(),
+                 result["records_per_sec"].as_double(),
+                 result["bytes_per_sec"].as_double(),
+                 files,
+                 static_cast<unsigned long long>( stalls ),
+                 static_cast<unsigned long long>( pct.max ),
+                 result["flush_ms"].as_double() );
+    std::fflush( stdout );
+
+    std::filesystem::remove_all( directory );
+    return result;
+}
+
+int main( int argc, char* argv[] )
+{
+    Options options;
+    options.records       = static_cast<size_t>( bench::parse_option( argc, argv, "records", 200000 ) );
+    options.message_size  = static_cast<size_t>( bench::parse_option( argc, argv, "message-size", 128 ) );
+    options.rotation_size = static_cast<size_t>( bench::parse_option( argc, argv, "rotation-size", 4 * 1024 * 1024 ) );
+    options.stall_factor  = bench::parse_option( argc, argv, "stall-factor", 100 );
+    options.output        = "sink_throughput.json";
+    for( int i = 1; i < argc; ++i )
+    {
+        std::string_view arg{ argv[i] };
+        if( arg.starts_with( "--output=" ) )
+        {
+            options.output = std::string{ arg.substr( 9 ) };
+        }
+    }
+
+    std::printf( "%-16s %12s %14s %6s %8s %12s %10s\n",
+                 "scenario", "records/s", "bytes/s", "files", "stalls", "max(ns)", "flush(ms)" );
+
+    boost::json::array scenarios;
+    for( const auto& destination : { std::string{ "JsonFile" }, std::string{ "TextFile" } } )
+    {
+        for( bool async : { false, true } )
+        {
+            scenarios.push_back( run_scenario( Scenario{ destination, async }, options ) );
+        }
+    }
+
+    boost::json::object report;
+    report["benchmark"] = "sink_throughput";
+    report["version"]   = TERMINUS_LOG_VERSION_STR;
+    report["scenarios"] = std::move( scenarios );
+
+    std::ofstream output{ options.output };
+    output << report << std::endl;
+    std::printf( "Results written to %s\n", options.output.c_str() );
+
+    return 0;
+}
@@ -0,0 +1,93 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    BENCH_Stages.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * Splits the cost of a log call by stage.  Records are logged through a timed sink, and
+ * the sink's filter, formatter, and backend times are subtracted from the time of the
+ * whole call; the rest is the front end (attribute assembly, the record's message, and
+ * the sink frontend).  `Null` sinks give the baseline without I/O, and a timed
+ * `TextFile` sink adds the file writes.
+ *
+ * Usage:
+ *
+ *     bench_terminus_log_stages [--records=N]
+*/
+
+// C++ Standard Libraries
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Terminus Libraries
+#include <terminus/log/field.hpp>
+#include <terminus/log/logger.hpp>
+#include <terminus/log/stats.hpp>
+
+// Project Libraries
+#include "benchmark_utility.hpp"
+
+using namespace tmns::log;
+
+int main( int argc, char* argv[] )
+{
+    const auto records = bench::parse_option( argc, argv, "records", 200000 );
+    const auto directory = bench::scratch_directory( "stages" );
+    const std::string text_format = R"(Format="[%TimeStamp%] %Severity(brackets=true)% (%Scope%) %Message%")";
+
+    const std::vector<std::pair<std::string,std::string>> sinks {
+        { "null",         "Destination=Null\n" },
+        { "null text",    "Destination=Null\n" + text_format + "\n" },
+        { "null json",    "Destination=Null\nEncoding=Json\n" },
+        { "null cbor",    "Destination=Null\nEncoding=Cbor\n" },
+        { "textfile",     "Destination=TextFile\nTiming=true\n" + text_format + "\n"
+                          "FileName=\"" + ( directory / "records.log" ).string() + "\"\n" },
+    };
+
+    std::printf( "%-12s %10s %10s %10s %10s %10s\n", "sink", "total ns", "front ns", "filter ns", "format ns", "backend ns" );
+    for( const auto& [name, settings] : sinks )
+    {
+        bench::reconfigure( "[Sinks.Stage]\n" + settings );
+        Logger logger{ "bench" };
+
+        auto start = bench::Clock::now();
+        for( uint64_t i = 0; i < records; ++i )
+        {
+            logger.info( "order filled", kv( "qty", static_cast<int64_t>( i ) ), kv( "side", "buy" ) );
+        }
+        flush();
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>( bench::Clock::now() - start );
+
+        for( const auto& sink : stats().sinks )
+        {
+            if( sink.name != "Stage" )
+            {
+                continue;
+            }
+            auto per_record = [records]( auto duration )
+            {
+                return static_cast<double>( std::chrono::nanoseconds( duration ).count() ) / static_cast<double>( records );
+            };
+            const double total   = per_record( elapsed );
+            const double filter  = per_record( sink.filter_time );
+            const double format  = per_record( sink.format_time );
+            const double backend = per_record( sink.backend_time );
+            std::printf( "%-12s %10.1f %10.1f %10.1f %10.1f %10.1f\n", name.c_str(), total,
+                         total - filter - format - backend, filter, format, backend );
+        }
+    }
+
+    bench::reconfigure( "" );
+    std::filesystem::remove_all( directory );
+    return 0;
+}
@@ -0,0 +1,258 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    BENCH_Thread_Scaling.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * Measures how the logging front-end scales as producer threads are added.  Every
+ * configuration is run with 1, 2, 4, ... up to `--max-threads` producers, where each
+ * producer either owns its own `tmns::log::Logger`, shares a single instance
+ * with the other producers, or goes through the global functions.  Records pass through the core's
+ * global attributes (`RecordID`, `ThreadID`, ...) into a synchronous or asynchronous
+ * `TextFile` sink, and are either accepted or rejected by the core filter.
+ *
+ * Usage:
+ *
+ *     bench_terminus_log_thread_scaling [--max-threads=N] [--records=N]
+ *
+ * Cache misses are reported when perf counters are available to the process.
+*/
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <latch>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Terminus Libraries
+#include <terminus/log/configure.hpp>
+#include <terminus/log/logger.hpp>
+#include <terminus/log/utility.hpp>
+
+// Project Libraries
+#include "benchmark_utility.hpp"
+
+using namespace tmns::log;
+
+enum class Source { SCOPED, SHARED, GLOBAL };
+
+struct Scenario
+{
+    Source      source;
+    bool        async;
+    bool        filtered;
+}; // End of Scenario struct
+
+/**
+ * Builds the INI configuration for the scenario.  The core filter always rejects
+ * `debug` records, so filtered scenarios log at `debug` and unfiltered ones at `info`.
+*/
+std::string make_config( const Scenario&              scenario,
+                         const std::filesystem::path& log_path )
+{
+    std::string contents;
+    contents += "[Core]\n";
+    contents += "Filter=\"%Severity% >= info\"\n";
+    contents += "[Sinks.Bench]\n";
+    contents += "Destination=TextFile\n";
+    contents += "Format=\"[%TimeStamp%] %RecordID% %ThreadID% %Severity% (%Scope%) %Message%\"\n";
+    contents += "FileName=\"" + log_path.string() + "\"\n";
+    contents += std::string{ "Asynchronous=" } + ( scenario.async ? "true" : "false" ) + "\n";
+    return contents;
+}
+
+/**
+ * Per-thread results of a single run.
+*/
+struct Producer_Result
+{
+    std::vector<uint64_t> latencies;
+    bench::Clock::time_point begin;
+    bench::Clock::time_point end;
+}; // End of Producer_Result struct
+
+/**
+ * Writes `records` log records from the calling thread, recording the latency of each call.
+*/
+void produce( const Scenario&  scenario,
+              Logger&          shared,
+              size_t           records,
+              std::latch&      start,
+              Producer_Result& result )
+{
+    Logger logger{ "bench" };
+    auto& latencies = result.latencies;
+    latencies.resize( records );
+    start.arrive_and_wait();
+    result.begin = bench::Clock::now();
+    for( size_t i = 0; i < records; ++i )
+    {
+        auto begin = bench::Clock::now();
+        if( scenario.source == Source::SCOPED )
+        {
+            if( scenario.filtered )
+            {
+                logger.debug( "scaling record ", i );
+            }
+            else
+            {
+                logger.info( "scaling record ", i );
+            }
+        }
+        else if( scenario.source == Source::SHARED )
+        {
+            if( scenario.filtered )
+            {
+                shared.debug( "scaling record ", i );
+            }
+            else
+            {
+                shared.info( "scaling record ", i );
+            }
+        }
+        else
+        {
+            if( scenario.filtered )
+            {
+                tmns::log::debug( "scaling record ", i );
+            }
+            else
+            {
+                tmns::log::info( "scaling record ", i );
+            }
+        }
+        auto end = bench::Clock::now();
+        latencies[i] = static_cast<uint64_t>( std::chrono::duration_cast<std::chrono::nanoseconds>( end - begin ).count() );
+    }
+    result.end = bench::Clock::now();
+}
+
+void run_scenario( const Scenario& scenario,
+                   size_t          max_threads,
+                   size_t          records )
+{
+    auto log_path = bench::scratch_directory( "thread_scaling" ) / "scaling.log";
+    if( !bench::reconfigure( make_config( scenario, log_path ) ) )
+    {
+        std::fprintf( stderr, "Failed to configure logging for scenario\n" );
+        return;
+    }
+
+    std::vector<size_t> thread_counts;
+    for( size_t count = 1; count < max_threads; count *= 2 )
+    {
+        thread_counts.push_back( count );
+    }
+    thread_counts.push_back( max_threads );
+
+    Logger shared{ "bench" };
+
+    for( auto thread_count : thread_counts )
+    {
+        std::vector<Producer_Result> results( thread_count );
+        std::vector<std::thread> threads;
+        std::latch start{ static_cast<std::ptrdiff_t>( thread_count + 1 ) };
+
+        bench::Cache_Miss_Counter cache_misses;
+        cache_misses.start();
+
+        for( size_t t = 0; t < thread_count; ++t )
+        {
+            threads.emplace_back( produce, std::cref( scenario ), std::ref( shared ), records, std::ref( start ), std::ref( results[t] ) );
+        }
+
+        start.arrive_and_wait();
+        for( auto& thread : threads )
+        {
+            thread.join();
+        }
+        auto produced = bench::Clock::now();
+        tmns::log::flush();
+        auto drained = bench::Clock::now();
+
+        auto misses = cache_misses.stop();
+
+        // Merge per-thread latencies for the percentile report, but keep the worst per-thread p99
+        // since a single starved thread is what shows up first when the library stops scaling.
+        std::vector<uint64_t> all;
+        all.reserve( thread_count * records );
+        uint64_t worst_thread_p99 = 0;
+        auto begin = results.front().begin;
+        auto end   = results.front().end;
+        for( auto& result : results )
+        {
+            all.insert( all.end(), result.latencies.begin(), result.latencies.end() );
+            worst_thread_p99 = std::max( worst_thread_p99, bench::compute_percentiles( result.latencies ).p99 );
+            begin = std::min( begin, result.begin );
+            end   = std::max( end, result.end );
+        }
+        auto pct = bench::compute_percentiles( all );
+
+        double seconds = std::chrono::duration<double>( end - begin ).count();
+        double rate    = static_cast<double>( thread_count * records ) / seconds;
+        double flush_ms = std::chrono::duration<double, std::milli>( drained - produced ).count();
+
+        std::string miss_str = "n/a";
+        if( misses )
+        {
+            char buffer[32];
+            std::snprintf( buffer, sizeof( buffer ), "%.2f",
+                           static_cast<double>( *misses ) / static_cast<double>( thread_count * records ) );
+            miss_str = buffer;
+        }
+
+        std::printf( "%-7s %-6s %-11s %7zu %14.0f %8llu %8llu %8llu %12llu %10.2f %12s\n",
+                     scenario.source == Source::SCOPED ? "scoped" :
+                     scenario.source == Source::SHARED ? "shared" : "global",
+                     scenario.async ? "async" : "sync",
+                     scenario.filtered ? "filtered" : "unfiltered",
+                     thread_count,
+                     rate,
+                     static_cast<unsigned long long>( pct.p50 ),
+                     static_cast<unsigned long long>( pct.p99 ),
+                     static_cast<unsigned long long>( pct.p999 ),
+                     static_cast<unsigned long long>( worst_thread_p99 ),
+                     flush_ms,
+                     miss_str.c_str() );
+        std::fflush( stdout );
+    }
+
+    bench::reconfigure( "" );
+    std::filesystem::remove( log_path );
+}
+
+int main( int argc, char* argv[] )
+{
+    auto max_threads = static_cast<size_t>( bench::parse_option( argc, argv, "max-threads",
+                                                                 std::max( 1U, std::thread::hardware_concurrency() ) ) );
+    max_threads = std::max<size_t>( max_threads, 1 );
+    auto records     = static_cast<size_t>( bench::parse_option( argc, argv, "records", 20000 ) );
+
+    std::printf( "%-7s %-6s %-11s %7s %14s %8s %8s %8s %12s %10s %12s\n",
+                 "source", "sink", "filter", "threads", "records/s",
+                 "p50(ns)", "p99(ns)", "p999(ns)", "worst p99", "flush(ms)", "misses/rec" );
+
+    for( auto source : { Source::SCOPED, Source::SHARED, Source::GLOBAL } )
+    {
+        for( bool async : { false, true } )
+        {
+            for( bool filtered : { false, true } )
+            {
+                run_scenario( Scenario{ source, async, filtered }, max_threads, records );
+            }
+        }
+    }
+
+    return 0;
+}
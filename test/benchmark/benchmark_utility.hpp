@@ -0,0 +1,204 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    benchmark_utility.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Boost Libraries
+#include <boost/log/core.hpp>
+
+// Terminus Libraries
+#include <terminus/log/configure.hpp>
+#include <terminus/log/utility.hpp>
+
+namespace tmns::log::bench {
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * Latency percentiles (in nanoseconds) computed from a set of samples.
+*/
+struct Percentiles
+{
+    uint64_t p50{ 0 };
+    uint64_t p99{ 0 };
+    uint64_t p999{ 0 };
+    uint64_t max{ 0 };
+}; // End of Percentiles struct
+
+/**
+ * Computes the latency percentiles of the provided samples.  The samples are sorted in place.
+*/
+inline Percentiles compute_percentiles( std::vector<uint64_t>& samples )
+{
+    Percentiles result;
+    if( samples.empty() )
+    {
+        return result;
+    }
+    std::sort( samples.begin(), samples.end() );
+    auto at = [&]( double p )
+    {
+        auto index = static_cast<size_t>( p * static_cast<double>( samples.size() - 1 ) );
+        return samples[index];
+    };
+    result.p50  = at( 0.50 );
+    result.p99  = at( 0.99 );
+    result.p999 = at( 0.999 );
+    result.max  = samples.back();
+    return result;
+}
+
+/**
+ * Counts hardware cache misses for the calling process, including any threads it
+ * creates after `start()` is called.  Uses `perf_event_open` on Linux.  When perf
+ * counters are not available (other platforms, containers, or a restrictive
+ * `perf_event_paranoid` setting), `available()` returns false and `stop()` returns
+ * an empty optional.
+*/
+class Cache_Miss_Counter
+{
+    public:
+
+        Cache_Miss_Counter()
+        {
+#if defined(__linux__)
+            perf_event_attr attr;
+            std::memset( &attr, 0, sizeof( attr ) );
+            attr.type           = PERF_TYPE_HARDWARE;
+            attr.size           = sizeof( attr );
+            attr.config         = PERF_COUNT_HW_CACHE_MISSES;
+            attr.disabled       = 1;
+            attr.inherit        = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv     = 1;
+            m_fd = static_cast<int>( syscall( SYS_perf_event_open, &attr, 0, -1, -1, 0 ) );
+#endif
+        }
+
+        Cache_Miss_Counter( const Cache_Miss_Counter& )            = delete;
+        Cache_Miss_Counter& operator=( const Cache_Miss_Counter& ) = delete;
+
+        ~Cache_Miss_Counter()
+        {
+#if defined(__linux__)
+            if( m_fd >= 0 )
+            {
+                close( m_fd );
+            }
+#endif
+        }
+
+        [[nodiscard]] bool available() const
+        {
+            return m_fd >= 0;
+        }
+
+        void start()
+        {
+#if defined(__linux__)
+            if( available() )
+            {
+                ioctl( m_fd, PERF_EVENT_IOC_RESET, 0 );
+                ioctl( m_fd, PERF_EVENT_IOC_ENABLE, 0 );
+            }
+#endif
+        }
+
+        std::optional<uint64_t> stop()
+        {
+#if defined(__linux__)
+            if( available() )
+            {
+                ioctl( m_fd, PERF_EVENT_IOC_DISABLE, 0 );
+                uint64_t count = 0;
+                if( read( m_fd, &count, sizeof( count ) ) == static_cast<ssize_t>( sizeof( count ) ) )
+                {
+                    return count;
+                }
+            }
+#endif
+            return std::nullopt;
+        }
+
+    private:
+
+        /// Perf event file descriptor, or -1 if counters are unavailable
+        int m_fd{ -1 };
+
+}; // End of Cache_Miss_Counter class
+
+/**
+ * Returns a scratch directory for benchmark output, creating it if needed.
+*/
+inline std::filesystem::path scratch_directory( std::string_view name )
+{
+    auto path = std::filesystem::temp_directory_path() / "tmns_log_bench" / name;
+    std::filesystem::create_directories( path );
+    return path;
+}
+
+/**
+ * Drops every sink from the Boost.Log core and configures the library from the provided
+ * INI contents.  Each call to `tmns::log::configure()` adds sinks to the core, so benchmarks
+ * reset the core between runs to avoid measuring the sinks of a previous configuration.
+*/
+inline bool reconfigure( const std::string& contents )
+{
+    tmns::log::flush();
+    boost::log::core::get()->remove_all_sinks();
+    boost::log::core::get()->reset_filter();
+    std::istringstream config{ contents };
+    return tmns::log::configure( config );
+}
+
+/**
+ * Parses a `--name=value` numeric command-line option, returning the default when absent.
+*/
+inline uint64_t parse_option( int                argc,
+                              char*              argv[],
+                              std::string_view   name,
+                              uint64_t           default_value )
+{
+    const std::string prefix = "--" + std::string{ name } + "=";
+    for( int i = 1; i < argc; ++i )
+    {
+        std::string_view arg{ argv[i] };
+        if( arg.starts_with( prefix ) )
+        {
+            return std::stoull( std::string{ arg.substr( prefix.size() ) } );
+        }
+    }
+    return default_value;
+}
+
+} // End of tmns::log::bench namespace
@@ -0,0 +1,273 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_allocations.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * Pins the number of heap allocations made by a single log call for each supported
+ * configuration.  The counts below are exact: a change that removes allocations must
+ * lower the matching constant, and one that adds allocations fails the test.
+ *
+ * JSON records are serialized by Boost.JSON, whose allocations depend on its version.
+ * The test measures those against the linked Boost.JSON by building and writing the
+ * same object, and pins the allocations the library makes besides them.
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <streambuf>
+#include <string>
+
+// Boost Libraries
+#include <boost/json.hpp>
+
+// Terminus Libraries
+#include <terminus/log/configure.hpp>
+#include <terminus/log/logger.hpp>
+#include <terminus/log/utility.hpp>
+#include <terminus/log/test/allocation_counter.hpp>
+#include <terminus/log/test/allocation_hooks.hpp>
+
+// Project Libraries
+#include "config_fixture.hpp"
+
+using tmns::log::test::Allocation_Counter;
+
+namespace {
+
+/// Allocations made per call, by configuration.  Location records also pay for the
+/// location attributes.  JSON records make `ALLOCS_JSON_RECORD` allocations on top of
+/// the ones Boost.JSON makes to build and write the record's object: the one every
+/// console record makes, and the ISO time stamp string.
+constexpr uint64_t ALLOCS_FILTERED          = 0;
+constexpr uint64_t ALLOCS_CONSOLE           = 1;
+constexpr uint64_t ALLOCS_CONSOLE_LOCATION  = 5;
+constexpr uint64_t ALLOCS_JSON_RECORD       = 2;
+
+/// Number of calls averaged per measurement
+constexpr uint64_t CALLS = 64;
+
+/**
+ * Stream buffer that discards everything without allocating.
+*/
+class Null_Buffer : public std::streambuf
+{
+    protected:
+
+        int overflow( int c ) override
+        {
+            return c;
+        }
+
+        std::streamsize xsputn( const char*, std::streamsize count ) override
+        {
+            return count;
+        }
+
+}; // End of Null_Buffer class
+
+/**
+ * Sends console output to a discarding buffer so that only the logging library's own
+ * allocations are counted.
+*/
+class Allocations : public Config_Fixture
+{
+    protected:
+
+        void SetUp() override
+        {
+            Config_Fixture::SetUp();
+            m_orig_buf = std::clog.rdbuf( &m_null_buffer );
+        }
+
+        void TearDown() override
+        {
+            Config_Fixture::TearDown();
+            std::clog.rdbuf( m_orig_buf );
+        }
+
+        std::filesystem::path json_file() const
+        {
+            return directory() / "allocations.log";
+        }
+
+        void configure_json()
+        {
+            ASSERT_TRUE( configure( "[Sinks.Json]\nDestination=JsonFile\nFileName=\"" + json_file().string() + "\"\n" ) );
+        }
+
+        /**
+         * Returns the number of allocations per call.  The functor is invoked once
+         * beforehand so that one-time, per-thread setup is not counted, and every call must
+         * make the same number of allocations.
+        */
+        template <class CallableT>
+        uint64_t allocations_per_call( CallableT&& func )
+        {
+            func();
+            auto total = Allocation_Counter::count_allocations( [&]()
+            {
+                for( uint64_t i = 0; i < CALLS; ++i )
+                {
+                    func();
+                }
+            });
+            EXPECT_EQ( total % CALLS, 0 ) << total << " allocations in " << CALLS << " calls";
+            return total / CALLS;
+        }
+
+        /**
+         * Returns the allocations Boost.JSON makes per record to build the object of the
+         * last record in the JSON file, member by member as `format::json` does, and to
+         * write it to a stream.
+        */
+        uint64_t json_object_allocations()
+        {
+            tmns::log::flush();
+            std::ifstream input{ json_file() };
+            std::string line;
+            std::string last;
+            while( std::getline( input, line ) )
+            {
+                last = line;
+            }
+            const auto record = boost::json::parse( last ).as_object();
+
+            Null_Buffer buffer;
+            std::ostream stream{ &buffer };
+            return allocations_per_call( [&]()
+            {
+                boost::json::object json;
+                for( const auto& member : record )
+                {
+                    json[member.key()] = member.value();
+                }
+                stream << json;
+            });
+        }
+
+    private:
+
+        Null_Buffer     m_null_buffer;
+        std::streambuf* m_orig_buf{ nullptr };
+
+}; // End of Allocations class
+
+const std::string CONSOLE_CONFIG = R"(
+[Sinks.Console]
+Destination=Console
+Format="[%TimeStamp%] %Severity% (%Scope%) %File%:%Line% %Message%"
+)";
+
+const std::string FILTERED_CONFIG = R"(
+[Core]
+Filter="%Severity% >= info"
+[Sinks.Console]
+Destination=Console
+Format="[%TimeStamp%] %Severity% (%Scope%) %Message%"
+)";
+
+} // End of anonymous namespace
+
+/*****************************************************/
+/*      Verify the counter sees allocations at all    */
+/*****************************************************/
+TEST( Allocation_Counter, Counts_Calling_Thread )
+{
+    auto count = Allocation_Counter::count_allocations( []()
+    {
+        auto ptr = std::make_unique<int>( 5 );
+        std::string str( 1024, 'x' );
+        (void)ptr;
+    });
+    EXPECT_EQ( count, 2 );
+}
+
+/***************************************************/
+/*      Records rejected by the core filter        */
+/***************************************************/
+TEST_F( Allocations, Filtered )
+{
+    ASSERT_TRUE( configure( FILTERED_CONFIG ) );
+    tmns::log::Logger logger{ "test" };
+
+    auto global = allocations_per_call( [](){ tmns::log::debug( "filtered ", 42 ); } );
+    auto scoped = allocations_per_call( [&](){ logger.debug( "filtered ", 42 ); } );
+
+    EXPECT_EQ( global, ALLOCS_FILTERED );
+    EXPECT_EQ( scoped, ALLOCS_FILTERED );
+}
+
+/***************************************/
+/*      Records sent to the console    */
+/***************************************/
+TEST_F( Allocations, Console )
+{
+    ASSERT_TRUE( configure( CONSOLE_CONFIG ) );
+    tmns::log::Logger logger{ "test" };
+
+    auto global = allocations_per_call( [](){ tmns::log::info( "console ", 42 ); } );
+    auto scoped = allocations_per_call( [&](){ logger.debug( "console ", 42 ); } );
+
+    EXPECT_EQ( global, ALLOCS_CONSOLE );
+    EXPECT_EQ( scoped, ALLOCS_CONSOLE );
+}
+
+/********************************************************/
+/*      Records sent to the console with a location     */
+/********************************************************/
+TEST_F( Allocations, Console_Location )
+{
+    ASSERT_TRUE( configure( CONSOLE_CONFIG ) );
+    tmns::log::Logger logger{ "test" };
+
+    auto global = allocations_per_call( [](){ tmns::log::info( tmns::log::loc(), "location ", 42 ); } );
+    auto scoped = allocations_per_call( [&](){ logger.debug( tmns::log::loc(), "location ", 42 ); } );
+
+    EXPECT_EQ( global, ALLOCS_CONSOLE_LOCATION );
+    EXPECT_EQ( scoped, ALLOCS_CONSOLE_LOCATION );
+}
+
+/****************************************/
+/*      Records sent to a JSON file     */
+/****************************************/
+TEST_F( Allocations, Json )
+{
+    configure_json();
+    tmns::log::Logger logger{ "test" };
+
+    auto global      = allocations_per_call( [](){ tmns::log::info( "json ", 42 ); } );
+    auto global_json = json_object_allocations();
+    auto scoped      = allocations_per_call( [&](){ logger.debug( "json ", 42 ); } );
+    auto scoped_json = json_object_allocations();
+
+    EXPECT_EQ( global, ALLOCS_JSON_RECORD + global_json );
+    EXPECT_EQ( scoped, ALLOCS_JSON_RECORD + scoped_json );
+}
+
+/**************************************************************/
+/*      Logger handles are pointer-sized and cheap to make    */
+/**************************************************************/
+TEST_F( Allocations, Logger_Construction )
+{
+    static_assert( sizeof( tmns::log::Logger ) == sizeof( void* ) );
+
+    tmns::log::Logger first{ "test.construction" };
+    auto construct = allocations_per_call( [](){ tmns::log::Logger logger{ "test.construction" }; (void)logger; } );
+    auto copy      = allocations_per_call( [&](){ tmns::log::Logger logger{ first }; (void)logger; } );
+
+    EXPECT_EQ( construct, 0 );
+    EXPECT_EQ( copy, 0 );
+}
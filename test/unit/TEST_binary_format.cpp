@@ -0,0 +1,301 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_binary_format.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <bit>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <variant>
+#include <vector>
+
+// Boost Libraries
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/log/attributes/constant.hpp>
+#include <boost/log/core.hpp>
+
+// Terminus Libraries
+#include <terminus/log/configure.hpp>
+#include <terminus/log/field.hpp>
+#include <terminus/log/impl/boost/binary_format.hpp>
+#include <terminus/log/logger.hpp>
+
+// Project Libraries
+#include "config_fixture.hpp"
+
+namespace {
+
+namespace fmt = tmns::log::impl::format;
+
+using Value  = std::variant<uint64_t,int64_t,double,bool,std::string>;
+using Record = std::map<std::string,Value>;
+
+/**
+ * Decodes the subset of CBOR and MessagePack the binary formatters write.
+*/
+class Decoder
+{
+    public:
+
+        Decoder( std::string_view data,
+                 fmt::Encoding    encoding )
+          : m_data{ data },
+            m_encoding{ encoding }
+        {
+        }
+
+        [[nodiscard]] bool empty() const
+        {
+            return m_data.empty();
+        }
+
+        Record record()
+        {
+            Record result;
+            const uint64_t size = m_encoding == fmt::Encoding::CBOR ? cbor_argument( 5 ) : msgpack_map_size();
+            for( uint64_t i = 0; i < size; ++i )
+            {
+                auto name = std::get<std::string>( value() );
+                result[name] = value();
+            }
+            return result;
+        }
+
+    private:
+
+        uint8_t byte()
+        {
+            if( m_data.empty() )
+            {
+                throw std::runtime_error( "truncated" );
+            }
+            auto value = static_cast<uint8_t>( m_data.front() );
+            m_data.remove_prefix( 1 );
+            return value;
+        }
+
+        uint64_t big_endian( int size )
+        {
+            uint64_t value = 0;
+            for( int i = 0; i < size; ++i )
+            {
+                value = ( value << 8 ) | byte();
+            }
+            return value;
+        }
+
+        std::string bytes( uint64_t size )
+        {
+            std::string value{ m_data.substr( 0, size ) };
+            m_data.remove_prefix( size );
+            return value;
+        }
+
+        uint64_t cbor_argument( uint8_t expected_major )
+        {
+            const uint8_t head = byte();
+            if( head >> 5 != expected_major )
+            {
+                throw std::runtime_error( "unexpected CBOR type" );
+            }
+            const uint8_t info = head & 0x1f;
+            return info < 24 ? info : big_endian( 1 << ( info - 24 ) );
+        }
+
+        uint64_t msgpack_map_size()
+        {
+            const uint8_t head = byte();
+            if( ( head & 0xf0 ) == 0x80 )
+            {
+                return head & 0x0f;
+            }
+            return head == 0xde ? big_endian( 2 ) : big_endian( 4 );
+        }
+
+        Value value()
+        {
+            const uint8_t head = static_cast<uint8_t>( m_data.front() );
+            if( m_encoding == fmt::Encoding::CBOR )
+            {
+                switch( head >> 5 )
+                {
+                    case 0: return cbor_argument( 0 );
+                    case 1: return static_cast<int64_t>( -1 - static_cast<int64_t>( cbor_argument( 1 ) ) );
+                    case 3: return bytes( cbor_argument( 3 ) );
+                    default: break;
+                }
+                byte();
+                if( head == 0xf4 || head == 0xf5 )
+                {
+                    return head == 0xf5;
+                }
+                return std::bit_cast<double>( big_endian( 8 ) );
+            }
+
+            byte();
+            if( head < 0x80 )
+            {
+                return static_cast<uint64_t>( head );
+            }
+            if( head >= 0xe0 )
+            {
+                return static_cast<int64_t>( static_cast<int8_t>( head ) );
+            }
+            if( ( head & 0xe0 ) == 0xa0 )
+            {
+                return bytes( head & 0x1f );
+            }
+            switch( head )
+            {
+                case 0xc2: return false;
+                case 0xc3: return true;
+                case 0xcb: return std::bit_cast<double>( big_endian( 8 ) );
+                case 0xcc: return big_endian( 1 );
+                case 0xcd: return big_endian( 2 );
+                case 0xce: return big_endian( 4 );
+                case 0xcf: return big_endian( 8 );
+                case 0xd0: return static_cast<int64_t>( static_cast<int8_t>( big_endian( 1 ) ) );
+                case 0xd1: return static_cast<int64_t>( static_cast<int16_t>( big_endian( 2 ) ) );
+                case 0xd2: return static_cast<int64_t>( static_cast<int32_t>( big_endian( 4 ) ) );
+                case 0xd3: return static_cast<int64_t>( big_endian( 8 ) );
+                case 0xd9: return bytes( big_endian( 1 ) );
+                case 0xda: return bytes( big_endian( 2 ) );
+                case 0xdb: return bytes( big_endian( 4 ) );
+                default: throw std::runtime_error( "unexpected MessagePack type" );
+            }
+        }
+
+        std::string_view m_data;
+
+        fmt::Encoding m_encoding;
+
+}; // End of Decoder class
+
+class Binary_Format : public Config_Fixture
+{
+    protected:
+
+        static std::string read_file( const std::filesystem::path& path )
+        {
+            std::ifstream input{ path, std::ios::binary };
+            return { std::istreambuf_iterator<char>( input ), std::istreambuf_iterator<char>() };
+        }
+
+        template <fmt::Encoding EncodingT, typename FnT>
+        static std::string encode( FnT&& fn )
+        {
+            std::string out;
+            fmt::detail::Binary_Writer<EncodingT> writer{ out };
+            fn( writer );
+            return out;
+        }
+
+}; // End of Binary_Format class
+
+} // End of anonymous namespace
+
+/***************************************************************/
+/*      Values are written in the shortest standard encoding    */
+/***************************************************************/
+TEST_F( Binary_Format, Shortest_Encodings )
+{
+    using namespace std::string_literals;
+    auto cbor_int = []( int64_t value ){ return encode<fmt::Encoding::CBOR>( [value]( auto& w ){ w.signed_integer( value ); } ); };
+    EXPECT_EQ( cbor_int( 23 ), "\x17"s );
+    EXPECT_EQ( cbor_int( 500 ), "\x19\x01\xf4"s );
+    EXPECT_EQ( cbor_int( -1 ), "\x20"s );
+    EXPECT_EQ( cbor_int( -500 ), "\x39\x01\xf3"s );
+    EXPECT_EQ( cbor_int( INT64_MIN ), "\x3b\x7f\xff\xff\xff\xff\xff\xff\xff"s );
+    EXPECT_EQ( encode<fmt::Encoding::CBOR>( []( auto& w ){ w.string( "abc" ); } ), "\x63" "abc"s );
+    EXPECT_EQ( encode<fmt::Encoding::CBOR>( []( auto& w ){ w.map_header( 30 ); } ), "\xb8\x1e"s );
+
+    auto msgpack_int = []( int64_t value ){ return encode<fmt::Encoding::MSGPACK>( [value]( auto& w ){ w.signed_integer( value ); } ); };
+    EXPECT_EQ( msgpack_int( 127 ), "\x7f"s );
+    EXPECT_EQ( msgpack_int( 200 ), "\xcc\xc8"s );
+    EXPECT_EQ( msgpack_int( 70000 ), "\xce\x00\x01\x11\x70"s );
+    EXPECT_EQ( msgpack_int( -32 ), "\xe0"s );
+    EXPECT_EQ( msgpack_int( -33 ), "\xd0\xdf"s );
+    EXPECT_EQ( msgpack_int( -40000 ), "\xd2\xff\xff\x63\xc0"s );
+    EXPECT_EQ( encode<fmt::Encoding::MSGPACK>( []( auto& w ){ w.string( std::string( 40, 'x' ) ); } ).substr( 0, 2 ), "\xd9\x28"s );
+    EXPECT_EQ( encode<fmt::Encoding::MSGPACK>( []( auto& w ){ w.map_header( 16 ); } ), "\xde\x00\x10"s );
+    EXPECT_EQ( encode<fmt::Encoding::MSGPACK>( []( auto& w ){ w.floating( 1.5 ); } ), "\xcb\x3f\xf8\0\0\0\0\0\0"s );
+
+    EXPECT_EQ( fmt::parse_encoding( "MessagePack" ), fmt::Encoding::MSGPACK );
+    EXPECT_EQ( fmt::parse_encoding( "CBOR" ), fmt::Encoding::CBOR );
+    EXPECT_THROW( fmt::parse_encoding( "xml" ), std::runtime_error );
+}
+
+/*********************************************************************/
+/*      File sinks write decodable records with the JSON field set    */
+/*********************************************************************/
+TEST_F( Binary_Format, File_Sink_Records )
+{
+    for( auto [name, encoding] : { std::pair{ "Cbor", fmt::Encoding::CBOR }, std::pair{ "MsgPack", fmt::Encoding::MSGPACK } } )
+    {
+        const auto binary_file = directory() / ( std::string{ name } + ".bin" );
+        const auto json_file   = directory() / ( std::string{ name } + ".json" );
+        ASSERT_TRUE( configure( "[Sinks.Binary]\nDestination=JsonFile\nEncoding=" + std::string{ name } +
+                                "\nFileName=\"" + binary_file.string() + "\"\n"
+                                "[Sinks.Json]\nDestination=JsonFile\nFileName=\"" + json_file.string() + "\"\n" ) );
+
+        auto core = boost::log::core::get();
+        auto [it, added] = core->add_thread_attribute( "TimeStamp", boost::log::attributes::constant<boost::posix_time::ptime>(
+                                                                         boost::posix_time::time_from_string( "2026-10-19 10:00:00.250" ) ) );
+        tmns::log::Logger logger{ "app.db" };
+        for( int i = 0; i < 10; ++i )
+        {
+            logger.warn( "query \"", i, "\"\nfailed", tmns::log::kv( "rows", static_cast<int64_t>( -i ) ),
+                         tmns::log::kv( "retry", i % 2 == 0 ), tmns::log::kv( "ratio", 0.5 ),
+                         tmns::log::kv( "table", "orders" ) );
+        }
+        core->remove_thread_attribute( it );
+        core->remove_all_sinks();
+
+        const auto data = read_file( binary_file );
+        Decoder decoder{ data, encoding };
+        std::vector<Record> records;
+        while( !decoder.empty() )
+        {
+            records.push_back( decoder.record() );
+        }
+        ASSERT_EQ( records.size(), 10u ) << name;
+
+        const auto& record = records[3];
+        EXPECT_EQ( std::get<std::string>( record.at( "Severity" ) ), "warning" );
+        EXPECT_EQ( std::get<std::string>( record.at( "Scope" ) ), "app.db" );
+        EXPECT_EQ( std::get<std::string>( record.at( "Message" ) ), "query \"3\"\nfailed" );
+        EXPECT_EQ( std::get<uint64_t>( record.at( "TimeStamp" ) ), 1'792'404'000'250'000'000u );
+        EXPECT_GT( std::get<uint64_t>( record.at( "RecordID" ) ), std::get<uint64_t>( records[2].at( "RecordID" ) ) );
+        EXPECT_TRUE( std::holds_alternative<uint64_t>( record.at( "ThreadID" ) ) );
+        EXPECT_EQ( std::get<int64_t>( record.at( "rows" ) ), -3 );
+        EXPECT_EQ( std::get<bool>( record.at( "retry" ) ), false );
+        EXPECT_EQ( std::get<double>( record.at( "ratio" ) ), 0.5 );
+        EXPECT_EQ( std::get<std::string>( record.at( "table" ) ), "orders" );
+
+        // The same records are smaller than their JSON
+        EXPECT_LT( data.size(), std::filesystem::file_size( json_file ) ) << name;
+    }
+
+    EXPECT_FALSE( configure( "[Sinks.Binary]\nDestination=JsonFile\nEncoding=Cbor\nIndex=true\n"
+                             "FileName=\"" + ( directory() / "index.bin" ).string() + "\"\n" ) );
+    EXPECT_FALSE( configure( "[Sinks.Binary]\nDestination=JsonFile\nEncoding=Text\n"
+                             "FileName=\"" + ( directory() / "text.bin" ).string() + "\"\n" ) );
+    EXPECT_FALSE( configure( "[Sinks.Shipper]\nDestination=UnixSocket\nPath=\"/tmp/none.sock\"\nEncoding=Cbor\n" ) );
+}
@@ -0,0 +1,182 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_columnar.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+// Boost Libraries
+#include <boost/log/core.hpp>
+
+// Terminus Libraries
+#include <terminus/log/columnar.hpp>
+#include <terminus/log/configure.hpp>
+#include <terminus/log/logger.hpp>
+#include <terminus/log/stats.hpp>
+#include <terminus/log/utility.hpp>
+
+// Project Libraries
+#include "config_fixture.hpp"
+
+namespace {
+
+namespace col = tmns::log::columnar;
+
+using Columnar = Config_Fixture;
+
+} // End of anonymous namespace
+
+/***************************************************************/
+/*      Every encoding round-trips, including missing values    */
+/***************************************************************/
+TEST_F( Columnar, Block_Round_Trip )
+{
+    tmns::log::impl::columnar::Block_Builder builder;
+    for( int i = 0; i < 100; ++i )
+    {
+        tmns::log::impl::columnar::Row row;
+        row.record_id  = i == 50 ? std::numeric_limits<uint64_t>::max() : static_cast<uint64_t>( i + 1 );
+        row.time_stamp = i % 2 == 0 ? 1'800'000'000'000'000 + i : -1'000 * i;
+        row.severity   = i % 10 == 0 ? "error" : "info";
+        if( i % 3 != 0 )
+        {
+            row.scope = i % 3 == 1 ? "app" : "app.db";
+        }
+        row.message = std::string( static_cast<size_t>( i % 7 ), 'x' );
+        builder.add( row );
+    }
+    std::string data{ tmns::log::impl::columnar::FILE_MAGIC };
+    builder.write( data );
+    EXPECT_EQ( builder.size(), 0u );
+    builder.write( data );
+
+    col::Column_File file{ write_file( "round_trip.col", data ) };
+    ASSERT_EQ( file.blocks().size(), 1u );
+    const auto& block = file.blocks().front();
+    EXPECT_EQ( block.record_count(), 100u );
+    EXPECT_EQ( block.columns().size(), 5u );
+    EXPECT_FALSE( block.column( "File" ) );
+
+    std::vector<int64_t> values;
+    block.column( "RecordID" )->integers( values );
+    EXPECT_EQ( static_cast<uint64_t>( values[50] ), std::numeric_limits<uint64_t>::max() );
+    EXPECT_EQ( values[99], 100 );
+    block.column( "TimeStamp" )->integers( values );
+    EXPECT_EQ( values[98], 1'800'000'000'000'098 );
+    EXPECT_EQ( values[99], -99'000 );
+
+    auto severity = *block.column( "Severity" );
+    EXPECT_TRUE( severity.all_present() );
+    EXPECT_EQ( severity.dictionary(), ( std::vector<std::string_view>{ "error", "info" } ) );
+    std::vector<uint32_t> ids;
+    severity.ids( ids );
+    EXPECT_EQ( ids[0], 0u );
+    EXPECT_EQ( ids[1], 1u );
+
+    auto scope = *block.column( "Scope" );
+    EXPECT_FALSE( scope.all_present() );
+    std::vector<std::string_view> strings;
+    scope.strings( strings );
+    for( size_t i = 0; i < 100; ++i )
+    {
+        EXPECT_EQ( scope.has_value( i ), i % 3 != 0 );
+        EXPECT_EQ( strings[i], i % 3 == 0 ? "" : i % 3 == 1 ? "app" : "app.db" );
+    }
+
+    block.column( "Message" )->strings( strings );
+    EXPECT_EQ( strings[13], "xxxxxx" );
+    EXPECT_THROW( block.column( "Message" )->integers( values ), std::runtime_error );
+
+    // A block cut short is left out, and other files are rejected
+    col::Column_File truncated{ write_file( "truncated.col", data.substr( 0, data.size() - 1 ) ) };
+    EXPECT_TRUE( truncated.blocks().empty() );
+    EXPECT_THROW( col::Column_File{ write_file( "text.log", "[info] text\n" ) }, std::runtime_error );
+}
+
+/*****************************************************************/
+/*      The sink writes blocks that aggregate by scope/severity   */
+/*****************************************************************/
+TEST_F( Columnar, Sink_Blocks )
+{
+    const auto path = ( directory() / "sink" / "records.col" ).string();
+    ASSERT_TRUE( configure( "[Sinks.Columns]\nDestination=ColumnFile\nBlockSize=100\n"
+                            "FileName=\"" + path + "\"\n" ) );
+    tmns::log::Logger app{ "app" };
+    tmns::log::Logger db{ "app.db" };
+    for( int i = 0; i < 250; ++i )
+    {
+        if( i % 5 == 0 )
+        {
+            db.error( "query ", i, " failed" );
+        }
+        else
+        {
+            app.info( "request ", i );
+        }
+    }
+    boost::log::core::get()->flush();
+
+    col::Column_File file{ path };
+    ASSERT_EQ( file.blocks().size(), 3u );
+    EXPECT_EQ( file.blocks()[2].record_count(), 50u );
+    EXPECT_EQ( file.record_count(), 250u );
+
+    std::map<std::string,uint64_t> counts;
+    std::vector<std::string_view> scopes;
+    std::vector<std::string_view> severities;
+    std::vector<std::string_view> messages;
+    std::vector<int64_t> ids;
+    int64_t previous_id = 0;
+    for( const auto& block : file.blocks() )
+    {
+        block.column( "Scope" )->strings( scopes );
+        block.column( "Severity" )->strings( severities );
+        block.column( "Message" )->strings( messages );
+        block.column( "RecordID" )->integers( ids );
+        EXPECT_TRUE( block.column( "TimeStamp" ) );
+        for( size_t i = 0; i < block.record_count(); ++i )
+        {
+            counts[std::string{ scopes[i] } + "/" + std::string{ severities[i] }]++;
+            EXPECT_GT( ids[i], previous_id );
+            previous_id = ids[i];
+        }
+    }
+    EXPECT_EQ( counts, ( std::map<std::string,uint64_t>{ { "app/info", 200 }, { "app.db/error", 50 } } ) );
+    EXPECT_EQ( messages.back(), "request 249" );
+
+    for( const auto& sink : tmns::log::stats().sinks )
+    {
+        if( sink.name == "Columns" )
+        {
+            EXPECT_EQ( sink.records_emitted, 250u );
+        }
+    }
+
+    // Appending adds blocks after the existing ones
+    ASSERT_TRUE( configure( "[Sinks.Columns]\nDestination=ColumnFile\nAppend=true\n"
+                            "FileName=\"" + path + "\"\n" ) );
+    tmns::log::info( "appended" );
+    boost::log::core::get()->remove_all_sinks();
+    EXPECT_EQ( col::Column_File{ path }.record_count(), 251u );
+
+    EXPECT_FALSE( configure( "[Sinks.Columns]\nDestination=ColumnFile\nFormat=\"%Message%\"\n"
+                             "FileName=\"" + path + "\"\n" ) );
+    EXPECT_FALSE( configure( "[Sinks.Columns]\nDestination=ColumnFile\n" ) );
+}
@@ -0,0 +1,177 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_fields.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+// Boost Libraries
+#include <boost/json.hpp>
+
+// Terminus Libraries
+#include <terminus/log/configure.hpp>
+#include <terminus/log/logger.hpp>
+#include <terminus/log/test/stream_interceptor.hpp>
+#include <terminus/log/utility.hpp>
+
+// Project Libraries
+#include "config_fixture.hpp"
+
+namespace {
+
+/**
+ * Writes JSON records to a file in the test's temp directory.
+*/
+class Fields : public Config_Fixture
+{
+    protected:
+
+        std::filesystem::path json_path() const
+        {
+            return directory() / "fields.log";
+        }
+
+        /**
+         * Returns the last record written to the JSON file
+        */
+        boost::json::object last_json_record() const
+        {
+            tmns::log::flush();
+            std::ifstream input{ json_path() };
+            std::string line, last_line;
+            while( std::getline( input, line ) )
+            {
+                if( !line.empty() )
+                {
+                    last_line = line;
+                }
+            }
+            return boost::json::parse( last_line ).as_object();
+        }
+
+}; // End of Fields class
+
+} // End of anonymous namespace
+
+/***********************************************************/
+/*      Fields are attributes, not part of the message     */
+/***********************************************************/
+TEST_F( Fields, Text_Format_References_Fields )
+{
+    tmns::log::test::Stream_Interceptor interceptor{ std::clog };
+    ASSERT_TRUE( configure( "[Sinks.Console]\nDestination=Console\n"
+                            "Format=\"%Message%|qty=%qty%|px=%px%|side=%side%|ok=%ok%\"\n" ) );
+
+    tmns::log::Logger logger{ "fields" };
+    logger.info( "order filled", tmns::log::kv( "qty", 5 ), tmns::log::kv( "px", 101.25 ),
+                 tmns::log::kv( "side", std::string{ "buy" } ), tmns::log::kv( "ok", true ) );
+    tmns::log::flush();
+
+    EXPECT_EQ( interceptor.get_intercepted_contents(), "order filled|qty=5|px=101.25|side=buy|ok=true" );
+}
+
+/**************************************************************/
+/*      Fields and message arguments can be interleaved       */
+/**************************************************************/
+TEST_F( Fields, Global_Functions )
+{
+    tmns::log::test::Stream_Interceptor interceptor{ std::clog };
+    ASSERT_TRUE( configure( "[Sinks.Console]\nDestination=Console\nFormat=\"%Message% (%count%)\"\n" ) );
+
+    tmns::log::warn( "found ", tmns::log::kv( "count", 3u ), 3, " items" );
+    tmns::log::flush();
+
+    EXPECT_EQ( interceptor.get_intercepted_contents(), "found 3 items (3)" );
+}
+
+/*************************************************************/
+/*      JSON records hold fields as native JSON values       */
+/*************************************************************/
+TEST_F( Fields, Json_Native_Types )
+{
+    ASSERT_TRUE( configure( "[Sinks.Json]\nDestination=JsonFile\nFileName=\"" + json_path().string() + "\"\n" ) );
+
+    tmns::log::Logger logger{ "fields" };
+    logger.info( "order filled",
+                 tmns::log::kv( "qty", 5 ),
+                 tmns::log::kv( "px", 101.25 ),
+                 tmns::log::kv( "id", uint64_t{ 18446744073709551615ULL } ),
+                 tmns::log::kv( "side", "buy" ),
+                 tmns::log::kv( "ok", false ) );
+
+    auto obj = last_json_record();
+    EXPECT_EQ( obj.at( "Message" ).as_string(), "order filled" );
+    EXPECT_EQ( obj.at( "Scope" ).as_string(), "fields" );
+
+    ASSERT_TRUE( obj.at( "qty" ).is_int64() );
+    EXPECT_EQ( obj.at( "qty" ).as_int64(), 5 );
+    ASSERT_TRUE( obj.at( "px" ).is_double() );
+    EXPECT_DOUBLE_EQ( obj.at( "px" ).as_double(), 101.25 );
+    ASSERT_TRUE( obj.at( "id" ).is_uint64() );
+    EXPECT_EQ( obj.at( "id" ).as_uint64(), 18446744073709551615ULL );
+    ASSERT_TRUE( obj.at( "side" ).is_string() );
+    EXPECT_EQ( obj.at( "side" ).as_string(), "buy" );
+    ASSERT_TRUE( obj.at( "ok" ).is_bool() );
+    EXPECT_FALSE( obj.at( "ok" ).as_bool() );
+}
+
+/*********************************************************/
+/*      Fields do not replace existing attributes        */
+/*********************************************************/
+TEST_F( Fields, Core_Attributes_Win )
+{
+    ASSERT_TRUE( configure( "[Sinks.Json]\nDestination=JsonFile\nFileName=\"" + json_path().string() + "\"\n" ) );
+
+    tmns::log::Logger logger{ "fields" };
+    logger.info( "collision", tmns::log::kv( "Scope", "other" ) );
+
+    auto obj = last_json_record();
+    EXPECT_EQ( obj.at( "Scope" ).as_string(), "fields" );
+}
+
+/**********************************************************/
+/*      Child loggers attach their fields to every call   */
+/**********************************************************/
+TEST_F( Fields, Child_Logger )
+{
+    ASSERT_TRUE( configure( "[Sinks.Json]\nDestination=JsonFile\nFileName=\"" + json_path().string() + "\"\n" ) );
+
+    tmns::log::Logger logger{ "fields" };
+    auto child = [&logger]()
+    {
+        std::string request_id{ "req-42" };
+        return logger.with( tmns::log::kv( "request_id", request_id ), tmns::log::kv( "tenant", 7 ) );
+    }();
+
+    child.info( "accepted", tmns::log::kv( "qty", 5 ) );
+    auto obj = last_json_record();
+    EXPECT_EQ( obj.at( "Scope" ).as_string(), "fields" );
+    EXPECT_EQ( obj.at( "request_id" ).as_string(), "req-42" );
+    EXPECT_EQ( obj.at( "tenant" ).as_int64(), 7 );
+    EXPECT_EQ( obj.at( "qty" ).as_int64(), 5 );
+
+    // Children of children keep the parent's fields, the parent is unchanged
+    child.with( tmns::log::kv( "stage", "commit" ) ).warn( "committed" );
+    obj = last_json_record();
+    EXPECT_EQ( obj.at( "request_id" ).as_string(), "req-42" );
+    EXPECT_EQ( obj.at( "stage" ).as_string(), "commit" );
+
+    logger.info( "unrelated" );
+    obj = last_json_record();
+    EXPECT_EQ( obj.if_contains( "request_id" ), nullptr );
+    EXPECT_EQ( obj.if_contains( "stage" ), nullptr );
+}
@@ -0,0 +1,243 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_file_index.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <filesystem>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Boost Libraries
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/log/attributes/constant.hpp>
+#include <boost/log/core.hpp>
+
+// Terminus Libraries
+#include <terminus/log/configure.hpp>
+#include <terminus/log/impl/file_index.hpp>
+#include <terminus/log/stats.hpp>
+#include <terminus/log/utility.hpp>
+
+// Project Libraries
+#include "config_fixture.hpp"
+
+namespace {
+
+namespace idx = tmns::log::impl::index;
+
+class File_Index : public Config_Fixture
+{
+    protected:
+
+        static boost::posix_time::ptime base_time()
+        {
+            return boost::posix_time::time_from_string( "2026-10-19 10:00:00" );
+        }
+
+        /**
+         * Logs `count` records, `per_second` of them in each second after `base_time()`.
+        */
+        static void log_records( int count,
+                                 int per_second )
+        {
+            auto core = boost::log::core::get();
+            for( int i = 0; i < count; ++i )
+            {
+                auto time = base_time() + boost::posix_time::seconds( i / per_second );
+                auto [it, added] = core->add_thread_attribute(
+                    "TimeStamp", boost::log::attributes::constant<boost::posix_time::ptime>( time ) );
+                tmns::log::info( "record ", i );
+                core->remove_thread_attribute( it );
+            }
+        }
+
+        /**
+         * Returns the rotated files and the active file, oldest first.
+        */
+        std::vector<std::string> log_files() const
+        {
+            std::vector<std::string> files;
+            for( int n = 0;; ++n )
+            {
+                char name[32];
+                std::snprintf( name, sizeof( name ), "json_%03d.log", n );
+                if( !std::filesystem::exists( directory() / name ) )
+                {
+                    return files;
+                }
+                files.push_back( ( directory() / name ).string() );
+            }
+        }
+
+        static uint64_t read_all( const std::vector<std::string>& files,
+                                  const idx::Window&              window,
+                                  std::ostream&                   output )
+        {
+            uint64_t count = 0;
+            for( const auto& file : files )
+            {
+                count += idx::read_window( file, window, output );
+            }
+            return count;
+        }
+
+}; // End of File_Index class
+
+} // End of anonymous namespace
+
+/*************************************************************/
+/*      Parsing the time stamps written by the JSON format    */
+/*************************************************************/
+TEST_F( File_Index, Parse_Time_Stamp )
+{
+    EXPECT_EQ( idx::parse_time_stamp( "1970-01-01T00:00:00" ), 0 );
+    EXPECT_EQ( idx::parse_time_stamp( "1970-01-02 00:00:01.5" ), 86401500000 );
+    EXPECT_EQ( idx::parse_time_stamp( "2026-10-19T10:00:00.000001Z" ),
+               ( base_time() - boost::posix_time::ptime{ boost::gregorian::date( 1970, 1, 1 ) } ).total_microseconds() + 1 );
+    EXPECT_FALSE( idx::parse_time_stamp( "2026-10-19" ) );
+    EXPECT_FALSE( idx::parse_time_stamp( "yesterday at noon" ) );
+}
+
+/**************************************************************/
+/*      Searches never skip records written out of order       */
+/**************************************************************/
+TEST_F( File_Index, Out_Of_Order_Blocks )
+{
+    // The second block holds a record older than the first block's newest
+    idx::File_Index index{ 400, { { 0,   10, 20, 1, 5 },
+                                  { 100, 15, 30, 6, 9 },
+                                  { 200, 31, 40, 10, 12 },
+                                  { 300, 41, 50, 13, 20 } } };
+    EXPECT_EQ( index.time_begin( 5 ), 0u );
+    EXPECT_EQ( index.time_begin( 21 ), 100u );
+    EXPECT_EQ( index.time_begin( 35 ), 200u );
+    EXPECT_EQ( index.time_begin( 51 ), 400u );
+    EXPECT_EQ( index.time_end( 14 ), 100u );
+    EXPECT_EQ( index.time_end( 40 ), 300u );
+    EXPECT_FALSE( index.time_end( 45 ) );
+    EXPECT_EQ( index.id_begin( 11 ), 200u );
+    EXPECT_EQ( index.id_end( 9 ), 200u );
+}
+
+/************************************************************************/
+/*      Rotated JSON files get sidecar indexes that seek to a window     */
+/************************************************************************/
+TEST_F( File_Index, Json_File_Seeks_To_Time_Window )
+{
+    ASSERT_TRUE( configure( "[Sinks.Json]\nDestination=JsonFile\nIndex=true\nRotationSize=20000\n"
+                            "FileName=\"" + ( directory() / "json_%3N.log" ).string() + "\"\n" ) );
+    log_records( 600, 10 );
+    tmns::log::flush();
+
+    auto files = log_files();
+    ASSERT_GT( files.size(), 2u );
+    for( const auto& sink : tmns::log::stats().sinks )
+    {
+        if( sink.name == "Json" )
+        {
+            EXPECT_EQ( sink.rotations, files.size() - 1 );
+        }
+    }
+    for( const auto& file : files )
+    {
+        auto index = idx::File_Index::load( idx::index_file_name( file ) );
+        ASSERT_TRUE( index ) << file;
+        EXPECT_EQ( index->indexed_size(), std::filesystem::file_size( file ) );
+        EXPECT_GT( index->entries().size(), 1u );
+        EXPECT_EQ( index->entries().front().offset, 0u );
+    }
+
+    // Seconds 20 to 29 hold records 200 to 299
+    idx::Window window;
+    window.from_time = idx::parse_time_stamp( "2026-10-19T10:00:20" );
+    window.to_time   = idx::parse_time_stamp( "2026-10-19T10:00:29" );
+    std::stringstream output;
+    EXPECT_EQ( read_all( files, window, output ), 100u );
+    EXPECT_NE( output.str().find( "record 200\"" ), std::string::npos );
+    EXPECT_NE( output.str().find( "record 299\"" ), std::string::npos );
+    EXPECT_EQ( output.str().find( "record 199\"" ), std::string::npos );
+    EXPECT_EQ( output.str().find( "record 300\"" ), std::string::npos );
+
+    // Files before the window are skipped from their end, and files after it from their start
+    size_t skipped = 0;
+    for( const auto& file : files )
+    {
+        auto index = idx::File_Index::load( idx::index_file_name( file ) );
+        if( index->time_begin( *window.from_time ) == index->indexed_size() ||
+            index->time_end( *window.to_time ) == 0u )
+        {
+            ++skipped;
+        }
+    }
+    EXPECT_GE( skipped, files.size() - 2 );
+    EXPECT_GT( skipped, 0u );
+
+    // Without the indexes the same records are found by reading every file
+    for( const auto& file : files )
+    {
+        std::filesystem::remove( idx::index_file_name( file ) );
+    }
+    std::stringstream unindexed;
+    EXPECT_EQ( read_all( files, window, unindexed ), 100u );
+    EXPECT_EQ( unindexed.str(), output.str() );
+}
+
+/**************************************************/
+/*      Record ID windows and appended files       */
+/**************************************************/
+TEST_F( File_Index, Record_ID_Window_And_Append )
+{
+    const auto settings = "[Sinks.Text]\nDestination=TextFile\nIndex=true\nAppend=true\n"
+                          "Format=\"%RecordID% %Message%\"\n"
+                          "FileName=\"" + ( directory() / "json_%3N.log" ).string() + "\"\n";
+    ASSERT_TRUE( configure( settings ) );
+    log_records( 50, 10 );
+    boost::log::core::get()->remove_all_sinks();
+
+    // Appending keeps the blocks already in the index
+    auto first = idx::File_Index::load( idx::index_file_name( log_files().front() ) );
+    ASSERT_TRUE( first );
+    ASSERT_TRUE( configure( settings ) );
+    log_records( 50, 10 );
+    boost::log::core::get()->remove_all_sinks();
+
+    auto files = log_files();
+    ASSERT_EQ( files.size(), 1u );
+    auto index = idx::File_Index::load( idx::index_file_name( files.front() ) );
+    ASSERT_TRUE( index );
+    EXPECT_EQ( index->entries().size(), first->entries().size() * 2 );
+    EXPECT_EQ( index->indexed_size(), std::filesystem::file_size( files.front() ) );
+
+    // Text lines are not checked individually, so whole blocks are read
+    const auto last_id = index->entries().back().max_id;
+    idx::Window window;
+    window.from_id = last_id - 5;
+    std::stringstream output;
+    EXPECT_EQ( idx::read_window( files.front(), window, output ), 10u );
+    EXPECT_NE( output.str().find( std::to_string( last_id ) + " record 49" ), std::string::npos );
+}
+
+/*****************************************************/
+/*      Settings the index cannot follow are rejected */
+/*****************************************************/
+TEST_F( File_Index, Invalid_Settings )
+{
+    const auto file = ( directory() / "json_%3N.log" ).string();
+    EXPECT_FALSE( configure( "[Sinks.Json]\nDestination=JsonFile\nIndex=true\nFileName=\"" + file + "\"\n"
+                             "Target=\"" + directory().string() + "\"\n" ) );
+    EXPECT_FALSE( configure( "[Sinks.Json]\nDestination=JsonFile\nIndex=true\nIndexInterval=0\nFileName=\"" + file + "\"\n" ) );
+    EXPECT_FALSE( configure( "[Sinks.Json]\nDestination=JsonFile\nIndex=yes\nFileName=\"" + file + "\"\n" ) );
+}
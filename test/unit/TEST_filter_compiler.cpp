@@ -0,0 +1,183 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_filter_compiler.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Boost Libraries
+#include <boost/log/attributes/attribute_set.hpp>
+#include <boost/log/attributes/attribute_value_set.hpp>
+#include <boost/log/attributes/constant.hpp>
+#include <boost/log/core.hpp>
+#include <boost/log/utility/setup/filter_parser.hpp>
+
+// Terminus Libraries
+#include <terminus/log/configure.hpp>
+#include <terminus/log/impl/boost/filter_compiler.hpp>
+#include <terminus/log/logger.hpp>
+#include <terminus/log/stats.hpp>
+#include <terminus/log/utility.hpp>
+
+namespace {
+
+using severity_level = boost::log::trivial::severity_level;
+
+/**
+ * Returns the attribute values of a record with the provided attributes.
+*/
+boost::log::attribute_value_set make_values( const boost::log::attribute_set& attributes )
+{
+    boost::log::attribute_set empty;
+    boost::log::attribute_value_set values{ attributes, empty, empty };
+    values.freeze();
+    return values;
+}
+
+boost::log::attribute_value_set make_values( const std::string& scope,
+                                             severity_level     level )
+{
+    boost::log::attribute_set attributes;
+    attributes.insert( "Scope", boost::log::attributes::constant<std::string>( scope ) );
+    attributes.insert( "Severity", boost::log::attributes::constant<severity_level>( level ) );
+    return make_values( attributes );
+}
+
+const std::vector<std::string> FILTERS {
+    R"(%Severity% >= info)",
+    R"(%Severity% < warning)",
+    R"(%Severity% = error or %Severity% != debug and %Severity% <= trace)",
+    R"(%Scope% contains "Apple")",
+    R"(%Scope% = "Orange" & !(%Severity% > info))",
+    R"(%Scope% begins_with net and %Scope% ends_with "io")",
+    R"(%Scope% > "M" | %Scope% <= "Banana")",
+    R"((%Scope%) & (%Severity%))",
+    R"((%Scope% contains "Apple" and %Severity% >= error) or (%Scope% contains "Orange" and %Severity% >= info) or (not (%Scope% contains "Apple") and not (%Scope% contains "Orange")))",
+    R"(%Scope% contains "quote\"d")",
+};
+
+const std::vector<std::string> SCOPES { "Apple", "Orange", "GreenApple", "net.io", "net.tcp",
+                                        "Banana", "Melon", "", "quote\"d scope" };
+
+} // End of anonymous namespace
+
+/*************************************************************************/
+/*      Compiled filters make the same decisions as Boost.Log's parser   */
+/*************************************************************************/
+TEST( Filter_Compiler, Matches_Boost )
+{
+    tmns::log::configure();
+    tmns::log::impl::filter::reset_table();
+
+    // All filters share one table, so each scope row holds a bit per filter
+    std::vector<boost::log::filter> compiled, parsed;
+    for( const auto& text : FILTERS )
+    {
+        compiled.push_back( tmns::log::impl::filter::compile_filter( text ) );
+        parsed.push_back( boost::log::parse_filter( text ) );
+    }
+
+    for( int pass = 0; pass < 2; ++pass )
+    {
+        for( const auto& scope : SCOPES )
+        {
+            for( int level = 0; level <= static_cast<int>( severity_level::fatal ); ++level )
+            {
+                auto values = make_values( scope, static_cast<severity_level>( level ) );
+                for( size_t i = 0; i < FILTERS.size(); ++i )
+                {
+                    EXPECT_EQ( compiled[i]( values ), parsed[i]( values ) )
+                        << FILTERS[i] << " scope=" << scope << " level=" << level;
+                }
+            }
+        }
+    }
+}
+
+/***************************************************************************/
+/*      Records without a string scope are filtered by Boost.Log's filter  */
+/***************************************************************************/
+TEST( Filter_Compiler, Fallback )
+{
+    tmns::log::configure();
+    auto compiled = tmns::log::impl::filter::compile_filter( R"(not (%Scope% contains "Apple"))" );
+    auto parsed   = boost::log::parse_filter( R"(not (%Scope% contains "Apple"))" );
+
+    boost::log::attribute_set no_scope;
+    no_scope.insert( "Severity", boost::log::attributes::constant<severity_level>( severity_level::info ) );
+    EXPECT_EQ( compiled( make_values( no_scope ) ), parsed( make_values( no_scope ) ) );
+
+    boost::log::attribute_set int_scope;
+    int_scope.insert( "Scope", boost::log::attributes::constant<int>( 7 ) );
+    int_scope.insert( "Severity", boost::log::attributes::constant<severity_level>( severity_level::info ) );
+    EXPECT_EQ( compiled( make_values( int_scope ) ), parsed( make_values( int_scope ) ) );
+
+    // Filters on other attributes are not compiled, and bad syntax still throws
+    auto line = tmns::log::impl::filter::compile_filter( R"(%Line% > 10)" );
+    EXPECT_FALSE( line( make_values( "Apple", severity_level::info ) ) );
+    EXPECT_ANY_THROW( tmns::log::impl::filter::compile_filter( R"(%Scope% contains)" ) );
+}
+
+/*****************************************************************/
+/*      Sinks configured from settings use compiled filters      */
+/*****************************************************************/
+TEST( Filter_Compiler, Sink_Settings )
+{
+    boost::log::core::get()->remove_all_sinks();
+    std::istringstream config{ "[Sinks.Apple]\nDestination=Console\nFormat=\"%Message%\"\n"
+                               "Filter=\"%Scope% contains \\\"Apple\\\" and %Severity% >= warning\"\n"
+                               "[Sinks.Rest]\nDestination=Console\nFormat=\"%Message%\"\n"
+                               "Filter=\"not (%Scope% contains \\\"Apple\\\")\"\n" };
+    ASSERT_TRUE( tmns::log::configure( config ) );
+
+    std::stringstream discard;
+    auto* old = std::clog.rdbuf( discard.rdbuf() );
+    std::vector<std::thread> threads;
+    for( int t = 0; t < 4; ++t )
+    {
+        threads.emplace_back( []()
+        {
+            tmns::log::Logger apple{ "Apple" };
+            tmns::log::Logger other{ "Orange" };
+            for( int i = 0; i < 100; ++i )
+            {
+                apple.info( "filtered" );
+                apple.warn( "apple" );
+                other.debug( "other" );
+            }
+        });
+    }
+    for( auto& thread : threads )
+    {
+        thread.join();
+    }
+    tmns::log::flush();
+    std::clog.rdbuf( old );
+
+    uint64_t apple = 0, rest = 0;
+    for( const auto& sink : tmns::log::stats().sinks )
+    {
+        if( sink.name == "Apple" ) apple = sink.records_emitted;
+        if( sink.name == "Rest" )  rest  = sink.records_emitted;
+    }
+    EXPECT_EQ( apple, 400u );
+    EXPECT_EQ( rest, 400u );
+
+    boost::log::core::get()->remove_all_sinks();
+    tmns::log::configure();
+}
@@ -0,0 +1,165 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_format_compiler.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Boost Libraries
+#include <boost/core/null_deleter.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/log/attributes/constant.hpp>
+#include <boost/log/core.hpp>
+#include <boost/log/sinks/sync_frontend.hpp>
+#include <boost/log/sinks/text_ostream_backend.hpp>
+#include <boost/log/sources/logger.hpp>
+#include <boost/log/sources/record_ostream.hpp>
+#include <boost/log/utility/setup/formatter_parser.hpp>
+
+// Terminus Libraries
+#include <terminus/log/configure.hpp>
+#include <terminus/log/impl/boost/format_compiler.hpp>
+#include <terminus/log/logger.hpp>
+#include <terminus/log/test/stream_interceptor.hpp>
+#include <terminus/log/utility.hpp>
+
+namespace {
+
+/**
+ * Writes every record through two sinks with the same format string, one using the
+ * compiled formatter and one using Boost.Log's parsed formatter.
+*/
+class Format_Compiler : public testing::Test
+{
+    protected:
+
+        using Sink_Type = boost::log::sinks::synchronous_sink<boost::log::sinks::text_ostream_backend>;
+
+        void SetUp() override
+        {
+            tmns::log::configure();
+            boost::log::core::get()->remove_all_sinks();
+        }
+
+        void TearDown() override
+        {
+            boost::log::core::get()->remove_all_sinks();
+            tmns::log::configure();
+        }
+
+        void set_format( const std::string& pattern )
+        {
+            boost::log::core::get()->remove_all_sinks();
+            m_compiled.str( "" );
+            m_parsed.str( "" );
+            add_sink( m_compiled, tmns::log::impl::format::compile_formatter( pattern ) );
+            add_sink( m_parsed, boost::log::parse_formatter( pattern ) );
+        }
+
+        std::string compiled() const
+        {
+            return m_compiled.str();
+        }
+
+        std::string parsed() const
+        {
+            return m_parsed.str();
+        }
+
+    private:
+
+        static void add_sink( std::ostringstream&   stream,
+                              boost::log::formatter formatter )
+        {
+            auto backend = boost::make_shared<boost::log::sinks::text_ostream_backend>();
+            backend->add_stream( boost::shared_ptr<std::ostream>( &stream, boost::null_deleter() ) );
+            auto sink = boost::make_shared<Sink_Type>( backend );
+            sink->set_formatter( std::move( formatter ) );
+            boost::log::core::get()->add_sink( sink );
+        }
+
+        std::ostringstream m_compiled;
+
+        std::ostringstream m_parsed;
+
+}; // End of Format_Compiler class
+
+} // End of anonymous namespace
+
+/**************************************************************************/
+/*      Compiled formats produce the same text as Boost.Log's parser      */
+/**************************************************************************/
+TEST_F( Format_Compiler, Matches_Boost )
+{
+    const std::vector<std::string> patterns {
+        R"([%TimeStamp%] %Severity(align=true,brackets=true)% %File%:%LineID% (%Scope%) %Message%)",
+        R"(%Severity% %Severity(align=true)% %Severity(brackets=true)%|%Message%)",
+        R"(%TimeStamp(format="%H:%M:%S")% %TimeStamp(format="%Y/%m/%d")% %TimeStamp(format="%d.%m %Y T%H%M%S.%f")%)",
+        R"(%TimeStamp(format="%b %d %I:%M %p")% %Message%)",
+        R"(%RecordID% %ProcessName% %ProcessID% %ThreadID% %Function% %Line% %Message%)",
+        R"(%Message%|qty=%qty%|px=%px%|side=%side%|ok=%ok%|missing=%missing%)",
+        R"(no placeholders at all)",
+        R"(%Message% 100\% done)",
+    };
+
+    tmns::log::Logger logger{ "compiler" };
+    for( const auto& pattern : patterns )
+    {
+        set_format( pattern );
+        logger.warn( "order filled", tmns::log::kv( "qty", 5 ), tmns::log::kv( "px", 101.25 ),
+                     tmns::log::kv( "side", "buy" ), tmns::log::kv( "ok", true ) );
+        logger.fatal( "second record" );
+        tmns::log::trace( "global record" );
+
+        EXPECT_FALSE( compiled().empty() ) << pattern;
+        EXPECT_EQ( compiled(), parsed() ) << pattern;
+    }
+}
+
+/**************************************************************************/
+/*      Attributes holding an unexpected type fall back to Boost.Log      */
+/**************************************************************************/
+TEST_F( Format_Compiler, Unexpected_Types )
+{
+    set_format( R"(%Scope%|%Line%|%TimeStamp%|%Message%)" );
+
+    boost::log::sources::logger logger;
+    logger.add_attribute( "Scope", boost::log::attributes::constant<int>( 42 ) );
+    logger.add_attribute( "Line", boost::log::attributes::constant<std::string>( "not a number" ) );
+    logger.add_attribute( "TimeStamp", boost::log::attributes::constant<boost::posix_time::ptime>(
+                                           boost::posix_time::ptime( boost::posix_time::not_a_date_time ) ) );
+    BOOST_LOG( logger ) << "odd attributes";
+
+    EXPECT_EQ( compiled(), parsed() );
+    EXPECT_NE( compiled().find( "42|not a number|" ), std::string::npos ) << compiled();
+}
+
+/***********************************************************/
+/*      The Format setting of the text sinks is compiled   */
+/***********************************************************/
+TEST_F( Format_Compiler, Console_Setting )
+{
+    tmns::log::test::Stream_Interceptor interceptor{ std::clog };
+    std::istringstream config{ "[Sinks.Console]\nDestination=Console\n"
+                               "Format=\"%Severity(brackets=true)% %Scope%: %Message% (%qty%)\"\n" };
+    ASSERT_TRUE( tmns::log::configure( config ) );
+
+    tmns::log::Logger{ "console" }.error( "disk full", tmns::log::kv( "qty", 3 ) );
+    tmns::log::flush();
+
+    EXPECT_EQ( interceptor.get_intercepted_contents(), "[error] console: disk full (3)" );
+}
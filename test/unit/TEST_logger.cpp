@@ -24,6 +24,24 @@
 // Test Libraries
 #include "console_fixture.hpp"
 
+// Boost Libraries
+#include <boost/log/core.hpp>
+#include <boost/log/expressions.hpp>
+#include <boost/log/trivial.hpp>
+
+// C++ Libraries
+#include <sstream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Downstream code forward declares the public loggers
+namespace tmns::log {
+class Logger;
+class Shared_Logger;
+} // End of tmns::log namespace
+
 using log_Logger = Console_Fixture;
 
 /************************************/
@@ -263,3 +281,83 @@ TEST_F( log_Logger, Log_Location_Fatal )
     expect_captured( "TEST_logger.cpp" );
 }
 
+
+/****************************************************/
+/*      Share one logger across many threads        */
+/****************************************************/
+TEST( log_Shared_Logger, Many_Threads )
+{
+    std::ostringstream output;
+    boost::log::core::get()->remove_all_sinks();
+    boost::log::core::get()->set_filter( boost::log::trivial::severity >= boost::log::trivial::info );
+    tmns::log::impl::sinks::add_console_sink( output, "%Severity% %Scope% %Message%", "Shared" );
+
+    const int THREAD_COUNT = 8;
+    const int RECORD_COUNT = 500;
+    tmns::log::Shared_Logger logger{ "shared" };
+    tmns::log::Shared_Logger child = logger.with( tmns::log::kv( "tenant", 7 ) );
+
+    std::vector<std::thread> threads;
+    for( int t = 0; t < THREAD_COUNT; ++t )
+    {
+        threads.emplace_back( [&logger, t]()
+        {
+            for( int i = 0; i < RECORD_COUNT; ++i )
+            {
+                logger.info( "thread ", t, " record ", i );
+                logger.debug( "filtered" );
+            }
+        });
+    }
+    for( auto& thread : threads )
+    {
+        thread.join();
+    }
+    child.warn( "child" );
+    tmns::log::flush();
+
+    std::istringstream lines{ output.str() };
+    std::string line;
+    int count = 0;
+    while( std::getline( lines, line ) )
+    {
+        if( line.starts_with( "info shared thread " ) )
+        {
+            ++count;
+        }
+    }
+    EXPECT_EQ( count, THREAD_COUNT * RECORD_COUNT );
+    EXPECT_THAT( output.str(), testing::HasSubstr( "warning shared child\n" ) );
+    EXPECT_THAT( output.str(), testing::Not( testing::HasSubstr( "filtered" ) ) );
+
+    boost::log::core::get()->remove_all_sinks();
+    boost::log::core::get()->reset_filter();
+    tmns::log::configure();
+}
+
+/**************************************************/
+/*      Scopes known at compile time              */
+/**************************************************/
+TEST( log_Static_Logger, Scope_From_Template )
+{
+    static_assert( std::is_empty_v<tmns::log::Static_Logger<"net.http">> );
+
+    std::ostringstream output;
+    boost::log::core::get()->remove_all_sinks();
+    tmns::log::impl::sinks::add_console_sink( output, "%Severity% %Scope% %Message% %status%", "Static" );
+
+    tmns::log::Static_Logger<"net.http"> logger;
+    logger.trace( "trace" );
+    logger.info( "request ", 1, tmns::log::kv( "status", 200 ) );
+    tmns::log::Static_Logger<"net.http">{}.error( "from a temporary" );
+    tmns::log::Logger{ "net.http" }.warn( "from a logger" );
+    tmns::log::flush();
+
+    EXPECT_EQ( output.str(), "trace net.http trace \n"
+                             "info net.http request 1 200\n"
+                             "error net.http from a temporary \n"
+                             "warning net.http from a logger \n" );
+
+    boost::log::core::get()->remove_all_sinks();
+    tmns::log::configure();
+}
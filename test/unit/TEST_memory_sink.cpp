@@ -0,0 +1,183 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_memory_sink.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <chrono>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Boost Libraries
+#include <boost/log/core.hpp>
+#include <boost/log/trivial.hpp>
+
+// Terminus Libraries
+#include <terminus/log/configure.hpp>
+#include <terminus/log/field.hpp>
+#include <terminus/log/logger.hpp>
+#include <terminus/log/stats.hpp>
+#include <terminus/log/test/memory_sink.hpp>
+#include <terminus/log/utility.hpp>
+
+// Project Libraries
+#include "config_fixture.hpp"
+
+namespace {
+
+using tmns::log::test::Captured_Record;
+
+/**
+ * Starts each test without any sinks or core filter.
+*/
+class Memory_Sink : public Config_Fixture
+{
+    protected:
+
+        void SetUp() override
+        {
+            Config_Fixture::SetUp();
+            tmns::log::configure();
+            boost::log::core::get()->remove_all_sinks();
+            boost::log::core::get()->reset_filter();
+        }
+
+}; // End of Memory_Sink class
+
+} // End of anonymous namespace
+
+/****************************************************************/
+/*      Records are captured with their attributes and fields    */
+/****************************************************************/
+TEST_F( Memory_Sink, Captures_Attributes )
+{
+    auto capture = tmns::log::test::add_memory_sink( "Capture", 16 );
+    tmns::log::Logger logger{ "app.db" };
+    logger.warn( "disk almost full", tmns::log::kv( "free_mb", 12 ), tmns::log::kv( "volume", "/var" ) );
+    logger.info( "checkpoint" );
+
+    ASSERT_EQ( capture->size(), 2u );
+    const auto records = capture->records();
+    const auto& record = records.front();
+    EXPECT_EQ( record.severity, boost::log::trivial::warning );
+    EXPECT_EQ( record.scope, "app.db" );
+    EXPECT_EQ( record.message, "disk almost full" );
+    EXPECT_TRUE( record.record_id );
+    EXPECT_TRUE( record.time_stamp );
+    EXPECT_TRUE( record.thread_id );
+    EXPECT_EQ( record.field_as<int64_t>( "free_mb" ), 12 );
+    EXPECT_EQ( record.field_as<std::string>( "volume" ), "/var" );
+    EXPECT_FALSE( record.field_as<double>( "free_mb" ) );
+    EXPECT_EQ( record.field( "missing" ), nullptr );
+    EXPECT_TRUE( records.back().fields.empty() );
+    EXPECT_GT( *records.back().record_id, *record.record_id );
+
+    EXPECT_EQ( capture->count( []( const Captured_Record& rec ){ return rec.severity == boost::log::trivial::info; } ), 1u );
+    EXPECT_EQ( capture->find( []( const Captured_Record& rec ){ return rec.message == "checkpoint"; } ).size(), 1u );
+
+    for( const auto& sink : tmns::log::stats().sinks )
+    {
+        if( sink.name == "Capture" )
+        {
+            EXPECT_EQ( sink.records_emitted, 2u );
+        }
+    }
+
+    capture->clear();
+    EXPECT_EQ( capture->size(), 0u );
+    EXPECT_EQ( capture->total(), 0u );
+    EXPECT_TRUE( capture->records().empty() );
+}
+
+/**********************************************************************/
+/*      A configured sink is found by name and keeps the newest records */
+/**********************************************************************/
+TEST_F( Memory_Sink, Configured_Sink )
+{
+    ASSERT_TRUE( configure( "[Sinks.Capture]\nDestination=Memory\nCapacity=4\n"
+                            "Filter=\"%Severity% >= warning\"\n" ) );
+    auto capture = tmns::log::test::memory_sink( "Capture" );
+    ASSERT_TRUE( capture );
+    EXPECT_EQ( capture->capacity(), 4u );
+    EXPECT_FALSE( tmns::log::test::memory_sink( "Other" ) );
+
+    tmns::log::Logger logger{ "app" };
+    for( int i = 0; i < 6; ++i )
+    {
+        logger.error( "failure ", i );
+        logger.info( "ignored ", i );
+    }
+    EXPECT_EQ( capture->size(), 4u );
+    EXPECT_EQ( capture->total(), 6u );
+    const auto records = capture->records();
+    EXPECT_EQ( records.front().message, "failure 2" );
+    EXPECT_EQ( records.back().message, "failure 5" );
+
+    // The buffer is released with its sink
+    boost::log::core::get()->remove_all_sinks();
+    capture.reset();
+    EXPECT_FALSE( tmns::log::test::memory_sink( "Capture" ) );
+
+    EXPECT_FALSE( configure( "[Sinks.Capture]\nDestination=Memory\nFormat=\"%Message%\"\n" ) );
+    EXPECT_FALSE( configure( "[Sinks.Capture]\nDestination=Memory\nCapacity=0\n" ) );
+}
+
+/*************************************************************/
+/*      Threads log and query the buffer at the same time     */
+/*************************************************************/
+TEST_F( Memory_Sink, Concurrent_Capture )
+{
+    constexpr int THREADS = 8;
+    constexpr int RECORDS = 1000;
+    auto capture = tmns::log::test::add_memory_sink( "Capture", THREADS * RECORDS );
+
+    std::vector<std::thread> threads;
+    for( int t = 0; t < THREADS; ++t )
+    {
+        threads.emplace_back( [t]()
+        {
+            tmns::log::Logger logger{ "worker" };
+            for( int i = 0; i < RECORDS; ++i )
+            {
+                logger.info( "record ", i, tmns::log::kv( "worker", t ) );
+            }
+        });
+    }
+    while( !capture->wait_for( THREADS * RECORDS, std::chrono::milliseconds( 1 ) ) )
+    {
+        EXPECT_LE( capture->size(), static_cast<size_t>( THREADS * RECORDS ) );
+    }
+    for( auto& thread : threads )
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ( capture->size(), static_cast<size_t>( THREADS * RECORDS ) );
+    std::map<int64_t,int> per_worker;
+    std::map<int64_t,std::string> last_message;
+    capture->for_each( [&]( const Captured_Record& record )
+    {
+        const auto worker = record.field_as<int64_t>( "worker" ).value_or( -1 );
+        ++per_worker[worker];
+        last_message[worker] = record.message;
+    });
+    ASSERT_EQ( per_worker.size(), static_cast<size_t>( THREADS ) );
+    for( const auto& [worker, count] : per_worker )
+    {
+        EXPECT_EQ( count, RECORDS );
+        EXPECT_EQ( last_message[worker], "record " + std::to_string( RECORDS - 1 ) );
+    }
+}
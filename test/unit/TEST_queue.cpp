@@ -0,0 +1,330 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_queue.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Boost Libraries
+#include <boost/log/core.hpp>
+#include <boost/log/keywords/start_thread.hpp>
+
+// Terminus Libraries
+#include <terminus/log/configure.hpp>
+#include <terminus/log/impl/boost/sinks.hpp>
+#include <terminus/log/stats.hpp>
+#include <terminus/log/utility.hpp>
+
+// Project Libraries
+#include "config_fixture.hpp"
+
+namespace {
+
+namespace sinks = tmns::log::impl::sinks;
+
+using Backend_Type = sinks::Counting_Backend<boost::log::sinks::text_ostream_backend>;
+using Sink_Type    = boost::log::sinks::asynchronous_sink<Backend_Type,sinks::Bounded_Queue>;
+
+/**
+ * Queue without a sink frontend, exposing the queueing interface to the tests.
+*/
+class Test_Queue : public sinks::Bounded_Queue
+{
+    public:
+
+        template <typename ArgsT>
+        explicit Test_Queue( const ArgsT& args ) : sinks::Bounded_Queue( args )
+        {
+        }
+
+        using sinks::Bounded_Queue::enqueue;
+        using sinks::Bounded_Queue::try_dequeue;
+
+        /**
+         * Returns the messages of the queued records, oldest first, emptying the queue.
+        */
+        std::vector<std::string> drain()
+        {
+            std::vector<std::string> messages;
+            boost::log::record_view rec;
+            while( try_dequeue( rec ) )
+            {
+                messages.push_back( boost::log::extract<std::string>( "Message", rec ).get() );
+            }
+            return messages;
+        }
+
+}; // End of Test_Queue class
+
+/**
+ * Installs a single asynchronous sink without a feeding thread, so records stay queued
+ * until the test calls `flush()`.
+*/
+class Bounded_Queue : public Config_Fixture
+{
+    protected:
+
+        void install( size_t capacity, sinks::Overflow_Policy policy, bool start_thread = false )
+        {
+            namespace kw = tmns::log::impl::keywords;
+            boost::log::core::get()->remove_all_sinks();
+            auto backend = sinks::make_stream_backend( m_output, "Queue" );
+            m_sink = boost::make_shared<Sink_Type>( backend,
+                                                    boost::log::keywords::start_thread = start_thread,
+                                                    kw::sink_counters   = backend->counters(),
+                                                    kw::queue_capacity  = capacity,
+                                                    kw::overflow_policy = policy );
+            m_sink->set_formatter( boost::log::parse_formatter( "%Message%" ) );
+            boost::log::core::get()->add_sink( m_sink );
+        }
+
+        std::string output()
+        {
+            m_sink->flush();
+            return m_output.str();
+        }
+
+        std::ostringstream m_output;
+
+        boost::shared_ptr<Sink_Type> m_sink;
+
+}; // End of Bounded_Queue class
+
+using Bounded_Queue_Settings = Config_Fixture;
+
+} // End of anonymous namespace
+
+/**************************************************/
+/*      DropNewest keeps the first records        */
+/**************************************************/
+TEST_F( Bounded_Queue, Drop_Newest )
+{
+    install( 3, sinks::Overflow_Policy::DROP_NEWEST );
+    for( int i = 1; i <= 10; ++i )
+    {
+        tmns::log::info( "record ", i );
+    }
+
+    auto stats = tmns::log::stats();
+    EXPECT_EQ( stats.records_dropped, 7 );
+    ASSERT_EQ( stats.sinks.size(), 1 );
+    EXPECT_EQ( stats.sinks[0].queue_depth, 3 );
+    EXPECT_EQ( output(), "record 1\nrecord 2\nrecord 3\n" );
+
+    // The next accepted record reports the episode
+    tmns::log::info( "record 11" );
+    EXPECT_EQ( output(), "record 1\nrecord 2\nrecord 3\n"
+                         "7 records dropped by sink \"Queue\" after its queue overflowed\n"
+                         "record 11\n" );
+}
+
+/**************************************************/
+/*      DropOldest keeps the latest records       */
+/**************************************************/
+TEST_F( Bounded_Queue, Drop_Oldest )
+{
+    install( 3, sinks::Overflow_Policy::DROP_OLDEST );
+    for( int i = 1; i <= 10; ++i )
+    {
+        tmns::log::info( "record ", i );
+    }
+    EXPECT_EQ( tmns::log::stats().records_dropped, 7 );
+    EXPECT_EQ( output(), "record 8\nrecord 9\nrecord 10\n" );
+
+    tmns::log::info( "record 11" );
+    EXPECT_EQ( output(), "record 8\nrecord 9\nrecord 10\n"
+                         "7 records dropped by sink \"Queue\" after its queue overflowed\n"
+                         "record 11\n" );
+}
+
+/**************************************************************/
+/*      Drop notices are only queued if the sink accepts them  */
+/**************************************************************/
+TEST_F( Bounded_Queue, Notice_Follows_Sink_Filter )
+{
+    install( 3, sinks::Overflow_Policy::DROP_NEWEST );
+    m_sink->set_filter( boost::log::trivial::severity != boost::log::trivial::warning );
+
+    // Another sink accepts warnings, so the core opens the notice
+    std::ostringstream other;
+    sinks::add_console_sink( other, "%Message%", "Other" );
+
+    for( int i = 1; i <= 5; ++i )
+    {
+        tmns::log::info( "record ", i );
+    }
+    output();
+    tmns::log::info( "record 6" );
+    EXPECT_EQ( output(), "record 1\nrecord 2\nrecord 3\nrecord 6\n" );
+    EXPECT_EQ( other.str().find( "records dropped" ), std::string::npos );
+
+    // The records stay counted until a notice is queued
+    m_sink->reset_filter();
+    for( int i = 7; i <= 10; ++i )
+    {
+        tmns::log::info( "record ", i );
+    }
+    output();
+    tmns::log::info( "record 11" );
+    EXPECT_TRUE( output().ends_with( "record 9\n"
+                                     "3 records dropped by sink \"Queue\" after its queue overflowed\n"
+                                     "record 11\n" ) );
+    EXPECT_EQ( other.str().find( "records dropped" ), std::string::npos );
+    EXPECT_EQ( tmns::log::stats().records_dropped, 3 );
+}
+
+/*******************************************************/
+/*      DropOldest never drops a queued drop notice    */
+/*******************************************************/
+TEST_F( Bounded_Queue, Drop_Oldest_Keeps_Notice )
+{
+    // A sink in the core lets the notice be opened
+    install( 0, sinks::Overflow_Policy::BLOCK );
+
+    namespace kw = tmns::log::impl::keywords;
+    auto counters = std::make_shared<tmns::log::impl::stats::Sink_Counters>( "Test" );
+    Test_Queue queue{ ( kw::sink_counters   = counters,
+                        kw::queue_capacity  = size_t{ 2 },
+                        kw::overflow_policy = sinks::Overflow_Policy::DROP_OLDEST ) };
+
+    auto make_record = []( const std::string& message )
+    {
+        boost::log::attribute_set attributes;
+        auto rec = boost::log::core::get()->open_record( attributes );
+        rec.attribute_values().insert( "Message", boost::log::attributes::make_attribute_value( message ) );
+        return rec.lock();
+    };
+
+    queue.enqueue( make_record( "record 1" ) );
+    queue.enqueue( make_record( "record 2" ) );
+    queue.enqueue( make_record( "record 3" ) );
+    boost::log::record_view rec;
+    ASSERT_TRUE( queue.try_dequeue( rec ) );
+
+    // The notice is queued ahead of record 4, and record 5 drops record 3 instead of it
+    queue.enqueue( make_record( "record 4" ) );
+    queue.enqueue( make_record( "record 5" ) );
+    EXPECT_EQ( queue.drain(), ( std::vector<std::string>{ "1 records dropped by sink \"Test\" after its queue overflowed",
+                                                           "record 4", "record 5" } ) );
+    EXPECT_EQ( counters->records_dropped.load(), 2u );
+}
+
+/****************************************************************/
+/*      A full blocking queue refuses try_consume without waiting */
+/****************************************************************/
+TEST_F( Bounded_Queue, Try_Consume_Never_Waits )
+{
+    install( 2, sinks::Overflow_Policy::BLOCK );
+    tmns::log::info( "record 1" );
+    tmns::log::info( "record 2" );
+
+    boost::log::attribute_set attributes;
+    auto rec = boost::log::core::get()->open_record( attributes );
+    ASSERT_TRUE( rec );
+    EXPECT_FALSE( m_sink->try_consume( rec.lock() ) );
+    EXPECT_EQ( tmns::log::stats().sinks[0].queue_depth, 2 );
+    EXPECT_EQ( output(), "record 1\nrecord 2\n" );
+}
+
+/******************************************************************/
+/*      Concurrent producers never push past the queue capacity    */
+/******************************************************************/
+TEST_F( Bounded_Queue, Concurrent_Producers_Respect_Capacity )
+{
+    constexpr size_t   CAPACITY = 2;
+    constexpr int      THREADS  = 8;
+    constexpr int      RECORDS  = 2000;
+    install( CAPACITY, sinks::Overflow_Policy::DROP_NEWEST, true );
+
+    std::vector<std::thread> threads;
+    for( int t = 0; t < THREADS; ++t )
+    {
+        threads.emplace_back( []()
+        {
+            for( int i = 0; i < RECORDS; ++i )
+            {
+                tmns::log::info( "record" );
+            }
+        });
+    }
+    for( auto& thread : threads )
+    {
+        thread.join();
+    }
+    m_sink->flush();
+    m_sink->stop();
+
+    // Drop notices are the only records allowed beyond the capacity
+    const auto text = m_output.str();
+    uint64_t notices = 0;
+    for( auto pos = text.find( "records dropped" ); pos != std::string::npos; pos = text.find( "records dropped", pos + 1 ) )
+    {
+        ++notices;
+    }
+    auto stats = tmns::log::stats();
+    ASSERT_EQ( stats.sinks.size(), 1 );
+    EXPECT_LE( stats.sinks[0].queue_high_water, CAPACITY + notices );
+    EXPECT_EQ( stats.sinks[0].records_emitted - notices + stats.sinks[0].records_dropped,
+               static_cast<uint64_t>( THREADS * RECORDS ) );
+}
+
+/*************************************************/
+/*      Unbounded queues never drop records      */
+/*************************************************/
+TEST_F( Bounded_Queue, Unbounded )
+{
+    install( 0, sinks::Overflow_Policy::DROP_NEWEST );
+    for( int i = 0; i < 1000; ++i )
+    {
+        tmns::log::info( "record ", i );
+    }
+    auto stats = tmns::log::stats();
+    EXPECT_EQ( stats.records_dropped, 0 );
+    EXPECT_EQ( stats.sinks[0].queue_high_water, 1000 );
+}
+
+/****************************************************/
+/*      Block waits for the feeding thread          */
+/****************************************************/
+TEST_F( Bounded_Queue_Settings, Block )
+{
+    ASSERT_TRUE( configure( "[Sinks.Blocking]\nDestination=TextFile\nAsynchronous=true\n"
+                            "QueueCapacity=4\nOverflowPolicy=Block\n"
+                            "FileName=\"" + ( directory() / "block.log" ).string() + "\"\n" ) );
+
+    for( int i = 0; i < 500; ++i )
+    {
+        tmns::log::info( "record ", i );
+    }
+    tmns::log::flush();
+
+    auto stats = tmns::log::stats();
+    ASSERT_EQ( stats.sinks.size(), 1 );
+    EXPECT_EQ( stats.sinks[0].records_emitted, 500 );
+    EXPECT_EQ( stats.sinks[0].records_dropped, 0 );
+    EXPECT_LE( stats.sinks[0].queue_high_water, 4 );
+}
+
+/***********************************************/
+/*      Unknown overflow policies are errors   */
+/***********************************************/
+TEST_F( Bounded_Queue_Settings, Invalid_Policy )
+{
+    EXPECT_FALSE( configure( "[Sinks.Bad]\nDestination=Console\nAsynchronous=true\n"
+                             "QueueCapacity=4\nOverflowPolicy=Sometimes\n" ) );
+}
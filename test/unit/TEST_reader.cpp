@@ -0,0 +1,214 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_reader.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Boost Libraries
+#include <boost/log/core.hpp>
+
+// Terminus Libraries
+#include <terminus/log/configure.hpp>
+#include <terminus/log/reader.hpp>
+#include <terminus/log/utility.hpp>
+
+// Project Libraries
+#include "config_fixture.hpp"
+
+namespace {
+
+namespace rd = tmns::log::reader;
+
+class Reader : public Config_Fixture
+{
+    protected:
+
+        /**
+         * Writes `count` records through a "JsonFile" sink and returns the file name.
+        */
+        std::string write_json_records( int count ) const
+        {
+            const auto file = ( directory() / "records.log" ).string();
+            EXPECT_TRUE( configure( "[Sinks.Json]\nDestination=JsonFile\nFileName=\"" + file + "\"\n" ) );
+            for( int i = 0; i < count; ++i )
+            {
+                tmns::log::info( "record \"", i, "\"" );
+            }
+            boost::log::core::get()->remove_all_sinks();
+            return file;
+        }
+
+}; // End of Reader class
+
+} // End of anonymous namespace
+
+/******************************************************/
+/*      The vector newline search matches memchr       */
+/******************************************************/
+TEST_F( Reader, Find_Newline )
+{
+    for( size_t size = 0; size < 100; ++size )
+    {
+        for( size_t newline = 0; newline <= size; ++newline )
+        {
+            std::string text( size, 'x' );
+            if( newline < size )
+            {
+                text[newline] = '\n';
+            }
+            const char* found = rd::find_newline( text.data(), text.data() + text.size() );
+            EXPECT_EQ( static_cast<size_t>( found - text.data() ), newline ) << size;
+        }
+    }
+}
+
+/***********************************************************/
+/*      Fields are found among nested and escaped members   */
+/***********************************************************/
+TEST_F( Reader, Record_Fields )
+{
+    rd::Record_View record{ R"({"RecordID":42,"Fields":{"Message":"inner","list":[1,{"x":"]"}]},)"
+                            R"("Message":"say \"hi\"\\","Severity":"warn","TimeStamp":"1970-01-01T00:00:01.25"})", 0 };
+    EXPECT_EQ( record.record_id(), 42u );
+    EXPECT_EQ( record.message(), R"(say \"hi\"\\)" );
+    EXPECT_EQ( rd::unescape( *record.message() ), R"(say "hi"\)" );
+    EXPECT_EQ( record.severity(), "warn" );
+    EXPECT_EQ( record.time_stamp(), 1250000 );
+    EXPECT_EQ( record.field( "Fields" ), R"({"Message":"inner","list":[1,{"x":"]"}]})" );
+    EXPECT_FALSE( record.field( "x" ) );
+    EXPECT_FALSE( record.scope() );
+
+    rd::Record_View text{ "[info] not json", 0 };
+    EXPECT_FALSE( text.is_json() );
+    EXPECT_FALSE( text.message() );
+
+    EXPECT_EQ( rd::unescape( R"(caf\u00e9 \ud83d\ude00\n)" ), "caf\xc3\xa9 \xf0\x9f\x98\x80\n" );
+}
+
+/********************************************************/
+/*      Records of a JSON file point into the mapping    */
+/********************************************************/
+TEST_F( Reader, Json_File_Records )
+{
+    rd::Log_File file{ write_json_records( 100 ) };
+
+    uint64_t previous = 0;
+    int index = 0;
+    for( const auto& record : file.records() )
+    {
+        EXPECT_GE( record.line().data(), file.data().data() );
+        EXPECT_LT( record.line().data(), file.data().data() + file.data().size() );
+        EXPECT_EQ( record.line().data(), file.data().data() + record.offset() );
+        EXPECT_GT( record.record_id().value_or( 0 ), previous );
+        previous = record.record_id().value_or( 0 );
+        EXPECT_EQ( rd::unescape( record.message().value_or( "" ) ), "record \"" + std::to_string( index++ ) + "\"" );
+    }
+    EXPECT_EQ( index, 100 );
+
+    // A byte range starting at a record
+    auto records = file.records();
+    auto third = std::next( records.begin(), 2 );
+    auto count = std::distance( file.records( third->offset(), file.data().size() ).begin(), records.end() );
+    EXPECT_EQ( count, 98 );
+}
+
+/*************************************************************/
+/*      Chunks split at line boundaries and cover the file    */
+/*************************************************************/
+TEST_F( Reader, Chunks )
+{
+    std::string contents;
+    for( int i = 0; i < 1000; ++i )
+    {
+        contents += "line " + std::to_string( i ) + std::string( static_cast<size_t>( i % 17 ), '.' ) + "\n";
+    }
+    contents += "last line without newline";
+    rd::Log_File file{ write_file( "chunks.log", contents ) };
+
+    auto chunks = file.chunks( 256 );
+    ASSERT_GT( chunks.size(), 10u );
+    EXPECT_EQ( chunks.front().first, 0u );
+    EXPECT_EQ( chunks.back().second, contents.size() );
+    for( size_t i = 0; i + 1 < chunks.size(); ++i )
+    {
+        EXPECT_EQ( chunks[i].second, chunks[i + 1].first );
+        EXPECT_EQ( contents[chunks[i].second - 1], '\n' );
+    }
+
+    rd::Log_File empty{ write_file( "empty.log", "" ) };
+    EXPECT_TRUE( empty.chunks( 256 ).empty() );
+    EXPECT_EQ( empty.records().begin(), empty.records().end() );
+}
+
+/******************************************************************/
+/*      Parallel scans see every record once, across all files     */
+/******************************************************************/
+TEST_F( Reader, Parallel_Scan )
+{
+    std::vector<std::string> files;
+    std::string expected;
+    for( int f = 0; f < 3; ++f )
+    {
+        std::string contents;
+        for( int i = 0; i < 2000; ++i )
+        {
+            contents += std::to_string( f ) + ":" + std::to_string( i ) + "\n";
+        }
+        expected += contents;
+        files.push_back( write_file( "scan_" + std::to_string( f ) + ".log", contents ) );
+    }
+
+    std::atomic<uint64_t> bytes{ 0 };
+    rd::Scan_Options options;
+    options.threads    = 4;
+    options.chunk_size = 1024;
+    EXPECT_EQ( rd::scan( files, [&bytes]( const rd::Record_View& record )
+    {
+        bytes.fetch_add( record.line().size() + 1 );
+    }, options ), 6000u );
+    EXPECT_EQ( bytes.load(), expected.size() );
+
+    // Chunk sequence numbers restore the file order
+    std::mutex mutex;
+    std::map<size_t,std::string> pieces;
+    rd::for_each_chunk( files, [&]( const rd::Chunk& chunk )
+    {
+        std::string piece;
+        for( const auto& record : chunk.records() )
+        {
+            piece.append( record.line() ).push_back( '\n' );
+        }
+        std::lock_guard<std::mutex> lock{ mutex };
+        pieces[chunk.sequence] = std::move( piece );
+    }, options );
+    std::string ordered;
+    for( const auto& [sequence, piece] : pieces )
+    {
+        ordered += piece;
+    }
+    EXPECT_EQ( ordered, expected );
+
+    // Errors stop the scan and reach the caller
+    EXPECT_THROW( rd::scan( files, []( const rd::Record_View& ){ throw std::runtime_error( "stop" ); }, options ),
+                  std::runtime_error );
+    EXPECT_THROW( rd::Log_File{ ( directory() / "missing.log" ).string() }, std::runtime_error );
+}
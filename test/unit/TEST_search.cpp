@@ -0,0 +1,201 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_search.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <filesystem>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Terminus Libraries
+#include <terminus/log/impl/search.hpp>
+
+// Project Libraries
+#include "config_fixture.hpp"
+
+namespace {
+
+namespace sr = tmns::log::impl::search;
+
+class Search : public Config_Fixture
+{
+    protected:
+
+        /**
+         * Returns a JSON record like those `format::json` writes.
+        */
+        static std::string json_record( int                id,
+                                        const std::string& scope,
+                                        const std::string& severity,
+                                        const std::string& message )
+        {
+            return "{\"RecordID\":" + std::to_string( id ) + ",\"Scope\":\"" + scope + "\",\"Severity\":\"" + severity +
+                   "\",\"TimeStamp\":\"2026-10-19T10:00:" + std::to_string( 10 + id % 50 ) +
+                   "\",\"Message\":\"" + message + "\"}\n";
+        }
+
+        static std::string search( const std::vector<std::string>& files,
+                                   const sr::Query&                query,
+                                   sr::Search_Options              options = {} )
+        {
+            options.scan.threads    = 4;
+            options.scan.chunk_size = 512;
+            std::ostringstream output;
+            sr::search_files( files, sr::Matcher{ query }, output, options );
+            return output.str();
+        }
+
+}; // End of Search class
+
+} // End of anonymous namespace
+
+/*******************************************************/
+/*      The vector literal search matches std::find     */
+/*******************************************************/
+TEST_F( Search, Find_Literal )
+{
+    for( size_t size = 0; size < 90; ++size )
+    {
+        for( const std::string needle : { "a", "ab", "abc", "abcdefghijklmnopqrstuvwxyz0123456789" } )
+        {
+            for( size_t at = 0; at <= size; ++at )
+            {
+                std::string text( size, 'a' );
+                for( size_t i = 0; i < size; i += 3 )
+                {
+                    text[i] = 'b';
+                }
+                text.replace( at, std::min( needle.size(), size - at ), needle.substr( 0, size - at ) );
+                const auto expected = std::min( text.find( needle ), text.size() );
+                const char* found = sr::find_literal( text.data(), text.data() + text.size(), needle );
+                EXPECT_EQ( static_cast<size_t>( found - text.data() ), expected ) << size << " " << needle;
+            }
+        }
+    }
+}
+
+/****************************************************************/
+/*      Only text every match must contain becomes a prefilter   */
+/****************************************************************/
+TEST_F( Search, Required_Literal )
+{
+    EXPECT_EQ( sr::required_literal( "timeout after [0-9]+ms" ), "timeout after " );
+    EXPECT_EQ( sr::required_literal( "ab*cdef" ), "cdef" );
+    EXPECT_EQ( sr::required_literal( "colou?r mismatch" ), "r mismatch" );
+    EXPECT_EQ( sr::required_literal( "x{2}yz\\.conf" ), "yz.conf" );
+    EXPECT_EQ( sr::required_literal( "(disk|net) error" ), " error" );
+    EXPECT_EQ( sr::required_literal( "disk|net" ), "" );
+    EXPECT_EQ( sr::required_literal( "\\d+\\s" ), "" );
+
+    EXPECT_EQ( sr::severity_rank( "trace" ), 0 );
+    EXPECT_EQ( sr::severity_rank( "warn" ), 3 );
+    EXPECT_EQ( sr::severity_rank( "fatal" ), 5 );
+    EXPECT_FALSE( sr::severity_rank( "loud" ) );
+}
+
+/*****************************************************************/
+/*      JSON predicates match records, not text that looks alike  */
+/*****************************************************************/
+TEST_F( Search, Predicates )
+{
+    std::string contents;
+    contents += json_record( 1, "app", "info", "started" );
+    contents += json_record( 2, "app.db", "error", "query failed" );
+    contents += json_record( 3, "application", "error", "config failed" );
+    contents += json_record( 4, "net", "warning", "slow \\\"Scope\\\":\\\"app\\\"" );
+    contents += json_record( 5, "app", "fatal", "disk failed" );
+    contents += "[error] plain text failed\n";
+    const auto file = write_file( "predicates.log", contents );
+
+    sr::Query scope;
+    scope.scope = "app";
+    EXPECT_EQ( search( { file }, scope ),
+               json_record( 1, "app", "info", "started" ) +
+               json_record( 2, "app.db", "error", "query failed" ) +
+               json_record( 5, "app", "fatal", "disk failed" ) );
+
+    sr::Query severity;
+    severity.min_severity = 4;
+    severity.literals     = { "failed" };
+    EXPECT_EQ( search( { file }, severity ),
+               json_record( 2, "app.db", "error", "query failed" ) +
+               json_record( 3, "application", "error", "config failed" ) +
+               json_record( 5, "app", "fatal", "disk failed" ) );
+
+    sr::Query time;
+    time.from_time = *tmns::log::impl::reader::parse_time_stamp( "2026-10-19T10:00:12" );
+    time.to_time   = *tmns::log::impl::reader::parse_time_stamp( "2026-10-19T10:00:14" );
+    EXPECT_EQ( search( { file }, time ),
+               json_record( 2, "app.db", "error", "query failed" ) +
+               json_record( 3, "application", "error", "config failed" ) +
+               json_record( 4, "net", "warning", "slow \\\"Scope\\\":\\\"app\\\"" ) );
+
+    sr::Query regex;
+    regex.regex = "(query|disk) failed$";
+    EXPECT_EQ( search( { file }, regex ), "" );
+    regex.regex = "(query|plain text) failed";
+    EXPECT_EQ( search( { file }, regex ),
+               json_record( 2, "app.db", "error", "query failed" ) + "[error] plain text failed\n" );
+
+    sr::Query invalid;
+    invalid.regex = "(unclosed";
+    EXPECT_THROW( sr::Matcher{ invalid }, std::regex_error );
+}
+
+/**************************************************************/
+/*      Parallel searches keep file order and use the index    */
+/**************************************************************/
+TEST_F( Search, Ordered_Files )
+{
+    std::vector<std::string> files;
+    std::string expected;
+    std::string expected_count;
+    for( int f = 0; f < 3; ++f )
+    {
+        std::string contents;
+        int count = 0;
+        for( int i = 0; i < 3000; ++i )
+        {
+            const auto line = json_record( i, "app", i % 7 == 0 ? "error" : "info", "file " + std::to_string( f ) );
+            contents += line;
+            if( i % 7 == 0 )
+            {
+                ++count;
+                expected += ( directory() / ( "ordered_" + std::to_string( f ) + ".log" ) ).string() + ":" + line;
+            }
+        }
+        files.push_back( write_file( "ordered_" + std::to_string( f ) + ".log", contents ) );
+        expected_count += files.back() + ":" + std::to_string( count ) + "\n";
+    }
+
+    sr::Query query;
+    query.min_severity = 4;
+    sr::Search_Options options;
+    options.with_file_name = true;
+    EXPECT_EQ( search( files, query, options ), expected );
+
+    options.count_only = true;
+    EXPECT_EQ( search( files, query, options ), expected_count );
+
+    // An index that puts the whole window past the end of the file skips the file
+    sr::Query window;
+    window.from_time = *tmns::log::impl::reader::parse_time_stamp( "2026-10-19T10:00:10" );
+    EXPECT_EQ( search( files, window, { {}, true, false } ), "9000\n" );
+    const auto size = std::filesystem::file_size( files[0] );
+    tmns::log::impl::index::write_index( tmns::log::impl::index::index_file_name( files[0] ), size,
+                                         { { 0, 0, 1, 0, 1 } } );
+    EXPECT_EQ( search( files, window, { {}, true, false } ), "6000\n" );
+}
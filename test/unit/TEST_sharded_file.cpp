@@ -0,0 +1,192 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_sharded_file.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Boost Libraries
+#include <boost/json.hpp>
+
+// Terminus Libraries
+#include <terminus/log/configure.hpp>
+#include <terminus/log/impl/merge.hpp>
+#include <terminus/log/stats.hpp>
+#include <terminus/log/utility.hpp>
+
+// Project Libraries
+#include "config_fixture.hpp"
+
+namespace {
+
+using tmns::log::impl::merge::Merge_Key;
+
+class Sharded_File : public Config_Fixture
+{
+    protected:
+
+        /**
+         * Logs `records` records from each of `threads` threads.
+        */
+        static void log_from_threads( int threads,
+                                      int records )
+        {
+            std::vector<std::thread> workers;
+            for( int t = 0; t < threads; ++t )
+            {
+                workers.emplace_back( [t, records]()
+                {
+                    for( int i = 0; i < records; ++i )
+                    {
+                        tmns::log::info( "thread ", t, " record ", i );
+                    }
+                });
+            }
+            for( auto& worker : workers )
+            {
+                worker.join();
+            }
+        }
+
+        std::vector<std::string> shard_files() const
+        {
+            std::vector<std::string> files;
+            for( int shard = 0; std::filesystem::exists( directory() / ( "shard_" + std::to_string( shard ) + ".log" ) ); ++shard )
+            {
+                files.push_back( ( directory() / ( "shard_" + std::to_string( shard ) + ".log" ) ).string() );
+            }
+            return files;
+        }
+
+        static std::vector<std::string> read_lines( std::istream& input )
+        {
+            std::vector<std::string> lines;
+            std::string line;
+            while( std::getline( input, line ) )
+            {
+                lines.push_back( line );
+            }
+            return lines;
+        }
+
+}; // End of Sharded_File class
+
+} // End of anonymous namespace
+
+/*****************************************************************/
+/*      Each thread writes its own shard, merged by RecordID      */
+/*****************************************************************/
+TEST_F( Sharded_File, Json_Shards_Merge_By_Record_ID )
+{
+    ASSERT_TRUE( configure( "[Sinks.Shards]\nDestination=JsonFile\nBufferSize=1024\n"
+                            "FileName=\"" + ( directory() / "shard_%T.log" ).string() + "\"\n" ) );
+    log_from_threads( 4, 500 );
+
+    // Threads that exited closed their shards
+    auto files = shard_files();
+    ASSERT_EQ( files.size(), 4u );
+    for( const auto& file : files )
+    {
+        std::ifstream input{ file };
+        auto lines = read_lines( input );
+        ASSERT_EQ( lines.size(), 500u );
+
+        // A shard holds the records of one thread
+        auto first = boost::json::parse( lines.front() ).as_object();
+        auto thread = boost::json::serialize( first["ThreadID"] );
+        for( const auto& line : lines )
+        {
+            EXPECT_EQ( boost::json::serialize( boost::json::parse( line ).as_object()["ThreadID"] ), thread );
+        }
+    }
+
+    std::stringstream merged;
+    EXPECT_EQ( tmns::log::impl::merge::merge_files( files, merged, Merge_Key::RECORD_ID ), 2000u );
+    uint64_t previous = 0;
+    for( const auto& line : read_lines( merged ) )
+    {
+        auto id = boost::json::parse( line ).as_object()["RecordID"].to_number<uint64_t>();
+        EXPECT_GT( id, previous );
+        previous = id;
+    }
+
+    for( const auto& sink : tmns::log::stats().sinks )
+    {
+        if( sink.name == "Shards" )
+        {
+            EXPECT_EQ( sink.records_emitted, 2000u );
+        }
+    }
+}
+
+/***************************************************************/
+/*      Buffered records are written on flush and merge by line  */
+/***************************************************************/
+TEST_F( Sharded_File, Text_Shards_Flush_And_Merge_By_Line )
+{
+    ASSERT_TRUE( configure( "[Sinks.Shards]\nDestination=TextFile\nFormat=\"%RecordID% %Message%\"\n"
+                            "FileName=\"" + ( directory() / "shard_%T.log" ).string() + "\"\n" ) );
+
+    // The main thread's shard stays open and buffered until flushed
+    tmns::log::info( "main" );
+    auto main_shard = directory() / "shard_0.log";
+    ASSERT_TRUE( std::filesystem::exists( main_shard ) );
+    EXPECT_EQ( std::filesystem::file_size( main_shard ), 0u );
+    tmns::log::flush();
+    EXPECT_GT( std::filesystem::file_size( main_shard ), 0u );
+
+    std::istringstream first{ "1 a\n4 d\n5 e\n" };
+    std::istringstream second{ "2 b\n3 c\n6 f\n" };
+    std::stringstream merged;
+    EXPECT_EQ( tmns::log::impl::merge::merge_streams( { &first, &second }, merged, Merge_Key::LINE ), 6u );
+    EXPECT_EQ( merged.str(), "1 a\n2 b\n3 c\n4 d\n5 e\n6 f\n" );
+}
+
+/***********************************************************/
+/*      Merging by time stamp keeps lines without one near  */
+/***********************************************************/
+TEST_F( Sharded_File, Merge_By_Time_Stamp )
+{
+    std::istringstream first{ R"({"TimeStamp":"2026-10-19T10:00:01","Message":"a"})" "\n"
+                              R"({"Message":"no time"})" "\n"
+                              R"({"TimeStamp":"2026-10-19T10:00:04","Message":"d"})" "\n" };
+    std::istringstream second{ R"({"TimeStamp":"2026-10-19T10:00:02","Message":"b"})" "\n"
+                               R"({"TimeStamp":"2026-10-19T10:00:03","Message":"c"})" "\n" };
+    std::stringstream merged;
+    tmns::log::impl::merge::merge_streams( { &first, &second }, merged, Merge_Key::TIME_STAMP );
+
+    std::vector<std::string> messages;
+    for( const auto& line : read_lines( merged ) )
+    {
+        messages.emplace_back( boost::json::parse( line ).as_object()["Message"].as_string().c_str() );
+    }
+    EXPECT_EQ( messages, ( std::vector<std::string>{ "a", "no time", "b", "c", "d" } ) );
+}
+
+/*****************************************************/
+/*      Settings a shard cannot honor are rejected    */
+/*****************************************************/
+TEST_F( Sharded_File, Invalid_Settings )
+{
+    const auto file = ( directory() / "shard_%T.log" ).string();
+    EXPECT_FALSE( configure( "[Sinks.Shards]\nDestination=TextFile\nFileName=\"" + file + "\"\nRotationSize=100\n" ) );
+    EXPECT_FALSE( configure( "[Sinks.Shards]\nDestination=JsonFile\nFileName=\"" + file + "\"\nAsynchronous=true\n" ) );
+    EXPECT_THROW( tmns::log::impl::merge::parse_merge_key( "Severity" ), std::runtime_error );
+}
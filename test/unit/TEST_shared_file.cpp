@@ -0,0 +1,212 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_shared_file.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// POSIX
+#include <sys/wait.h>
+#include <unistd.h>
+
+// Boost Libraries
+#include <boost/log/core.hpp>
+
+// Terminus Libraries
+#include <terminus/log/configure.hpp>
+#include <terminus/log/stats.hpp>
+#include <terminus/log/utility.hpp>
+
+// Project Libraries
+#include "config_fixture.hpp"
+
+namespace {
+
+class Shared_File : public Config_Fixture
+{
+    protected:
+
+        /**
+         * Runs `count` processes that each log `records` records of varying length through
+         * the sink settings, tagged with the process number and record index.
+        */
+        static void run_processes( const std::string& settings,
+                                   int                count,
+                                   int                records )
+        {
+            std::vector<pid_t> children;
+            for( int process = 0; process < count; ++process )
+            {
+                pid_t pid = ::fork();
+                ASSERT_GE( pid, 0 );
+                if( pid == 0 )
+                {
+                    if( !configure( settings ) )
+                    {
+                        ::_exit( 1 );
+                    }
+                    for( int i = 0; i < records; ++i )
+                    {
+                        tmns::log::info( std::to_string( process ) + ":" + std::to_string( i ) + ":" +
+                                         std::string( static_cast<size_t>( 20 + ( i * 37 ) % 300 ), static_cast<char>( 'a' + process ) ) );
+                    }
+                    tmns::log::flush();
+                    boost::log::core::get()->remove_all_sinks();
+                    ::_exit( 0 );
+                }
+                children.push_back( pid );
+            }
+            for( auto pid : children )
+            {
+                int status = 0;
+                ::waitpid( pid, &status, 0 );
+                EXPECT_TRUE( WIFEXITED( status ) && WEXITSTATUS( status ) == 0 );
+            }
+        }
+
+        /**
+         * Checks that every line in the files is a whole record and that each process's
+         * records appear in order.  Returns the number of records found.
+        */
+        static size_t check_records( const std::vector<std::filesystem::path>& files )
+        {
+            size_t count = 0;
+            std::map<int,int> last;
+            for( const auto& file : files )
+            {
+                std::ifstream input{ file };
+                std::string line;
+                while( std::getline( input, line ) )
+                {
+                    auto first  = line.find( ':' );
+                    auto second = line.find( ':', first + 1 );
+                    EXPECT_NE( second, std::string::npos ) << line;
+                    if( second == std::string::npos )
+                    {
+                        continue;
+                    }
+                    int process = std::stoi( line.substr( 0, first ) );
+                    int index   = std::stoi( line.substr( first + 1, second - first - 1 ) );
+                    auto payload = line.substr( second + 1 );
+                    EXPECT_EQ( payload, std::string( static_cast<size_t>( 20 + ( index * 37 ) % 300 ), static_cast<char>( 'a' + process ) ) );
+                    auto it = last.find( process );
+                    EXPECT_TRUE( it == last.end() || it->second < index );
+                    last[process] = index;
+                    ++count;
+                }
+            }
+            return count;
+        }
+
+        /**
+         * Returns the archives and then the active file, oldest first.
+        */
+        std::vector<std::filesystem::path> log_files() const
+        {
+            std::vector<std::filesystem::path> files;
+            for( int index = 1; std::filesystem::exists( directory() / ( "shared." + std::to_string( index ) + ".log" ) ); ++index )
+            {
+                files.push_back( directory() / ( "shared." + std::to_string( index ) + ".log" ) );
+            }
+            files.push_back( directory() / "shared.log" );
+            return files;
+        }
+
+}; // End of Shared_File class
+
+} // End of anonymous namespace
+
+/*************************************************************/
+/*      Records from several processes never interleave      */
+/*************************************************************/
+TEST_F( Shared_File, Processes_Append_Whole_Records )
+{
+    const auto settings = "[Sinks.Shared]\nDestination=TextFile\nMultiProcess=true\nFormat=\"%Message%\"\n"
+                          "FileName=\"" + ( directory() / "shared.log" ).string() + "\"\n";
+    run_processes( settings, 4, 2000 );
+
+    EXPECT_EQ( check_records( { directory() / "shared.log" } ), 8000u );
+}
+
+/************************************************************/
+/*      Processes take turns rotating the shared file       */
+/************************************************************/
+TEST_F( Shared_File, Coordinated_Rotation )
+{
+    const auto settings = "[Sinks.Shared]\nDestination=TextFile\nMultiProcess=true\nFormat=\"%Message%\"\n"
+                          "FileName=\"" + ( directory() / "shared.log" ).string() + "\"\nRotationSize=65536\n";
+    run_processes( settings, 4, 1000 );
+
+    auto files = log_files();
+    EXPECT_GT( files.size(), 4u );
+    EXPECT_EQ( check_records( files ), 4000u );
+    for( size_t i = 0; i + 1 < files.size(); ++i )
+    {
+        EXPECT_GE( std::filesystem::file_size( files[i] ), 65536u );
+    }
+}
+
+/****************************************************************/
+/*      Records wait in the buffer until it fills or is flushed  */
+/****************************************************************/
+TEST_F( Shared_File, Buffering )
+{
+    const auto file = directory() / "shared.log";
+    ASSERT_TRUE( configure( "[Sinks.Json]\nDestination=JsonFile\nMultiProcess=true\nBufferSize=65536\n"
+                            "FileName=\"" + file.string() + "\"\n" ) );
+    auto emitted = []( const std::string& name )
+    {
+        for( const auto& sink : tmns::log::stats().sinks )
+        {
+            if( sink.name == name )
+            {
+                return sink.records_emitted;
+            }
+        }
+        return uint64_t{ 0 };
+    };
+    tmns::log::info( "buffered" );
+    EXPECT_EQ( std::filesystem::file_size( file ), 0u );
+    EXPECT_EQ( emitted( "Json" ), 0u );
+    tmns::log::flush();
+    EXPECT_GT( std::filesystem::file_size( file ), 0u );
+    EXPECT_EQ( emitted( "Json" ), 1u );
+
+    ASSERT_TRUE( configure( "[Sinks.Text]\nDestination=TextFile\nMultiProcess=true\nAutoFlush=true\n"
+                            "Format=\"%Message%\"\nFileName=\"" + file.string() + "\"\n" ) );
+    const auto size = std::filesystem::file_size( file );
+    tmns::log::info( "immediate" );
+    EXPECT_EQ( std::filesystem::file_size( file ), size + 10 );
+    EXPECT_EQ( emitted( "Text" ), 1u );
+}
+
+/*************************************************************/
+/*      Settings that cannot be shared are rejected           */
+/*************************************************************/
+TEST_F( Shared_File, Invalid_Settings )
+{
+    const auto file = ( directory() / "shared.log" ).string();
+    EXPECT_FALSE( configure( "[Sinks.Text]\nDestination=TextFile\nMultiProcess=true\n"
+                             "FileName=\"" + ( directory() / "shared_%N.log" ).string() + "\"\n" ) );
+    EXPECT_FALSE( configure( "[Sinks.Text]\nDestination=TextFile\nMultiProcess=true\n"
+                             "FileName=\"" + file + "\"\nTarget=\"" + directory().string() + "\"\n" ) );
+    EXPECT_FALSE( configure( "[Sinks.Text]\nDestination=TextFile\nMultiProcess=maybe\n"
+                             "FileName=\"" + file + "\"\n" ) );
+}
@@ -0,0 +1,222 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_shared_memory.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <atomic>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// POSIX
+#include <unistd.h>
+
+// Boost Libraries
+#include <boost/log/core.hpp>
+
+// Terminus Libraries
+#include <terminus/log/configure.hpp>
+#include <terminus/log/impl/boost/log_writer.hpp>
+#include <terminus/log/impl/boost/sinks.hpp>
+#include <terminus/log/impl/shared_ring.hpp>
+#include <terminus/log/logger.hpp>
+#include <terminus/log/stats.hpp>
+#include <terminus/log/utility.hpp>
+
+// Project Libraries
+#include "config_fixture.hpp"
+
+namespace {
+
+using tmns::log::impl::ipc::Shared_Ring;
+
+class Shared_Memory : public Config_Fixture
+{
+    protected:
+
+        void TearDown() override
+        {
+            Config_Fixture::TearDown();
+            Shared_Ring::remove( segment() );
+        }
+
+        static std::string segment()
+        {
+            return "/tmns_log_test_" + std::to_string( ::getpid() );
+        }
+
+        /**
+         * Replaces the sinks with one writing the provided format to `output`, like the
+         * configuration of a writer process.
+        */
+        static void writer_sink( std::ostringstream& output,
+                                 const std::string&  format )
+        {
+            boost::log::core::get()->remove_all_sinks();
+            tmns::log::impl::sinks::add_console_sink( output, format, "Writer" );
+        }
+
+        static std::vector<std::string> pop_all( Shared_Ring& ring )
+        {
+            std::vector<std::string> records;
+            while( ring.try_pop( [&records]( std::string_view data ){ records.emplace_back( data ); } ) ) {}
+            return records;
+        }
+
+}; // End of Shared_Memory class
+
+} // End of anonymous namespace
+
+/***************************************************/
+/*      The ring keeps order and drops when full    */
+/***************************************************/
+TEST_F( Shared_Memory, Ring )
+{
+    auto ring = Shared_Ring::open( segment(), 3, 128 );
+    ASSERT_EQ( ring->slot_count(), 4u );
+    EXPECT_EQ( ring->max_record_size(), 128u - 16u );
+
+    EXPECT_TRUE( ring->try_push( "one" ) );
+    EXPECT_TRUE( ring->try_push( "two" ) );
+    EXPECT_TRUE( ring->try_push( "three" ) );
+    EXPECT_TRUE( ring->try_push( "four" ) );
+    EXPECT_FALSE( ring->try_push( "five" ) );
+    EXPECT_FALSE( ring->try_push( std::string( 200, 'x' ) ) );
+    EXPECT_EQ( ring->dropped(), 2u );
+
+    // A second mapping of the segment sees the same ring
+    auto other = Shared_Ring::open( segment(), 1024, 4096 );
+    EXPECT_EQ( other->slot_count(), 4u );
+    EXPECT_EQ( pop_all( *other ), ( std::vector<std::string>{ "one", "two", "three", "four" } ) );
+
+    EXPECT_TRUE( ring->try_push( "six" ) );
+    EXPECT_EQ( pop_all( *other ), std::vector<std::string>{ "six" } );
+    EXPECT_TRUE( pop_all( *ring ).empty() );
+}
+
+/*********************************************************/
+/*      Concurrent producers never lose accepted records  */
+/*********************************************************/
+TEST_F( Shared_Memory, Concurrent_Producers )
+{
+    auto ring = Shared_Ring::open( segment(), 256, 128 );
+    constexpr int THREADS = 4;
+    constexpr int RECORDS = 20000;
+
+    std::atomic<int> running{ THREADS };
+    std::atomic<uint64_t> accepted{ 0 };
+    std::vector<std::thread> producers;
+    for( int t = 0; t < THREADS; ++t )
+    {
+        producers.emplace_back( [&, t]()
+        {
+            for( int i = 0; i < RECORDS; ++i )
+            {
+                accepted += ring->try_push( std::to_string( t ) + ":" + std::to_string( i ) ) ? 1 : 0;
+            }
+            --running;
+        });
+    }
+
+    // Records of one producer arrive in the order it wrote them
+    uint64_t popped = 0;
+    std::vector<int> last( THREADS, -1 );
+    bool ordered = true;
+    auto consume = [&]( std::string_view data )
+    {
+        auto colon = data.find( ':' );
+        int thread = std::stoi( std::string{ data.substr( 0, colon ) } );
+        int index  = std::stoi( std::string{ data.substr( colon + 1 ) } );
+        ordered = ordered && index > last[thread];
+        last[thread] = index;
+        ++popped;
+    };
+    while( running.load() > 0 )
+    {
+        ring->try_pop( consume );
+    }
+    while( ring->try_pop( consume ) ) {}
+    for( auto& producer : producers )
+    {
+        producer.join();
+    }
+
+    EXPECT_TRUE( ordered );
+    EXPECT_EQ( popped, accepted.load() );
+    EXPECT_EQ( popped + ring->dropped(), static_cast<uint64_t>( THREADS * RECORDS ) );
+}
+
+/******************************************************************/
+/*      Records written to the ring are replayed by the writer    */
+/******************************************************************/
+TEST_F( Shared_Memory, Sink_And_Writer )
+{
+    ASSERT_TRUE( configure( "[Sinks.Ring]\nDestination=SharedMemory\nSegment=\"" + segment() + "\"\n"
+                            "SlotCount=16\nFilter=\"%Severity% >= info\"\n" ) );
+
+    tmns::log::Logger logger{ "ipc" };
+    logger.info( "order filled", tmns::log::kv( "qty", 5 ), tmns::log::kv( "px", 101.25 ),
+                 tmns::log::kv( "venue", "XNYS" ), tmns::log::kv( "final", true ) );
+    logger.debug( "filtered" );
+    logger.error( "rejected" );
+
+    auto stats = tmns::log::stats();
+    for( const auto& sink : stats.sinks )
+    {
+        if( sink.name == "Ring" )
+        {
+            EXPECT_EQ( sink.records_emitted, 2u );
+            EXPECT_EQ( sink.records_dropped, 0u );
+        }
+    }
+
+    std::ostringstream output;
+    writer_sink( output, "%Severity%|%Scope%|%Message%|%qty%|%px%|%venue%|%final%" );
+    tmns::log::impl::ipc::Log_Writer writer{ Shared_Ring::open( segment() ) };
+    EXPECT_EQ( writer.drain(), 2u );
+    EXPECT_EQ( writer.records_malformed(), 0u );
+    EXPECT_EQ( output.str(), "info|ipc|order filled|5|101.25|XNYS|true\n"
+                             "error|ipc|rejected||||\n" );
+}
+
+/*****************************************************************/
+/*      The writer reports the records producers dropped         */
+/*****************************************************************/
+TEST_F( Shared_Memory, Writer_Reports_Drops )
+{
+    ASSERT_TRUE( configure( "[Sinks.Ring]\nDestination=SharedMemory\nSegment=\"" + segment() + "\"\nSlotCount=2\n" ) );
+    for( int i = 0; i < 5; ++i )
+    {
+        tmns::log::info( "record " + std::to_string( i ) );
+    }
+
+    std::ostringstream output;
+    writer_sink( output, "%Severity%: %Message%" );
+    tmns::log::impl::ipc::Log_Writer writer{ Shared_Ring::open( segment() ) };
+    EXPECT_EQ( writer.drain(), 2u );
+    EXPECT_EQ( output.str(), "warning: 3 records dropped by producers of shared memory segment \"" + segment() +
+                             "\" because the ring was full or the record exceeded the slot size\n"
+                             "info: record 0\n"
+                             "info: record 1\n" );
+}
+
+/******************************************/
+/*      Invalid settings are reported     */
+/******************************************/
+TEST_F( Shared_Memory, Invalid_Settings )
+{
+    EXPECT_FALSE( configure( "[Sinks.Ring]\nDestination=SharedMemory\n" ) );
+}
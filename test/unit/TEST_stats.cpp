@@ -0,0 +1,208 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_stats.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <optional>
+#include <string>
+
+// Boost Libraries
+#include <boost/log/core.hpp>
+
+// Terminus Libraries
+#include <terminus/log/configure.hpp>
+#include <terminus/log/logger.hpp>
+#include <terminus/log/stats.hpp>
+#include <terminus/log/utility.hpp>
+
+// Project Libraries
+#include "config_fixture.hpp"
+
+namespace {
+
+/**
+ * Adds a lookup of a sink's statistics by name.
+*/
+class Stats : public Config_Fixture
+{
+    protected:
+
+        std::string temp_file( const std::string& name ) const
+        {
+            return ( directory() / name ).string();
+        }
+
+        static std::optional<tmns::log::Sink_Stats> find_sink( const tmns::log::Stats& stats,
+                                                               const std::string&      name )
+        {
+            for( const auto& sink : stats.sinks )
+            {
+                if( sink.name == name )
+                {
+                    return sink;
+                }
+            }
+            return std::nullopt;
+        }
+
+}; // End of Stats class
+
+} // End of anonymous namespace
+
+/*********************************************/
+/*      Records opened and filtered out      */
+/*********************************************/
+TEST_F( Stats, Opened_And_Filtered )
+{
+    ASSERT_TRUE( configure( "[Core]\nFilter=\"%Severity% >= info\"\n"
+                            "[Sinks.File]\nDestination=TextFile\nFileName=\"" + temp_file( "filtered.log" ) + "\"\n" ) );
+
+    auto before = tmns::log::stats();
+    tmns::log::debug( "filtered" );
+    tmns::log::debug( "filtered" );
+    tmns::log::info( "opened" );
+    tmns::log::flush();
+    auto after = tmns::log::stats();
+
+    EXPECT_EQ( after.records_filtered - before.records_filtered, 2 );
+    EXPECT_EQ( after.records_opened - before.records_opened, 1 );
+}
+
+/***********************************************/
+/*      Per-sink counters use section names    */
+/***********************************************/
+TEST_F( Stats, Text_File_Sink )
+{
+    ASSERT_TRUE( configure( "[Sinks.Text]\nDestination=TextFile\nFormat=\"%Message%\"\n"
+                            "FileName=\"" + temp_file( "text_%N.log" ) + "\"\nRotationSize=64\n" ) );
+
+    const std::string message( 40, 'x' );
+    for( int i = 0; i < 4; ++i )
+    {
+        tmns::log::info( message );
+    }
+    tmns::log::flush();
+
+    auto sink = find_sink( tmns::log::stats(), "Text" );
+    ASSERT_TRUE( sink.has_value() );
+    EXPECT_EQ( sink->records_emitted, 4 );
+    EXPECT_EQ( sink->bytes_written, 4 * message.size() );
+    EXPECT_EQ( sink->format_calls, 4 );
+    EXPECT_GT( sink->format_time.count(), 0 );
+    EXPECT_EQ( sink->rotations, 3 );
+    EXPECT_EQ( sink->queue_high_water, 0 );
+    EXPECT_EQ( sink->filter_calls, 0 );
+    EXPECT_EQ( sink->backend_time.count(), 0 );
+}
+
+/*********************************************/
+/*      Asynchronous sinks report queueing   */
+/*********************************************/
+TEST_F( Stats, Asynchronous_Json_Sink )
+{
+    ASSERT_TRUE( configure( "[Sinks.Json]\nDestination=JsonFile\nAsynchronous=true\n"
+                            "FileName=\"" + temp_file( "json.log" ) + "\"\n" ) );
+
+    for( int i = 0; i < 100; ++i )
+    {
+        tmns::log::info( "async ", i );
+    }
+    tmns::log::flush();
+
+    auto stats = tmns::log::stats();
+    auto sink  = find_sink( stats, "Json" );
+    ASSERT_TRUE( sink.has_value() );
+    EXPECT_EQ( sink->records_emitted, 100 );
+    EXPECT_GT( sink->bytes_written, 0 );
+    EXPECT_EQ( sink->queue_depth, 0 );
+    EXPECT_GE( sink->queue_high_water, 1 );
+    EXPECT_EQ( sink->records_dropped, 0 );
+    EXPECT_EQ( stats.records_dropped, 0 );
+}
+
+/*******************************************/
+/*      Removed sinks are not reported     */
+/*******************************************/
+TEST_F( Stats, Removed_Sinks )
+{
+    ASSERT_TRUE( configure( "[Sinks.Gone]\nDestination=TextFile\nFileName=\"" + temp_file( "gone.log" ) + "\"\n" ) );
+    ASSERT_TRUE( find_sink( tmns::log::stats(), "Gone" ).has_value() );
+
+    boost::log::core::get()->remove_all_sinks();
+    EXPECT_FALSE( find_sink( tmns::log::stats(), "Gone" ).has_value() );
+}
+
+/******************************************************/
+/*      The Null sink times each stage of a record    */
+/******************************************************/
+TEST_F( Stats, Null_Sink_Stages )
+{
+    ASSERT_TRUE( configure( "[Sinks.Formatted]\nDestination=Null\nFormat=\"%Scope%: %Message%\"\n"
+                            "Filter=\"%Scope% contains \\\"app\\\"\"\n"
+                            "[Sinks.Discarded]\nDestination=Null\n"
+                            "[Sinks.Untimed]\nDestination=Null\nTiming=false\n" ) );
+
+    tmns::log::Logger app{ "app" };
+    tmns::log::Logger db{ "db" };
+    for( int i = 0; i < 100; ++i )
+    {
+        app.info( "record" );
+        db.info( "record" );
+    }
+
+    auto stats = tmns::log::stats();
+    auto formatted = find_sink( stats, "Formatted" );
+    ASSERT_TRUE( formatted.has_value() );
+    EXPECT_EQ( formatted->filter_calls, 200 );
+    EXPECT_GT( formatted->filter_time.count(), 0 );
+    EXPECT_EQ( formatted->records_emitted, 100 );
+    EXPECT_EQ( formatted->format_calls, 100 );
+    EXPECT_EQ( formatted->bytes_written, 100 * std::string{ "app: record" }.size() );
+    EXPECT_GT( formatted->backend_time.count(), 0 );
+
+    // Without a format, records are passed through unformatted
+    auto discarded = find_sink( stats, "Discarded" );
+    ASSERT_TRUE( discarded.has_value() );
+    EXPECT_EQ( discarded->filter_calls, 200 );
+    EXPECT_EQ( discarded->records_emitted, 200 );
+    EXPECT_EQ( discarded->bytes_written, 0 );
+
+    auto untimed = find_sink( stats, "Untimed" );
+    ASSERT_TRUE( untimed.has_value() );
+    EXPECT_EQ( untimed->records_emitted, 200 );
+    EXPECT_EQ( untimed->filter_calls, 0 );
+    EXPECT_EQ( untimed->backend_time.count(), 0 );
+}
+
+/****************************************************/
+/*      Timing=true times the stages of other sinks  */
+/****************************************************/
+TEST_F( Stats, Timed_Text_File_Sink )
+{
+    ASSERT_TRUE( configure( "[Sinks.Text]\nDestination=TextFile\nFormat=\"%Message%\"\nTiming=true\n"
+                            "FileName=\"" + temp_file( "timed.log" ) + "\"\n" ) );
+
+    for( int i = 0; i < 10; ++i )
+    {
+        tmns::log::info( "timed" );
+    }
+    tmns::log::flush();
+
+    auto sink = find_sink( tmns::log::stats(), "Text" );
+    ASSERT_TRUE( sink.has_value() );
+    EXPECT_EQ( sink->records_emitted, 10 );
+    EXPECT_EQ( sink->filter_calls, 10 );
+    EXPECT_GT( sink->backend_time.count(), 0 );
+}
@@ -0,0 +1,151 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_threshold.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <string>
+
+// Boost Libraries
+#include <boost/log/core.hpp>
+#include <boost/log/sinks/basic_sink_backend.hpp>
+#include <boost/log/sinks/sync_frontend.hpp>
+#include <boost/log/utility/setup/from_settings.hpp>
+
+// Terminus Libraries
+#include <terminus/log/configure.hpp>
+#include <terminus/log/impl/boost/filter_compiler.hpp>
+#include <terminus/log/impl/boost/threshold.hpp>
+#include <terminus/log/logger.hpp>
+#include <terminus/log/stats.hpp>
+#include <terminus/log/utility.hpp>
+
+// Project Libraries
+#include "config_fixture.hpp"
+
+namespace {
+
+using severity_level = boost::log::trivial::severity_level;
+
+/**
+ * Reads back the severity threshold the configured filters allow.
+*/
+class Threshold : public Config_Fixture
+{
+    protected:
+
+        static severity_level minimum()
+        {
+            return static_cast<severity_level>( tmns::log::impl::minimum_severity().load() );
+        }
+
+}; // End of Threshold class
+
+/**
+ * Sink backend discarding every record, created by a factory this library does not own.
+*/
+class Discard_Backend : public boost::log::sinks::basic_sink_backend<boost::log::sinks::synchronized_feeding>
+{
+    public:
+
+        void consume( const boost::log::record_view& ) {}
+
+}; // End of Discard_Backend class
+
+class Discard_Factory : public boost::log::sink_factory<char>
+{
+    public:
+
+        boost::shared_ptr<boost::log::sinks::sink> create_sink( const settings_section& ) override
+        {
+            return boost::make_shared<boost::log::sinks::synchronous_sink<Discard_Backend>>();
+        }
+
+}; // End of Discard_Factory class
+
+} // End of anonymous namespace
+
+/*************************************************************/
+/*      Filters report the severity levels they may accept   */
+/*************************************************************/
+TEST( Severity_Mask, Filters )
+{
+    using tmns::log::impl::filter::severity_mask;
+
+    EXPECT_EQ( severity_mask( R"(%Severity% >= info)" ), 0b111100 );
+    EXPECT_EQ( severity_mask( R"(%Severity% < warning)" ), 0b000111 );
+    EXPECT_EQ( severity_mask( R"(%Scope% contains "Apple" and %Severity% >= warning)" ), 0b111000 );
+    EXPECT_EQ( severity_mask( R"(%Scope% contains "Apple" or %Severity% >= warning)" ), 0b111111 );
+    EXPECT_EQ( severity_mask( R"(not (%Severity% = debug or %Severity% = trace))" ), 0b111100 );
+    EXPECT_EQ( severity_mask( R"((%Scope% contains "Apple" and %Severity% >= error) or (%Scope% contains "Orange" and %Severity% >= info))" ),
+               0b111100 );
+
+    // Filters that are not compiled may accept anything
+    EXPECT_EQ( severity_mask( R"(%Line% > 10 and %Severity% >= error)" ), 0b111111 );
+}
+
+/***************************************************************************/
+/*      The threshold is the loosest level of the core filter and sinks    */
+/***************************************************************************/
+TEST_F( Threshold, Core_And_Sinks )
+{
+    ASSERT_TRUE( configure( "[Core]\nFilter=\"%Severity% >= info\"\n"
+                            "[Sinks.Warnings]\nDestination=Console\nFilter=\"%Severity% >= warning\"\n"
+                            "[Sinks.Apple]\nDestination=Console\nFilter=\"%Scope% contains \\\"Apple\\\" and %Severity% >= error\"\n" ) );
+    EXPECT_EQ( minimum(), severity_level::warning );
+
+    // A sink without a filter accepts whatever the core lets through
+    ASSERT_TRUE( configure( "[Core]\nFilter=\"%Severity% >= info\"\n"
+                            "[Sinks.All]\nDestination=Console\n" ) );
+    EXPECT_EQ( minimum(), severity_level::info );
+
+    // Without a core filter, sinks decide
+    ASSERT_TRUE( configure( "[Sinks.Errors]\nDestination=Console\nAsynchronous=true\nFilter=\"%Severity% >= error\"\n" ) );
+    EXPECT_EQ( minimum(), severity_level::error );
+
+    // The default configuration accepts everything
+    boost::log::core::get()->remove_all_sinks();
+    tmns::log::configure();
+    EXPECT_EQ( minimum(), severity_level::trace );
+}
+
+/****************************************************************/
+/*      Records below the threshold are never opened            */
+/****************************************************************/
+TEST_F( Threshold, Skips_Records )
+{
+    ASSERT_TRUE( configure( "[Sinks.Warnings]\nDestination=Console\nFormat=\"%Message%\"\nFilter=\"%Severity% >= warning\"\n" ) );
+    ASSERT_EQ( minimum(), severity_level::warning );
+
+    tmns::log::Logger logger{ "threshold" };
+    auto before = tmns::log::stats();
+    logger.debug( "skipped" );
+    logger.info( "skipped" );
+    tmns::log::trace( "skipped" );
+    auto after = tmns::log::stats();
+
+    EXPECT_EQ( after.records_opened - before.records_opened, 0u );
+    EXPECT_EQ( after.records_filtered - before.records_filtered, 3u );
+}
+
+/****************************************************************************/
+/*      Sinks created by other factories keep every level from being skipped */
+/****************************************************************************/
+TEST_F( Threshold, Unknown_Sinks )
+{
+    boost::log::register_sink_factory( "Discard", boost::make_shared<Discard_Factory>() );
+    ASSERT_TRUE( configure( "[Sinks.Warnings]\nDestination=Console\nFilter=\"%Severity% >= warning\"\n"
+                            "[Sinks.Discard]\nDestination=Discard\n" ) );
+    EXPECT_EQ( minimum(), severity_level::trace );
+}
@@ -0,0 +1,280 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_unix_socket.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <cstring>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+// POSIX
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+// Terminus Libraries
+#include <terminus/log/configure.hpp>
+#include <terminus/log/stats.hpp>
+#include <terminus/log/utility.hpp>
+
+// Project Libraries
+#include "config_fixture.hpp"
+
+namespace {
+
+/**
+ * Listening `AF_UNIX` socket standing in for a log shipper.
+*/
+class Peer
+{
+    public:
+
+        Peer( const std::string& path,
+              int                type )
+          : m_path{ path }
+        {
+            std::filesystem::remove( m_path );
+            m_listen_fd = ::socket( AF_UNIX, type, 0 );
+            sockaddr_un address{};
+            address.sun_family = AF_UNIX;
+            std::strncpy( address.sun_path, m_path.c_str(), sizeof( address.sun_path ) - 1 );
+            EXPECT_EQ( ::bind( m_listen_fd, reinterpret_cast<const sockaddr*>( &address ), sizeof( address ) ), 0 );
+            EXPECT_EQ( ::listen( m_listen_fd, 4 ), 0 );
+        }
+
+        ~Peer()
+        {
+            disconnect();
+            ::close( m_listen_fd );
+            std::filesystem::remove( m_path );
+        }
+
+        /**
+         * Accepts the sink's connection, waiting up to five seconds.
+        */
+        bool accept()
+        {
+            pollfd poll_fd{ m_listen_fd, POLLIN, 0 };
+            if( ::poll( &poll_fd, 1, 5000 ) != 1 )
+            {
+                return false;
+            }
+            m_fd = ::accept( m_listen_fd, nullptr, nullptr );
+            return m_fd >= 0;
+        }
+
+        void disconnect()
+        {
+            if( m_fd >= 0 )
+            {
+                ::close( m_fd );
+                m_fd = -1;
+            }
+        }
+
+        /**
+         * Reads messages until `count` are received or nothing arrives for two seconds.
+         * Stream messages are split on newlines.
+        */
+        std::vector<std::string> read( size_t count )
+        {
+            std::vector<std::string> messages;
+            std::string pending;
+            char buffer[4096];
+            while( messages.size() < count )
+            {
+                pollfd poll_fd{ m_fd, POLLIN, 0 };
+                if( ::poll( &poll_fd, 1, 2000 ) != 1 )
+                {
+                    break;
+                }
+                ssize_t size = ::recv( m_fd, buffer, sizeof( buffer ), 0 );
+                if( size <= 0 )
+                {
+                    break;
+                }
+                if( m_stream )
+                {
+                    pending.append( buffer, static_cast<size_t>( size ) );
+                    size_t newline;
+                    while( ( newline = pending.find( '\n' ) ) != std::string::npos )
+                    {
+                        messages.push_back( pending.substr( 0, newline ) );
+                        pending.erase( 0, newline + 1 );
+                    }
+                }
+                else
+                {
+                    messages.emplace_back( buffer, static_cast<size_t>( size ) );
+                }
+            }
+            return messages;
+        }
+
+        void set_packets()
+        {
+            m_stream = false;
+        }
+
+    private:
+
+        std::string m_path;
+
+        int m_listen_fd{ -1 };
+
+        int m_fd{ -1 };
+
+        bool m_stream{ true };
+
+}; // End of Peer class
+
+class Unix_Socket : public Config_Fixture
+{
+    protected:
+
+        std::string socket_path() const
+        {
+            return ( directory() / "shipper.sock" ).string();
+        }
+
+        static std::optional<tmns::log::Sink_Stats> find_sink( const std::string& name )
+        {
+            for( const auto& sink : tmns::log::stats().sinks )
+            {
+                if( sink.name == name )
+                {
+                    return sink;
+                }
+            }
+            return std::nullopt;
+        }
+
+}; // End of Unix_Socket class
+
+} // End of anonymous namespace
+
+/*************************************************************/
+/*      Stream sockets receive newline-separated records     */
+/*************************************************************/
+TEST_F( Unix_Socket, Stream )
+{
+    Peer peer{ socket_path(), SOCK_STREAM };
+    ASSERT_TRUE( configure( "[Sinks.Shipper]\nDestination=UnixSocket\nPath=\"" + socket_path() + "\"\n"
+                            "Format=\"%Severity%: %Message%\"\nBatchSize=4\n" ) );
+    ASSERT_TRUE( peer.accept() );
+
+    for( int i = 0; i < 10; ++i )
+    {
+        tmns::log::info( "record " + std::to_string( i ) );
+    }
+    tmns::log::flush();
+
+    auto messages = peer.read( 10 );
+    ASSERT_EQ( messages.size(), 10u );
+    EXPECT_EQ( messages.front(), "info: record 0" );
+    EXPECT_EQ( messages.back(), "info: record 9" );
+
+    auto sink = find_sink( "Shipper" );
+    ASSERT_TRUE( sink.has_value() );
+    EXPECT_EQ( sink->records_emitted, 10u );
+    EXPECT_EQ( sink->records_dropped, 0u );
+}
+
+/*********************************************************/
+/*      Sequenced packet sockets receive one packet each */
+/*********************************************************/
+TEST_F( Unix_Socket, Seq_Packet )
+{
+    Peer peer{ socket_path(), SOCK_SEQPACKET };
+    peer.set_packets();
+    ASSERT_TRUE( configure( "[Sinks.Shipper]\nDestination=UnixSocket\nPath=\"" + socket_path() + "\"\n"
+                            "SocketType=SeqPacket\nEncoding=Json\n" ) );
+    ASSERT_TRUE( peer.accept() );
+
+    tmns::log::warn( "first" );
+    tmns::log::error( "second" );
+    tmns::log::flush();
+
+    auto messages = peer.read( 2 );
+    ASSERT_EQ( messages.size(), 2u );
+    EXPECT_EQ( messages[0].front(), '{' );
+    EXPECT_NE( messages[0].find( "\"first\"" ), std::string::npos );
+    EXPECT_NE( messages[1].find( "\"second\"" ), std::string::npos );
+
+    auto sink = find_sink( "Shipper" );
+    ASSERT_TRUE( sink.has_value() );
+    EXPECT_EQ( sink->records_emitted, 2u );
+    EXPECT_EQ( sink->records_dropped, 0u );
+}
+
+/**************************************************************/
+/*      Records wait in a bounded buffer while the peer is away */
+/**************************************************************/
+TEST_F( Unix_Socket, Reconnect )
+{
+    std::filesystem::remove( socket_path() );
+    ASSERT_TRUE( configure( "[Sinks.Shipper]\nDestination=UnixSocket\nPath=\"" + socket_path() + "\"\n"
+                            "Format=\"%Message%\"\nBufferSize=40\nReconnectInterval=20\n" ) );
+
+    // Each record is 10 bytes, so the buffer holds four of them
+    for( int i = 0; i < 6; ++i )
+    {
+        tmns::log::info( "message_" + std::to_string( i ) + "_" );
+    }
+    tmns::log::flush();
+
+    // Buffered records are not emitted until they are sent
+    auto sink = find_sink( "Shipper" );
+    ASSERT_TRUE( sink.has_value() );
+    EXPECT_EQ( sink->records_emitted, 0u );
+    EXPECT_EQ( sink->records_dropped, 2u );
+
+    // The buffered records are sent once the peer appears
+    {
+        Peer peer{ socket_path(), SOCK_STREAM };
+        ASSERT_TRUE( peer.accept() );
+        auto messages = peer.read( 4 );
+        ASSERT_EQ( messages.size(), 4u );
+        EXPECT_EQ( messages[0], "message_0_" );
+        EXPECT_EQ( messages[3], "message_3_" );
+
+        tmns::log::flush();
+        sink = find_sink( "Shipper" );
+        ASSERT_TRUE( sink.has_value() );
+        EXPECT_EQ( sink->records_emitted, 4u );
+        EXPECT_EQ( sink->bytes_written, 40u );
+        EXPECT_EQ( sink->records_dropped, 2u );
+    }
+
+    // And again after the peer restarts
+    Peer peer{ socket_path(), SOCK_STREAM };
+    tmns::log::info( "after" );
+    ASSERT_TRUE( peer.accept() );
+    auto messages = peer.read( 1 );
+    ASSERT_EQ( messages.size(), 1u );
+    EXPECT_EQ( messages[0], "after" );
+}
+
+/******************************************/
+/*      Invalid settings are reported     */
+/******************************************/
+TEST_F( Unix_Socket, Invalid_Settings )
+{
+    EXPECT_FALSE( configure( "[Sinks.Shipper]\nDestination=UnixSocket\n" ) );
+    EXPECT_FALSE( configure( "[Sinks.Shipper]\nDestination=UnixSocket\nPath=/tmp/x.sock\nSocketType=Datagram\n" ) );
+}
@@ -20,6 +20,12 @@
 // GoogleTest
 #include <gtest/gtest.h>
 
+// C++ Libraries
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
 using Utility = Console_Fixture;
 
 /********************************/
@@ -214,4 +220,36 @@ TEST_F( Utility, Log_Location_Fatal )
     tmns::log::fatal( ADD_CURRENT_LOC(), "Hello, World!" );
     expect_captured( "fatal" );
     expect_captured( "TEST_utility.cpp" );
-}
\ No newline at end of file
+}
+
+/*******************************************************/
+/*      Every thread logs with the global scope        */
+/*******************************************************/
+TEST( Utility_Threads, Global_Scope_From_Threads )
+{
+    std::ostringstream output;
+    boost::log::core::get()->remove_all_sinks();
+    tmns::log::impl::sinks::add_console_sink( output, "%Scope%: %Message%", "Threads" );
+
+    std::vector<std::thread> threads;
+    for( int i = 0; i < 4; ++i )
+    {
+        threads.emplace_back( [i]()
+        {
+            tmns::log::info( "Hello from thread ", i );
+        });
+    }
+    for( auto& thread : threads )
+    {
+        thread.join();
+    }
+    tmns::log::flush();
+
+    for( int i = 0; i < 4; ++i )
+    {
+        EXPECT_THAT( output.str(), testing::HasSubstr( "global: Hello from thread " + std::to_string( i ) + "\n" ) );
+    }
+
+    boost::log::core::get()->remove_all_sinks();
+    tmns::log::configure();
+}
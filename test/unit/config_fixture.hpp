@@ -0,0 +1,93 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    config_fixture.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Terminus Libraries
+#include <terminus/log/configure.hpp>
+
+// Boost Libraries
+#include <boost/log/core.hpp>
+
+// GoogleTest Libraries
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+
+/**
+ * Lets each test replace the sinks with ones configured from INI contents, and gives it a
+ * unique temp directory for its files.  The default console sink is restored and the
+ * directory removed afterwards.
+*/
+class Config_Fixture : public testing::Test
+{
+    protected:
+
+        void SetUp() override
+        {
+            // Pick a directory no other test, in this process or another, is using.
+            std::random_device random;
+            do
+            {
+                m_directory = std::filesystem::temp_directory_path() /
+                              ( "tmns_log_config." + std::to_string( random() ) );
+            } while( !std::filesystem::create_directories( m_directory ) );
+        }
+
+        void TearDown() override
+        {
+            boost::log::core::get()->remove_all_sinks();
+            boost::log::core::get()->reset_filter();
+            tmns::log::configure();
+            std::filesystem::remove_all( m_directory );
+        }
+
+        /**
+         * Replaces all sinks and the core filter with the ones from the INI contents.
+        */
+        static bool configure( const std::string& contents )
+        {
+            boost::log::core::get()->remove_all_sinks();
+            boost::log::core::get()->reset_filter();
+            std::istringstream config{ contents };
+            return tmns::log::configure( config );
+        }
+
+        [[nodiscard]] const std::filesystem::path& directory() const
+        {
+            return m_directory;
+        }
+
+        /**
+         * Writes the contents to a file in the temp directory and returns its path.
+        */
+        std::string write_file( const std::string& name,
+                                const std::string& contents ) const
+        {
+            auto path = ( m_directory / name ).string();
+            std::ofstream output{ path, std::ios::binary };
+            output << contents;
+            return path;
+        }
+
+    private:
+
+        std::filesystem::path m_directory;
+
+}; // End of Config_Fixture Class
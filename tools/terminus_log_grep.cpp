@@ -0,0 +1,184 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    terminus_log_grep.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * Searches log files written by the `TextFile` and `JsonFile` sinks on all cores.  Large
+ * files are split into chunks, and lines that cannot match are skipped by a vectorized
+ * literal search before they are parsed.
+ *
+ * Usage:
+ *
+ *     terminus_log_grep [--literal=TEXT]... [--regex=RE] [--scope=SCOPE] [--severity=LEVEL]
+ *                       [--from=TIME] [--to=TIME] [--count] [--no-filename]
+ *                       [--threads=N] [--chunk-size=BYTES] PATH...
+ *
+ * Directories are searched recursively, in path order, skipping sidecar ".idx" files.
+ * `--scope` matches a scope and the scopes below it, `--severity` the given level and
+ * above, and times are UTC in ISO 8601 form; these only match `JsonFile` records.  The
+ * exit status is 0 if a record matched, 1 if none did, and 2 on error.
+*/
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <charconv>
+#include <exception>
+#include <filesystem>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Terminus Libraries
+#include <terminus/log/impl/search.hpp>
+
+namespace {
+
+int64_t parse_time_option( std::string_view value )
+{
+    auto time = tmns::log::impl::reader::parse_time_stamp( value );
+    if( !time )
+    {
+        throw std::runtime_error( "Invalid time \"" + std::string{ value } + "\"" );
+    }
+    return *time;
+}
+
+size_t parse_size_option( std::string_view value )
+{
+    size_t size = 0;
+    auto [end, error] = std::from_chars( value.data(), value.data() + value.size(), size );
+    if( error != std::errc{} || end != value.data() + value.size() )
+    {
+        throw std::runtime_error( "Invalid number \"" + std::string{ value } + "\"" );
+    }
+    return size;
+}
+
+/**
+ * Adds the file, or the files below the directory in path order, to `files`.
+*/
+void add_path( const std::filesystem::path& path,
+               std::vector<std::string>&    files )
+{
+    if( !std::filesystem::is_directory( path ) )
+    {
+        if( !std::filesystem::exists( path ) )
+        {
+            throw std::runtime_error( "No such file \"" + path.string() + "\"" );
+        }
+        files.push_back( path.string() );
+        return;
+    }
+
+    std::vector<std::string> found;
+    for( const auto& entry : std::filesystem::recursive_directory_iterator{ path } )
+    {
+        if( entry.is_regular_file() && entry.path().extension() != ".idx" && entry.path().extension() != ".tmp" )
+        {
+            found.push_back( entry.path().string() );
+        }
+    }
+    std::sort( found.begin(), found.end() );
+    files.insert( files.end(), found.begin(), found.end() );
+}
+
+} // End of anonymous namespace
+
+int main( int argc, char* argv[] )
+{
+    using namespace tmns::log::impl::search;
+
+    Query query;
+    Search_Options options;
+    bool file_names = true;
+    std::vector<std::string> paths;
+    try
+    {
+        for( int i = 1; i < argc; ++i )
+        {
+            std::string_view arg{ argv[i] };
+            if( arg.starts_with( "--literal=" ) )
+            {
+                query.literals.emplace_back( arg.substr( 10 ) );
+            }
+            else if( arg.starts_with( "--regex=" ) )
+            {
+                query.regex = std::string{ arg.substr( 8 ) };
+            }
+            else if( arg.starts_with( "--scope=" ) )
+            {
+                query.scope = std::string{ arg.substr( 8 ) };
+            }
+            else if( arg.starts_with( "--severity=" ) )
+            {
+                query.min_severity = severity_rank( arg.substr( 11 ) );
+                if( !query.min_severity )
+                {
+                    throw std::runtime_error( "Invalid severity \"" + std::string{ arg.substr( 11 ) } + "\"" );
+                }
+            }
+            else if( arg.starts_with( "--from=" ) )
+            {
+                query.from_time = parse_time_option( arg.substr( 7 ) );
+            }
+            else if( arg.starts_with( "--to=" ) )
+            {
+                query.to_time = parse_time_option( arg.substr( 5 ) );
+            }
+            else if( arg == "--count" )
+            {
+                options.count_only = true;
+            }
+            else if( arg == "--no-filename" )
+            {
+                file_names = false;
+            }
+            else if( arg.starts_with( "--threads=" ) )
+            {
+                options.scan.threads = parse_size_option( arg.substr( 10 ) );
+            }
+            else if( arg.starts_with( "--chunk-size=" ) )
+            {
+                options.scan.chunk_size = std::max<size_t>( parse_size_option( arg.substr( 13 ) ), 1 );
+            }
+            else if( arg.starts_with( "--" ) )
+            {
+                throw std::runtime_error( "Unknown option \"" + std::string{ arg } + "\"" );
+            }
+            else
+            {
+                add_path( std::string{ arg }, paths );
+            }
+        }
+        if( argc < 2 || paths.empty() )
+        {
+            std::cerr << "usage: terminus_log_grep [--literal=TEXT]... [--regex=RE] [--scope=SCOPE] [--severity=LEVEL]"
+                      << " [--from=TIME] [--to=TIME] [--count] [--no-filename] [--threads=N] [--chunk-size=BYTES] PATH..."
+                      << std::endl;
+            return 2;
+        }
+        options.with_file_name = file_names && paths.size() > 1;
+
+        std::ios_base::sync_with_stdio( false );
+        const Matcher matcher{ std::move( query ) };
+        const auto matches = search_files( paths, matcher, std::cout, options );
+        std::cout.flush();
+        return matches > 0 ? 0 : 1;
+    }
+    catch( const std::exception& e )
+    {
+        std::cerr << "terminus_log_grep: " << e.what() << std::endl;
+        return 2;
+    }
+}
@@ -0,0 +1,95 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    terminus_log_merge.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * Merges log files that are each in order, such as the per-thread shards a "%T" file sink
+ * writes, into one ordered stream.
+ *
+ * Usage:
+ *
+ *     terminus_log_merge [--key=RecordID|TimeStamp|Line] [--output=FILE] FILE...
+ *
+ * JSON shards of one process merge by "RecordID" (the default), JSON files of several
+ * processes by "TimeStamp", and text files by "Line" when their format starts with the
+ * time stamp.  The merged stream goes to standard output unless `--output` is given.
+*/
+
+// C++ Standard Libraries
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Terminus Libraries
+#include <terminus/log/impl/merge.hpp>
+
+int main( int argc, char* argv[] )
+{
+    using namespace tmns::log::impl::merge;
+
+    Merge_Key key = Merge_Key::RECORD_ID;
+    std::string output_path;
+    std::vector<std::string> files;
+    try
+    {
+        for( int i = 1; i < argc; ++i )
+        {
+            std::string_view arg{ argv[i] };
+            if( arg.starts_with( "--key=" ) )
+            {
+                key = parse_merge_key( arg.substr( 6 ) );
+            }
+            else if( arg.starts_with( "--output=" ) )
+            {
+                output_path = arg.substr( 9 );
+            }
+            else if( arg.starts_with( "--" ) )
+            {
+                throw std::runtime_error( "Unknown option \"" + std::string{ arg } + "\"" );
+            }
+            else
+            {
+                files.emplace_back( arg );
+            }
+        }
+        if( files.empty() )
+        {
+            std::cerr << "usage: terminus_log_merge [--key=RecordID|TimeStamp|Line] [--output=FILE] FILE..." << std::endl;
+            return 2;
+        }
+
+        std::ios_base::sync_with_stdio( false );
+        if( output_path.empty() )
+        {
+            merge_files( files, std::cout, key );
+            std::cout.flush();
+        }
+        else
+        {
+            std::ofstream output{ output_path };
+            if( !output.is_open() )
+            {
+                throw std::runtime_error( "Failed to open \"" + output_path + "\"" );
+            }
+            merge_files( files, output, key );
+        }
+    }
+    catch( const std::exception& e )
+    {
+        std::cerr << "terminus_log_merge: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,118 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    terminus_log_seek.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * Prints the records of log files that fall in a time or "RecordID" window, using the
+ * sidecar index of files written with `Index=true` to read only the blocks of the window.
+ *
+ * Usage:
+ *
+ *     terminus_log_seek [--from=TIME] [--to=TIME] [--from-id=N] [--to-id=N] FILE...
+ *
+ * Times are UTC in ISO 8601 form, such as "2026-10-19T10:00:00.5", and all bounds are
+ * inclusive.  Files are read in the order given, so list rotated files oldest first.
+*/
+
+// C++ Standard Libraries
+#include <charconv>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Terminus Libraries
+#include <terminus/log/impl/file_index.hpp>
+
+namespace {
+
+int64_t parse_time_option( std::string_view value )
+{
+    auto time = tmns::log::impl::index::parse_time_stamp( value );
+    if( !time )
+    {
+        throw std::runtime_error( "Invalid time \"" + std::string{ value } + "\"" );
+    }
+    return *time;
+}
+
+uint64_t parse_id_option( std::string_view value )
+{
+    uint64_t id = 0;
+    auto [end, error] = std::from_chars( value.data(), value.data() + value.size(), id );
+    if( error != std::errc{} || end != value.data() + value.size() )
+    {
+        throw std::runtime_error( "Invalid record id \"" + std::string{ value } + "\"" );
+    }
+    return id;
+}
+
+} // End of anonymous namespace
+
+int main( int argc, char* argv[] )
+{
+    using namespace tmns::log::impl::index;
+
+    Window window;
+    std::vector<std::string> files;
+    try
+    {
+        for( int i = 1; i < argc; ++i )
+        {
+            std::string_view arg{ argv[i] };
+            if( arg.starts_with( "--from=" ) )
+            {
+                window.from_time = parse_time_option( arg.substr( 7 ) );
+            }
+            else if( arg.starts_with( "--to=" ) )
+            {
+                window.to_time = parse_time_option( arg.substr( 5 ) );
+            }
+            else if( arg.starts_with( "--from-id=" ) )
+            {
+                window.from_id = parse_id_option( arg.substr( 10 ) );
+            }
+            else if( arg.starts_with( "--to-id=" ) )
+            {
+                window.to_id = parse_id_option( arg.substr( 8 ) );
+            }
+            else if( arg.starts_with( "--" ) )
+            {
+                throw std::runtime_error( "Unknown option \"" + std::string{ arg } + "\"" );
+            }
+            else
+            {
+                files.emplace_back( arg );
+            }
+        }
+        if( files.empty() )
+        {
+            std::cerr << "usage: terminus_log_seek [--from=TIME] [--to=TIME] [--from-id=N] [--to-id=N] FILE..." << std::endl;
+            return 2;
+        }
+
+        std::ios_base::sync_with_stdio( false );
+        for( const auto& file : files )
+        {
+            read_window( file, window, std::cout );
+        }
+        std::cout.flush();
+    }
+    catch( const std::exception& e )
+    {
+        std::cerr << "terminus_log_seek: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,149 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2026 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    terminus_log_writerd.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * Log writer process for applications using "SharedMemory" sinks.  It reads the records
+ * the applications put in a shared-memory ring and writes them through the sinks of its
+ * own configuration file, so formatting, file I/O, and rotation happen in this process.
+ * One writer can serve every process on the host that logs to the same segment.
+ *
+ * Usage:
+ *
+ *     terminus_log_writerd --segment=NAME --config=FILE [--slot-count=N] [--slot-size=N]
+ *                          [--poll-interval=MICROSECONDS]
+ *
+ * The slot settings apply if the writer creates the segment.  The configuration must not
+ * contain a "SharedMemory" sink writing to the same segment.  The writer exits on SIGINT
+ * or SIGTERM after writing the records left in the ring.
+*/
+
+// C++ Standard Libraries
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+
+// Terminus Libraries
+#include <terminus/log/configure.hpp>
+#include <terminus/log/impl/boost/log_writer.hpp>
+#include <terminus/log/utility.hpp>
+
+namespace {
+
+std::atomic<bool> g_stop{ false };
+
+void request_stop( int /*signal*/ )
+{
+    g_stop.store( true );
+}
+
+/**
+ * Returns the value of the `--name=value` option, if present.
+*/
+std::optional<std::string> find_option( int               argc,
+                                        char*             argv[],
+                                        std::string_view  name )
+{
+    const std::string prefix = "--" + std::string{ name } + "=";
+    for( int i = 1; i < argc; ++i )
+    {
+        std::string_view arg{ argv[i] };
+        if( arg.starts_with( prefix ) )
+        {
+            return std::string{ arg.substr( prefix.size() ) };
+        }
+    }
+    return std::nullopt;
+}
+
+void usage()
+{
+    std::cerr << "usage: terminus_log_writerd --segment=NAME --config=FILE [--slot-count=N] [--slot-size=N]\n"
+                 "                            [--poll-interval=MICROSECONDS]" << std::endl;
+}
+
+} // End of anonymous namespace
+
+int main( int argc, char* argv[] )
+{
+    using namespace tmns::log;
+
+    auto segment = find_option( argc, argv, "segment" );
+    auto config  = find_option( argc, argv, "config" );
+    if( !segment || !config )
+    {
+        usage();
+        return 2;
+    }
+
+    std::shared_ptr<impl::ipc::Shared_Ring> ring;
+    std::chrono::microseconds poll_interval{ 1000 };
+    try
+    {
+        auto slot_count = impl::ipc::Shared_Ring::DEFAULT_SLOT_COUNT;
+        auto slot_size  = impl::ipc::Shared_Ring::DEFAULT_SLOT_SIZE;
+        if( auto value = find_option( argc, argv, "slot-count" ) )
+        {
+            slot_count = std::stoull( *value );
+        }
+        if( auto value = find_option( argc, argv, "slot-size" ) )
+        {
+            slot_size = static_cast<uint32_t>( std::stoul( *value ) );
+        }
+        if( auto value = find_option( argc, argv, "poll-interval" ) )
+        {
+            poll_interval = std::chrono::microseconds( std::stoll( *value ) );
+        }
+        ring = impl::ipc::Shared_Ring::open( *segment, slot_count, slot_size );
+    }
+    catch( const std::exception& e )
+    {
+        std::cerr << "terminus_log_writerd: " << e.what() << std::endl;
+        return 1;
+    }
+
+    if( !configure( *config ) )
+    {
+        return 1;
+    }
+
+    std::signal( SIGINT,  request_stop );
+    std::signal( SIGTERM, request_stop );
+
+    // Records are read in batches so drop reports are not delayed by a busy ring
+    static constexpr size_t BATCH = 4096;
+    impl::ipc::Log_Writer writer{ ring };
+    while( !g_stop.load() )
+    {
+        if( writer.drain( BATCH ) == 0 )
+        {
+            flush();
+            std::this_thread::sleep_for( poll_interval );
+        }
+    }
+
+    writer.drain();
+    flush();
+    if( writer.records_malformed() > 0 )
+    {
+        std::cerr << "terminus_log_writerd: " << writer.records_malformed() << " malformed records skipped" << std::endl;
+    }
+    return 0;
+}